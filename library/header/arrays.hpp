@@ -3,7 +3,19 @@
 ///
 #pragma once
 
+#include "./arrays/array_span.hpp"
 #include "./arrays/array_list.hpp"
+#include "./arrays/shared_array_list.hpp"
+#include "./arrays/array_deque.hpp"
+#include "./arrays/segmented_array_list.hpp"
+#include "./arrays/eytzinger_array.hpp"
+#include "./arrays/bit_array.hpp"
+#include "./arrays/bit_set.hpp"
+#include "./arrays/priority_queue.hpp"
+#include "./arrays/indexed_priority_queue.hpp"
+#include "./arrays/column_list.hpp"
+#include "./arrays/flat_map.hpp"
+#include "./arrays/flat_set.hpp"
 
 namespace SPL {
   /// <summary>
@@ -12,4 +24,93 @@ namespace SPL {
   /// <typeparam name="T">Element type.</typeparam>
   template<typename T>
   using ArrayList = Arrays::ArrayList<T>;
+  /// <summary>
+  /// Small array list class (with inline storage).
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  /// <typeparam name="N">Inline capacity.</typeparam>
+  template<typename T, Size N = 8>
+  using SmallArrayList = Arrays::ArrayList<T, N>;
+  /// <summary>
+  /// Shared array list class (copy-on-write).
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  template<typename T>
+  using SharedArrayList = Arrays::SharedArrayList<T>;
+  /// <summary>
+  /// Eytzinger array class (immutable search layout).
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  template<typename T>
+  using EytzingerArray = Arrays::EytzingerArray<T>;
+  /// <summary>
+  /// Array span class (non-owning view).
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  template<typename T>
+  using ArraySpan = Arrays::ArraySpan<T>;
+  /// <summary>
+  /// Constant array span class (non-owning read-only view).
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  template<typename T>
+  using ConstArraySpan = Arrays::ConstArraySpan<T>;
+  /// <summary>
+  /// Array deque class.
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  template<typename T>
+  using ArrayDeque = Arrays::ArrayDeque<T>;
+  /// <summary>
+  /// Segmented array list class (stable element addresses).
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  /// <typeparam name="C">Chunk length.</typeparam>
+  template<typename T, Size C = 1024>
+  using SegmentedArrayList = Arrays::SegmentedArrayList<T, C>;
+  /// <summary>
+  /// Bit array class (dynamic length).
+  /// </summary>
+  using BitArray = Arrays::BitArray;
+  /// <summary>
+  /// Bit set class (fixed length).
+  /// </summary>
+  /// <typeparam name="N">Number of bits.</typeparam>
+  template<Size N>
+  using BitSet = Arrays::BitSet<N>;
+  /// <summary>
+  /// Priority queue class (4-ary heap).
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  /// <typeparam name="C">Comparator type.</typeparam>
+  template<typename T, typename C = Comparator<Metadata::ConstantType<T>>>
+  using PriorityQueue = Arrays::PriorityQueue<T, C>;
+  /// <summary>
+  /// Indexed priority queue class (4-ary heap with updatable keys).
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  /// <typeparam name="C">Comparator type.</typeparam>
+  template<typename T, typename C = Comparator<Metadata::ConstantType<T>>>
+  using IndexedPriorityQueue = Arrays::IndexedPriorityQueue<T, C>;
+  /// <summary>
+  /// Column list class (struct of arrays).
+  /// </summary>
+  /// <typeparam name="T">Row type (tuple of column types).</typeparam>
+  template<typename T>
+  using ColumnList = Arrays::ColumnList<T>;
+  /// <summary>
+  /// Flat map class (sorted key and value arrays).
+  /// </summary>
+  /// <typeparam name="K">Key type.</typeparam>
+  /// <typeparam name="V">Value type.</typeparam>
+  /// <typeparam name="C">Key comparator type.</typeparam>
+  template<typename K, typename V, typename C = Comparator<Metadata::ConstantType<K>>>
+  using FlatMap = Arrays::FlatMap<K, V, C>;
+  /// <summary>
+  /// Flat set class (sorted value array).
+  /// </summary>
+  /// <typeparam name="T">Value type.</typeparam>
+  /// <typeparam name="C">Comparator type.</typeparam>
+  template<typename T, typename C = Comparator<Metadata::ConstantType<T>>>
+  using FlatSet = Arrays::FlatSet<T, C>;
 }
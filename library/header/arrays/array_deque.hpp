@@ -0,0 +1,621 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#include <iterator>
+
+#include "./types.hpp"
+
+namespace SPL::Arrays {
+  /// <summary>
+  /// Array deque class declaration.
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  template<typename T>
+  class ArrayDeque;
+  /// <summary>
+  /// Array deque iterator class.
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  template<typename T>
+  class ArrayDequeIterator : public Iterator<T> {
+  private:
+    /// <summary>
+    /// Deque reference.
+    /// </summary>
+    const ArrayDeque<T>& deque;
+    /// <summary>
+    /// Current index.
+    /// </summary>
+    Index index;
+  public:
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    /// <param name="deque">Deque reference.</param>
+    explicit ArrayDequeIterator(const ArrayDeque<T>& deque) :
+      deque(deque), index(0) {}
+  public:
+    /// <summary>
+    /// Determines whether or not there are more elements to iterate.
+    /// </summary>
+    /// <returns>Returns true when there are more elements, false otherwise.</returns>
+    bool hasNext() const override {
+      return this->index < this->deque.getLength();
+    }
+    /// <summary>
+    /// Get the next element.
+    /// </summary>
+    /// <returns>Returns the next element.</returns>
+    /// <exception cref="SPL::Exceptions::InvalidOperation">Throws when there are no more elements.</exception>
+    const T& next() override {
+      if (!this->hasNext()) {
+        throw Exceptions::InvalidOperation();
+      }
+      return this->deque[this->index++];
+    }
+  };
+  /// <summary>
+  /// Non-virtual ring iterator class for range-based loops and the standard algorithms.
+  /// It walks the elements of a circular buffer from the head and wraps around the buffer end.
+  /// </summary>
+  /// <typeparam name="E">Element type.</typeparam>
+  template<typename E>
+  class RingIterator final {
+  public:
+    /// <summary>
+    /// Iterator category (for the standard algorithms).
+    /// </summary>
+    using iterator_category = std::forward_iterator_tag;
+    /// <summary>
+    /// Iterator value type.
+    /// </summary>
+    using value_type = Metadata::ConstantType<E>;
+    /// <summary>
+    /// Iterator difference type.
+    /// </summary>
+    using difference_type = std::ptrdiff_t;
+    /// <summary>
+    /// Iterator pointer type.
+    /// </summary>
+    using pointer = E*;
+    /// <summary>
+    /// Iterator reference type.
+    /// </summary>
+    using reference = E&;
+  private:
+    /// <summary>
+    /// Circular buffer.
+    /// </summary>
+    E* elements;
+    /// <summary>
+    /// Buffer mask (capacity minus one).
+    /// </summary>
+    Size mask;
+    /// <summary>
+    /// Current position (not wrapped).
+    /// </summary>
+    Index position;
+  public:
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    RingIterator() :
+      elements(nullptr), mask(0), position(0) {}
+    /// <summary>
+    /// Initialized constructor.
+    /// </summary>
+    /// <param name="elements">Circular buffer.</param>
+    /// <param name="mask">Buffer mask.</param>
+    /// <param name="position">Current position.</param>
+    RingIterator(E* const elements, const Size mask, const Index position) :
+      elements(elements), mask(mask), position(position) {}
+  public:
+    /// <summary>
+    /// Get the current element.
+    /// </summary>
+    /// <returns>Returns the current element.</returns>
+    E& operator *() const {
+      return this->elements[this->position & this->mask];
+    }
+    /// <summary>
+    /// Get the current element.
+    /// </summary>
+    /// <returns>Returns a pointer to the current element.</returns>
+    E* operator ->() const {
+      return &this->elements[this->position & this->mask];
+    }
+    /// <summary>
+    /// Move to the next element.
+    /// </summary>
+    /// <returns>Returns the iterator itself.</returns>
+    RingIterator& operator ++() {
+      this->position++;
+      return *this;
+    }
+    /// <summary>
+    /// Move to the next element.
+    /// </summary>
+    /// <returns>Returns a copy of the iterator before moving.</returns>
+    RingIterator operator ++(int) {
+      auto previous = *this;
+      this->position++;
+      return previous;
+    }
+    /// <summary>
+    /// Check whether or not both iterators are at the same element.
+    /// </summary>
+    /// <param name="other">Other iterator.</param>
+    /// <returns>Returns true when both are at the same element, false otherwise.</returns>
+    bool operator == (const RingIterator& other) const {
+      return this->position == other.position;
+    }
+    /// <summary>
+    /// Check whether or not the iterators are at different elements.
+    /// </summary>
+    /// <param name="other">Other iterator.</param>
+    /// <returns>Returns true when they're at different elements, false otherwise.</returns>
+    bool operator != (const RingIterator& other) const {
+      return this->position != other.position;
+    }
+  };
+  /// <summary>
+  /// Array deque class.
+  /// Double-ended queue backed by a power of two circular buffer, elements are added and removed at both ends in
+  /// O(1) and the buffer is unwrapped with one or two block moves when the capacity changes.
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  template<typename T>
+  class ArrayDeque final : public Iterable<T> {
+  private:
+    /// <summary>
+    /// Non-constant element type.
+    /// </summary>
+    using ElementType = Metadata::ConstantType<T>;
+    /// <summary>
+    /// Determines whether or not the elements can be moved as memory blocks.
+    /// </summary>
+    constexpr static bool Relocatable = Metadata::IsTriviallyRelocatable<ElementType>;
+    /// <summary>
+    /// Buffer elements.
+    /// </summary>
+    ElementType* elements;
+    /// <summary>
+    /// Total number of elements (zero or a power of two).
+    /// </summary>
+    Size capacity;
+    /// <summary>
+    /// Buffer position of the first element.
+    /// </summary>
+    Size head;
+    /// <summary>
+    /// Current number of elements.
+    /// </summary>
+    Size length;
+  private:
+    /// <summary>
+    /// Exchange all properties from the given objects.
+    /// </summary>
+    /// <param name="source">Source object.</param>
+    /// <param name="target">Target object.</param>
+    friend void Swap(ArrayDeque& source, ArrayDeque& target) noexcept {
+      using SPL::Swap;
+      Swap(source.elements, target.elements);
+      Swap(source.capacity, target.capacity);
+      Swap(source.head, target.head);
+      Swap(source.length, target.length);
+    }
+    /// <summary>
+    /// Move all the source elements into the target memory and destroy them.
+    /// </summary>
+    /// <param name="source">Source elements.</param>
+    /// <param name="target">Target memory.</param>
+    /// <param name="length">Number of elements.</param>
+    static void Relocate(ElementType source[], ElementType target[], const Size length) {
+      if constexpr (Relocatable) {
+        MemoryCopy(source, target, length);
+      }
+      else {
+        for (Size offset = 0; offset < length; ++offset) {
+          Construct(&target[offset], Move(source[offset]));
+        }
+        Destroy(source, length);
+      }
+    }
+    /// <summary>
+    /// Get the buffer position of the element that corresponds to the given index.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <returns>Returns the buffer position.</returns>
+    Size locate(const Index index) const {
+      return (this->head + index) & (this->capacity - 1);
+    }
+    /// <summary>
+    /// Get the number of elements from the head to the end of the buffer.
+    /// </summary>
+    /// <returns>Returns the number of elements in the first block.</returns>
+    Size getFirstBlock() const {
+      return Math::Min(this->length, this->capacity - this->head);
+    }
+    /// <summary>
+    /// Move all the elements into a new buffer with the given capacity (unwrapping them).
+    /// </summary>
+    /// <param name="capacity">New capacity.</param>
+    void resize(const Size capacity) {
+      auto* elements = Allocate<ElementType>(capacity);
+      if (this->elements != nullptr) {
+        const auto first = this->getFirstBlock();
+        Relocate(&this->elements[this->head], elements, first);
+        Relocate(this->elements, &elements[first], this->length - first);
+        Deallocate(this->elements);
+      }
+      this->elements = elements;
+      this->capacity = capacity;
+      this->head = 0;
+    }
+    /// <summary>
+    /// Enlarge the current capacity when the deque is full.
+    /// </summary>
+    void enlarge() {
+      if (this->length == this->capacity) {
+        this->resize(Math::Max<Size>(this->capacity << 1, 4));
+      }
+    }
+    /// <summary>
+    /// Shrink the current capacity when the deque length is 1/4 of it.
+    /// </summary>
+    void shrink() {
+      if (this->capacity > 4 && this->length == this->capacity >> 2) {
+        this->resize(this->capacity >> 1);
+      }
+    }
+  public:
+    /// <summary>
+    /// Initialized constructor for capacity.
+    /// </summary>
+    /// <param name="capacity">Initial capacity.</param>
+    explicit ArrayDeque(const Size capacity) : ArrayDeque() {
+      this->resize(NP2(Math::Max<Size>(capacity, 4)));
+    }
+    /// <summary>
+    /// Initialized constructor for elements.
+    /// </summary>
+    /// <param name="elements">Initial elements.</param>
+    template<Size L>
+    ArrayDeque(const ElementType(&elements)[L]) : ArrayDeque(L) {
+      for (const auto& element : elements) {
+        this->pushBack(element);
+      }
+    }
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    ArrayDeque() :
+      elements(nullptr), capacity(0), head(0), length(0) {}
+    /// <summary>
+    /// Copy constructor.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    ArrayDeque(const ArrayDeque& other) : ArrayDeque() {
+      if (other.length > 0) {
+        this->resize(other.capacity);
+        for (Index index = 0; index < other.length; ++index) {
+          Construct(&this->elements[index], other.elements[other.locate(index)]);
+          this->length++;
+        }
+      }
+    }
+    /// <summary>
+    /// Move constructor.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    ArrayDeque(ArrayDeque&& other) noexcept : ArrayDeque() {
+      Swap(*this, other);
+    }
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    ~ArrayDeque() {
+      this->clear();
+      if (this->elements != nullptr) {
+        Deallocate(this->elements);
+      }
+    }
+  public:
+    /// <summary>
+    /// Get the capacity of the deque.
+    /// </summary>
+    /// <returns>Returns the deque capacity.</returns>
+    Size getCapacity() const {
+      return this->capacity;
+    }
+    /// <summary>
+    /// Get the number of elements in the deque.
+    /// </summary>
+    /// <returns>Returns the deque length.</returns>
+    Size getLength() const {
+      return this->length;
+    }
+    /// <summary>
+    /// Determines whether or not the deque is empty.
+    /// </summary>
+    /// <returns>Returns true when it's empty, false otherwise.</returns>
+    bool isEmpty() const {
+      return this->length == 0;
+    }
+    /// <summary>
+    /// Get a new deque iterator.
+    /// </summary>
+    /// <returns>Returns the new iterator.</returns>
+    UniqueIterator<T> getIterator() const override {
+      auto* iterator = new ArrayDequeIterator<T>(*this);
+      return UniqueIterator<T>(iterator);
+    }
+    /// <summary>
+    /// Get an iterator at the front element for range-based loops.
+    /// The iterator is invalidated by any change in the deque.
+    /// </summary>
+    /// <returns>Returns the ring iterator.</returns>
+    RingIterator<const T> begin() const {
+      return RingIterator<const T>(this->elements, this->capacity - 1, this->head);
+    }
+    /// <summary>
+    /// Get an iterator past the back element for range-based loops.
+    /// </summary>
+    /// <returns>Returns the ring iterator.</returns>
+    RingIterator<const T> end() const {
+      return RingIterator<const T>(this->elements, this->capacity - 1, this->head + this->length);
+    }
+    /// <summary>
+    /// Get an iterator at the front element for range-based loops.
+    /// The iterator is invalidated by any change in the deque.
+    /// </summary>
+    /// <returns>Returns the ring iterator.</returns>
+    RingIterator<T> begin() {
+      return RingIterator<T>(this->elements, this->capacity - 1, this->head);
+    }
+    /// <summary>
+    /// Get an iterator past the back element for range-based loops.
+    /// </summary>
+    /// <returns>Returns the ring iterator.</returns>
+    RingIterator<T> end() {
+      return RingIterator<T>(this->elements, this->capacity - 1, this->head + this->length);
+    }
+    /// <summary>
+    /// Construct a new element at the front of the deque forwarding the specified arguments.
+    /// When the deque is at its capacity, the current capacity will double.
+    /// </summary>
+    /// <typeparam name="...A">Argument types.</typeparam>
+    /// <param name="...arguments">Constructor arguments.</param>
+    /// <returns>Returns the new element.</returns>
+    template<typename ...A>
+    T& emplaceFront(A&&... arguments) {
+      if (this->length == this->capacity) {
+        // Build the element before enlarging, the arguments may refer to the current elements.
+        ElementType element(Forward<A>(arguments)...);
+        this->enlarge();
+        return this->emplaceFront(Move(element));
+      }
+      const auto position = (this->head - 1) & (this->capacity - 1);
+      Construct(&this->elements[position], Forward<A>(arguments)...);
+      this->head = position;
+      this->length++;
+      return this->elements[position];
+    }
+    /// <summary>
+    /// Construct a new element at the back of the deque forwarding the specified arguments.
+    /// When the deque is at its capacity, the current capacity will double.
+    /// </summary>
+    /// <typeparam name="...A">Argument types.</typeparam>
+    /// <param name="...arguments">Constructor arguments.</param>
+    /// <returns>Returns the new element.</returns>
+    template<typename ...A>
+    T& emplaceBack(A&&... arguments) {
+      if (this->length == this->capacity) {
+        // Build the element before enlarging, the arguments may refer to the current elements.
+        ElementType element(Forward<A>(arguments)...);
+        this->enlarge();
+        return this->emplaceBack(Move(element));
+      }
+      const auto position = this->locate(this->length);
+      Construct(&this->elements[position], Forward<A>(arguments)...);
+      this->length++;
+      return this->elements[position];
+    }
+    /// <summary>
+    /// Add the specified element at the front of the deque by using move semantics.
+    /// </summary>
+    /// <param name="element">New element.</param>
+    /// <returns>Returns the current length of the deque.</returns>
+    Size pushFront(ElementType&& element) {
+      this->emplaceFront(Move(element));
+      return this->length;
+    }
+    /// <summary>
+    /// Add a copy of the specified element at the front of the deque.
+    /// </summary>
+    /// <param name="element">New element.</param>
+    /// <returns>Returns the current length of the deque.</returns>
+    Size pushFront(const ElementType& element) {
+      this->emplaceFront(element);
+      return this->length;
+    }
+    /// <summary>
+    /// Add the specified element at the back of the deque by using move semantics.
+    /// </summary>
+    /// <param name="element">New element.</param>
+    /// <returns>Returns the current length of the deque.</returns>
+    Size pushBack(ElementType&& element) {
+      this->emplaceBack(Move(element));
+      return this->length;
+    }
+    /// <summary>
+    /// Add a copy of the specified element at the back of the deque.
+    /// </summary>
+    /// <param name="element">New element.</param>
+    /// <returns>Returns the current length of the deque.</returns>
+    Size pushBack(const ElementType& element) {
+      this->emplaceBack(element);
+      return this->length;
+    }
+    /// <summary>
+    /// Remove the element at the front of the deque and move it into the given output.
+    /// When the deque length is 1/4 of the current capacity, the current capacity will be reduced by half.
+    /// </summary>
+    /// <param name="value">Output value.</param>
+    /// <returns>Returns true when the element was removed, false otherwise.</returns>
+    bool popFront(ElementType& value) {
+      if (this->length == 0) {
+        return false;
+      }
+      auto* element = &this->elements[this->head];
+      value = Move(*element);
+      Destroy(element, 1);
+      this->head = (this->head + 1) & (this->capacity - 1);
+      this->length--;
+      this->shrink();
+      return true;
+    }
+    /// <summary>
+    /// Remove the element at the back of the deque and move it into the given output.
+    /// When the deque length is 1/4 of the current capacity, the current capacity will be reduced by half.
+    /// </summary>
+    /// <param name="value">Output value.</param>
+    /// <returns>Returns true when the element was removed, false otherwise.</returns>
+    bool popBack(ElementType& value) {
+      if (this->length == 0) {
+        return false;
+      }
+      auto* element = &this->elements[this->locate(this->length - 1)];
+      value = Move(*element);
+      Destroy(element, 1);
+      this->length--;
+      this->shrink();
+      return true;
+    }
+    /// <summary>
+    /// Remove the element at the front of the deque.
+    /// When the deque length is 1/4 of the current capacity, the current capacity will be reduced by half.
+    /// </summary>
+    /// <returns>Returns the removed element.</returns>
+    /// <exception cref="SPL::Exceptions::InvalidOperation">Throws when the deque is empty.</exception>
+    T popFront() {
+      if (this->length == 0) {
+        throw Exceptions::InvalidOperation();
+      }
+      auto* element = &this->elements[this->head];
+      T value(Move(*element));
+      Destroy(element, 1);
+      this->head = (this->head + 1) & (this->capacity - 1);
+      this->length--;
+      this->shrink();
+      return value;
+    }
+    /// <summary>
+    /// Remove the element at the back of the deque.
+    /// When the deque length is 1/4 of the current capacity, the current capacity will be reduced by half.
+    /// </summary>
+    /// <returns>Returns the removed element.</returns>
+    /// <exception cref="SPL::Exceptions::InvalidOperation">Throws when the deque is empty.</exception>
+    T popBack() {
+      if (this->length == 0) {
+        throw Exceptions::InvalidOperation();
+      }
+      auto* element = &this->elements[this->locate(this->length - 1)];
+      T value(Move(*element));
+      Destroy(element, 1);
+      this->length--;
+      this->shrink();
+      return value;
+    }
+    /// <summary>
+    /// Get the element at the front of the deque.
+    /// </summary>
+    /// <returns>Returns the front element.</returns>
+    /// <exception cref="SPL::Exceptions::InvalidOperation">Throws when the deque is empty.</exception>
+    T& getFront() const {
+      if (this->length == 0) {
+        throw Exceptions::InvalidOperation();
+      }
+      return this->elements[this->head];
+    }
+    /// <summary>
+    /// Get the element at the back of the deque.
+    /// </summary>
+    /// <returns>Returns the back element.</returns>
+    /// <exception cref="SPL::Exceptions::InvalidOperation">Throws when the deque is empty.</exception>
+    T& getBack() const {
+      if (this->length == 0) {
+        throw Exceptions::InvalidOperation();
+      }
+      return this->elements[this->locate(this->length - 1)];
+    }
+    /// <summary>
+    /// Get the first index occurrence of the specified element in the deque.
+    /// </summary>
+    /// <param name="search">Search element.</param>
+    /// <returns>Returns the corresponding index or -1 when the element wasn't found.</returns>
+    Index indexOf(const T& search) const {
+      const auto first = this->getFirstBlock();
+      const auto index = Find<ElementType>(&this->elements[this->head], first, search);
+      if (index != -1) {
+        return index;
+      }
+      const auto other = Find<ElementType>(this->elements, this->length - first, search);
+      return other != -1 ? first + other : -1;
+    }
+    /// <summary>
+    /// Determines whether or not the deque contains the specified element.
+    /// </summary>
+    /// <param name="search">Search element.</param>
+    /// <returns>Returns true when the element was found, false otherwise.</returns>
+    bool contains(const T& search) const {
+      return this->indexOf(search) != -1;
+    }
+    /// <summary>
+    /// Clear the deque (keeping its capacity).
+    /// </summary>
+    void clear() {
+      const auto first = this->getFirstBlock();
+      Destroy(&this->elements[this->head], first);
+      Destroy(this->elements, this->length - first);
+      this->head = 0;
+      this->length = 0;
+    }
+  public:
+    /// <summary>
+    /// Get the element that corresponds to the specified index.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <returns>Returns the corresponding element.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    const T& operator [](const Index index) const {
+      if (index >= this->length) {
+        throw Exceptions::IndexOutOfBounds(index);
+      }
+      return this->elements[this->locate(index)];
+    }
+    /// <summary>
+    /// Get the element that corresponds to the specified index.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <returns>Returns the corresponding element.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    T& operator [](const Index index) {
+      if (index >= this->length) {
+        throw Exceptions::IndexOutOfBounds(index);
+      }
+      return this->elements[this->locate(index)];
+    }
+    /// <summary>
+    /// Assign all properties from the given deque.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    /// <returns>Returns the instance itself.</returns>
+    ArrayDeque& operator = (ArrayDeque other) noexcept {
+      Swap(*this, other);
+      return *this;
+    }
+  };
+}
@@ -10,13 +10,14 @@ namespace SPL::Arrays {
   /// Array iterator class.
   /// </summary>
   /// <typeparam name="T">Element type.</typeparam>
-  template<typename T>
+  /// <typeparam name="N">Inline capacity.</typeparam>
+  template<typename T, Size N>
   class ArrayIterator : public Iterator<T> {
   private:
     /// <summary>
     /// Basic array type.
     /// </summary>
-    using BasicType = BasicArray<T>;
+    using BasicType = BasicArray<T, N>;
     /// <summary>
     /// Basic array reference.
     /// </summary>
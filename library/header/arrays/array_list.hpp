@@ -6,19 +6,22 @@
 #include "./types.hpp"
 #include "./array_iterator.hpp"
 #include "./basic_array.hpp"
+#include "./array_span.hpp"
 
 namespace SPL::Arrays {
   /// <summary>
   /// Array list class.
+  /// When the inline capacity is greater than zero, up to N elements are stored without any allocation.
   /// </summary>
   /// <typeparam name="T">Element type.</typeparam>
-  template<typename T>
+  /// <typeparam name="N">Inline capacity.</typeparam>
+  template<typename T, Size N = 0>
   class ArrayList final : public List<T>, public Iterable<T> {
   private:
     /// <summary>
     /// Basic array type.
     /// </summary>
-    using BasicType = BasicArray<T>;
+    using BasicType = BasicArray<T, N>;
     /// <summary>
     /// Non-constant element type.
     /// </summary>
@@ -38,6 +41,14 @@ namespace SPL::Arrays {
       }
     }
     /// <summary>
+    /// Determines whether or not the given element is stored in the array.
+    /// </summary>
+    /// <param name="element">Element pointer.</param>
+    /// <returns>Returns true when the element is stored in the array, false otherwise.</returns>
+    bool owns(const ElementType* const element) const {
+      return element >= this->array.begin() && element < this->array.end();
+    }
+    /// <summary>
     /// Shrink the current capacity.
     /// </summary>
     void shrink() {
@@ -46,6 +57,15 @@ namespace SPL::Arrays {
         this->array.shrink(capacity >> 1);
       }
     }
+    /// <summary>
+    /// Enlarge the current capacity (when necessary) to store the given number of elements.
+    /// </summary>
+    /// <param name="length">Number of elements.</param>
+    void reserve(const Size length) {
+      if (length > this->array.getCapacity()) {
+        this->array.enlarge(NP2(length));
+      }
+    }
   private:
     /// <summary>
     /// Internal constructor.
@@ -61,13 +81,13 @@ namespace SPL::Arrays {
     /// </summary>
     /// <param name="capacity">Initial capacity.</param>
     explicit ArrayList(const Size capacity) :
-      array(NP2(capacity)) {}
+      array(capacity > N ? NP2(capacity) : N) {}
     /// <summary>
     /// Initialized constructor for elements.
     /// </summary>
     /// <param name="elements">Initial elements.</param>
-    template<Size N>
-    ArrayList(const ElementType(&elements)[N]) : ArrayList(N) {
+    template<Size L>
+    ArrayList(const ElementType(&elements)[L]) : ArrayList(L) {
       for (const auto& element : elements) {
         this->add(element);
       }
@@ -116,10 +136,40 @@ namespace SPL::Arrays {
     /// </summary>
     /// <returns>Returns the new iterator.</returns>
     UniqueIterator<T> getIterator() const override {
-      auto* iterator = new ArrayIterator<T>(this->array);
+      auto* iterator = new ArrayIterator<T, N>(this->array);
       return UniqueIterator<T>(iterator);
     }
     /// <summary>
+    /// Get a pointer to the first element for range-based loops.
+    /// The pointer is invalidated by any change in the array length.
+    /// </summary>
+    /// <returns>Returns the pointer to the first element.</returns>
+    const T* begin() const {
+      return this->array.begin();
+    }
+    /// <summary>
+    /// Get a pointer past the last element for range-based loops.
+    /// </summary>
+    /// <returns>Returns the pointer past the last element.</returns>
+    const T* end() const {
+      return this->array.end();
+    }
+    /// <summary>
+    /// Get a pointer to the first element for range-based loops.
+    /// The pointer is invalidated by any change in the array length.
+    /// </summary>
+    /// <returns>Returns the pointer to the first element.</returns>
+    T* begin() {
+      return this->array.begin();
+    }
+    /// <summary>
+    /// Get a pointer past the last element for range-based loops.
+    /// </summary>
+    /// <returns>Returns the pointer past the last element.</returns>
+    T* end() {
+      return this->array.end();
+    }
+    /// <summary>
     /// Add the specified element at the end of the array by using move semantics.
     /// When the array is at its capacity, the current capacity will double.
     /// </summary>
@@ -137,8 +187,13 @@ namespace SPL::Arrays {
     /// <param name="element">New element.</param>
     /// <returns>Returns the current length of the array.</returns>
     Size add(const ElementType& element) override {
-      ElementType copy(element);
-      return this->add(Move(copy));
+      if (this->owns(&element)) {
+        ElementType copy(element);
+        return this->add(Move(copy));
+      }
+      this->enlarge();
+      this->array.add(this->array.getLength(), element);
+      return this->array.getLength();
     }
     /// <summary>
     /// Add the specified element at the specified index by using move semantics.
@@ -165,8 +220,137 @@ namespace SPL::Arrays {
     /// <returns>Returns the current length of the array.</returns>
     /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
     Size add(const Index index, const ElementType& element) override {
-      ElementType copy(element);
-      return this->add(index, Move(copy));
+      if (index > this->array.getLength()) {
+        throw Exceptions::IndexOutOfBounds(index);
+      }
+      if (this->owns(&element)) {
+        ElementType copy(element);
+        return this->add(index, Move(copy));
+      }
+      this->enlarge();
+      this->array.add(index, element);
+      return this->array.getLength();
+    }
+    /// <summary>
+    /// Construct a new element at the end of the array forwarding the specified arguments.
+    /// When the array is at its capacity, the current capacity will double.
+    /// </summary>
+    /// <typeparam name="...A">Argument types.</typeparam>
+    /// <param name="...arguments">Constructor arguments.</param>
+    /// <returns>Returns the new element.</returns>
+    template<typename ...A>
+    T& emplace(A&&... arguments) {
+      return this->emplaceAt(this->array.getLength(), Forward<A>(arguments)...);
+    }
+    /// <summary>
+    /// Construct a new element at the specified index forwarding the specified arguments.
+    /// When the array is at its capacity, the current capacity will double.
+    /// </summary>
+    /// <typeparam name="...A">Argument types.</typeparam>
+    /// <param name="index">Zero-based index.</param>
+    /// <param name="...arguments">Constructor arguments.</param>
+    /// <returns>Returns the new element.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    template<typename ...A>
+    T& emplaceAt(const Index index, A&&... arguments) {
+      if (index > this->array.getLength()) {
+        throw Exceptions::IndexOutOfBounds(index);
+      }
+      if (this->array.getLength() == this->array.getCapacity()) {
+        // Build the element before enlarging, the arguments may refer to the current elements.
+        ElementType element(Forward<A>(arguments)...);
+        this->enlarge();
+        return *this->array.emplace(index, Move(element));
+      }
+      return *this->array.emplace(index, Forward<A>(arguments)...);
+    }
+    /// <summary>
+    /// Add a copy of all the given elements at the specified index.
+    /// The current capacity is enlarged only once and the tail elements are moved only once.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <param name="elements">New elements.</param>
+    /// <param name="length">Number of elements.</param>
+    /// <returns>Returns the current length of the array.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    Size addAll(const Index index, const T elements[], const Size length) {
+      if (index > this->array.getLength()) {
+        throw Exceptions::IndexOutOfBounds(index);
+      }
+      if (length > 0 && this->owns(elements)) {
+        // Copy the elements first, enlarging and shifting the tail would overwrite them.
+        ArrayList copy(length);
+        copy.array.insert(0, elements, length);
+        return this->addAll(index, copy.array, length);
+      }
+      this->reserve(this->array.getLength() + length);
+      this->array.insert(index, elements, length);
+      return this->array.getLength();
+    }
+    /// <summary>
+    /// Add a copy of all the given elements at the specified index.
+    /// The current capacity is enlarged only once and the tail elements are moved only once.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <param name="elements">New elements.</param>
+    /// <returns>Returns the current length of the array.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    template<Size L>
+    Size addAll(const Index index, const ElementType(&elements)[L]) {
+      return this->addAll(index, elements, L);
+    }
+    /// <summary>
+    /// Add a copy of all the elements from the given span at the specified index.
+    /// The current capacity is enlarged only once and the tail elements are moved only once.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <param name="span">Span of the new elements.</param>
+    /// <returns>Returns the current length of the array.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    Size addAll(const Index index, const ConstArraySpan<ElementType>& span) {
+      return this->addAll(index, span.getData(), span.getLength());
+    }
+    /// <summary>
+    /// Add a copy of all the given elements at the end of the array.
+    /// The current capacity is enlarged only once.
+    /// </summary>
+    /// <param name="elements">New elements.</param>
+    /// <param name="length">Number of elements.</param>
+    /// <returns>Returns the current length of the array.</returns>
+    Size append(const T elements[], const Size length) {
+      return this->addAll(this->array.getLength(), elements, length);
+    }
+    /// <summary>
+    /// Add a copy of all the given elements at the end of the array.
+    /// The current capacity is enlarged only once.
+    /// </summary>
+    /// <param name="elements">New elements.</param>
+    /// <returns>Returns the current length of the array.</returns>
+    template<Size L>
+    Size append(const ElementType(&elements)[L]) {
+      return this->append(elements, L);
+    }
+    /// <summary>
+    /// Add a copy of all the elements from the given span at the end of the array.
+    /// The current capacity is enlarged only once.
+    /// </summary>
+    /// <param name="span">Span of the new elements.</param>
+    /// <returns>Returns the current length of the array.</returns>
+    Size append(const ConstArraySpan<ElementType>& span) {
+      return this->addAll(this->array.getLength(), span);
+    }
+    /// <summary>
+    /// Add a copy of all the elements from the given array at the end of the array.
+    /// The current capacity is enlarged only once.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    /// <returns>Returns the current length of the array.</returns>
+    Size append(const ArrayList& other) {
+      if (&other == this) {
+        const ArrayList copy(other);
+        return this->append(copy);
+      }
+      return this->append(other.array, other.array.getLength());
     }
     /// <summary>
     /// Replace the element at the specified index with the given one by using move semantics.
@@ -206,6 +390,17 @@ namespace SPL::Arrays {
       return UniqueList<T>(new ArrayList(array));
     }
     /// <summary>
+    /// Merge the array and the given span into a new array.
+    /// </summary>
+    /// <param name="span">Span of elements.</param>
+    /// <returns>Returns the new array.</returns>
+    UniqueList<T> concat(const ConstArraySpan<ElementType>& span) const {
+      auto* list = new ArrayList(this->array.getLength() + span.getLength());
+      list->array.insert(0, this->array, this->array.getLength());
+      list->array.insert(this->array.getLength(), span.getData(), span.getLength());
+      return UniqueList<T>(list);
+    }
+    /// <summary>
     /// Get the element that corresponds to the specified index.
     /// </summary>
     /// <param name="index">Zero-based index.</param>
@@ -259,6 +454,46 @@ namespace SPL::Arrays {
       return this->array.indexOf(search) != -1;
     }
     /// <summary>
+    /// Count all the occurrences of the specified element in the array.
+    /// </summary>
+    /// <param name="search">Search element.</param>
+    /// <returns>Returns the number of occurrences.</returns>
+    Size count(const T& search) const {
+      return this->array.count(search);
+    }
+    /// <summary>
+    /// Get the index of any occurrence of the specified element in the sorted array.
+    /// </summary>
+    /// <param name="search">Search element.</param>
+    /// <returns>Returns the corresponding index or -1 when the element wasn't found.</returns>
+    Index binarySearch(const T& search) const {
+      return this->array.binarySearch(search);
+    }
+    /// <summary>
+    /// Get the index of the first element in the sorted array that isn't less than the specified element.
+    /// </summary>
+    /// <param name="search">Search element.</param>
+    /// <returns>Returns the corresponding index or the array length when all the elements are less.</returns>
+    Index lowerBound(const T& search) const {
+      return this->array.lowerBound(search);
+    }
+    /// <summary>
+    /// Get the index of the first element in the sorted array that is greater than the specified element.
+    /// </summary>
+    /// <param name="search">Search element.</param>
+    /// <returns>Returns the corresponding index or the array length when no element is greater.</returns>
+    Index upperBound(const T& search) const {
+      return this->array.upperBound(search);
+    }
+    /// <summary>
+    /// Get the range of all the occurrences of the specified element in the sorted array.
+    /// </summary>
+    /// <param name="search">Search element.</param>
+    /// <returns>Returns a pair with the first index (key) and the index after the last occurrence (value).</returns>
+    Pair<Index, Index> equalRange(const T& search) const {
+      return this->array.equalRange(search);
+    }
+    /// <summary>
     /// Remove the element that corresponds to the specified index from the array.
     /// When the array length is 1/4 of the current capacity, the current capacity will be reduced by half.
     /// </summary>
@@ -266,11 +501,12 @@ namespace SPL::Arrays {
     /// <returns>Returns the removed element.</returns>
     /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
     T remove(const Index index) override {
-      auto* current = this->array.remove(index);
+      auto* current = this->array.get(index);
       if (current == nullptr) {
         throw Exceptions::IndexOutOfBounds(index);
       }
       T element(Move(*current));
+      this->array.remove(index);
       this->shrink();
       return element;
     }
@@ -282,11 +518,10 @@ namespace SPL::Arrays {
     /// <param name="element">Output element.</param>
     /// <returns>Returns true when the element was removed, false otherwise.</returns>
     bool remove(const Index index, ElementType& element) override {
-      auto* current = this->array.remove(index);
+      auto* current = this->array.get(index);
       if (current != nullptr) {
-        using SPL::Swap;
-        element = ElementType();
-        Swap(element, *current);
+        element = Move(*current);
+        this->array.remove(index);
         this->shrink();
         return true;
       }
@@ -308,6 +543,25 @@ namespace SPL::Arrays {
       return false;
     }
     /// <summary>
+    /// Remove all the elements in the specified range from the array.
+    /// The tail elements are moved only once and the current capacity is reduced to fit the new length.
+    /// </summary>
+    /// <param name="from">From the zero-based index.</param>
+    /// <param name="to">To the zero-based index.</param>
+    /// <returns>Returns the current length of the array.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    Size removeRange(const Index from, const Index to = -1) {
+      if (from > to || from >= this->array.getLength()) {
+        throw Exceptions::IndexOutOfBounds(from);
+      }
+      this->array.removeRange(from, to);
+      const auto length = this->array.getLength();
+      if (length <= this->array.getCapacity() >> 2) {
+        this->array.shrink(NP2(length) << 1);
+      }
+      return length;
+    }
+    /// <summary>
     /// Slice a portion of the array based on the given range and generate a new one.
     /// </summary>
     /// <param name="from">From the zero-based index.</param>
@@ -319,12 +573,67 @@ namespace SPL::Arrays {
       return UniqueList<T>(new ArrayList(array));
     }
     /// <summary>
+    /// Get a view of a portion of the array based on the given range (without copying).
+    /// The view is invalidated by any change in the array capacity.
+    /// </summary>
+    /// <param name="from">From the zero-based index.</param>
+    /// <param name="to">To the zero-based index.</param>
+    /// <returns>Returns the span of the corresponding elements.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    ArraySpan<T> view(const Index from = 0, const Index to = -1) {
+      return this->array.view(from, to);
+    }
+    /// <summary>
+    /// Get a read-only view of a portion of the array based on the given range (without copying).
+    /// The view is invalidated by any change in the array capacity.
+    /// </summary>
+    /// <param name="from">From the zero-based index.</param>
+    /// <param name="to">To the zero-based index.</param>
+    /// <returns>Returns the span of the corresponding elements.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    ConstArraySpan<ElementType> view(const Index from = 0, const Index to = -1) const {
+      return this->array.view(from, to);
+    }
+    /// <summary>
     /// Sort the array.
     /// </summary>
     void sort() override {
       this->array.sort();
     }
     /// <summary>
+    /// Sort the array using the given comparator.
+    /// The comparator must return a negative number, zero or a positive number like the default compare function.
+    /// </summary>
+    /// <typeparam name="C">Comparator type.</typeparam>
+    /// <param name="compare">Comparator instance.</param>
+    template<typename C>
+    void sort(const C& compare) {
+      this->array.sort(compare);
+    }
+    /// <summary>
+    /// Sort the array keeping the order of equal elements.
+    /// </summary>
+    void stableSort() {
+      this->array.stableSort();
+    }
+    /// <summary>
+    /// Sort the array using the given comparator and keeping the order of equal elements.
+    /// </summary>
+    /// <typeparam name="C">Comparator type.</typeparam>
+    /// <param name="compare">Comparator instance.</param>
+    template<typename C>
+    void stableSort(const C& compare) {
+      this->array.stableSort(compare);
+    }
+    /// <summary>
+    /// Sort the array using the given number of worker threads.
+    /// Arrays smaller than the parallel threshold are sorted sequentially.
+    /// </summary>
+    /// <param name="threads">Number of worker threads (zero for the number of hardware threads).</param>
+    void parallelSort(const Size threads = 0) {
+      this->array.parallelSort(threads);
+    }
+    /// <summary>
     /// Reverse the array (in-place).
     /// </summary>
     void reverse() override {
@@ -0,0 +1,269 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#include "./types.hpp"
+
+namespace SPL::Arrays {
+  /// <summary>
+  /// Array span iterator class.
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  template<typename T>
+  class ArraySpanIterator : public Iterator<T> {
+  private:
+    /// <summary>
+    /// Current element.
+    /// </summary>
+    const T* current;
+    /// <summary>
+    /// Last element (exclusive).
+    /// </summary>
+    const T* last;
+  public:
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    /// <param name="elements">Span elements.</param>
+    /// <param name="length">Number of elements.</param>
+    ArraySpanIterator(const T elements[], const Size length) :
+      current(elements), last(elements + length) {}
+  public:
+    /// <summary>
+    /// Determines whether or not there are more elements to iterate.
+    /// </summary>
+    /// <returns>Returns true when there are more elements, false otherwise.</returns>
+    bool hasNext() const override {
+      return this->current != this->last;
+    }
+    /// <summary>
+    /// Get the next element.
+    /// </summary>
+    /// <returns>Returns the next element.</returns>
+    /// <exception cref="SPL::Exceptions::InvalidOperation">Throws when there are no more elements.</exception>
+    const T& next() override {
+      if (!this->hasNext()) {
+        throw Exceptions::InvalidOperation();
+      }
+      return *this->current++;
+    }
+  };
+  /// <summary>
+  /// Array span class.
+  /// Non-owning view of contiguous elements (pointer and length), copying a span never copies its elements and the
+  /// viewed elements must outlive the span. Use a constant element type for read-only views.
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  template<typename T>
+  class ArraySpan final {
+  private:
+    /// <summary>
+    /// Non-constant element type.
+    /// </summary>
+    using ElementType = Metadata::ConstantType<T>;
+    /// <summary>
+    /// Viewed elements.
+    /// </summary>
+    T* elements;
+    /// <summary>
+    /// Number of elements.
+    /// </summary>
+    Size length;
+  public:
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    ArraySpan() :
+      elements(nullptr), length(0) {}
+    /// <summary>
+    /// Initialized constructor.
+    /// </summary>
+    /// <param name="elements">Viewed elements.</param>
+    /// <param name="length">Number of elements.</param>
+    ArraySpan(T elements[], const Size length) :
+      elements(elements), length(length) {}
+    /// <summary>
+    /// Initialized constructor.
+    /// </summary>
+    /// <param name="elements">Viewed elements.</param>
+    template<Size L>
+    ArraySpan(T(&elements)[L]) :
+      elements(elements), length(L) {}
+  public:
+    /// <summary>
+    /// Get the viewed elements.
+    /// </summary>
+    /// <returns>Returns the pointer to the first element.</returns>
+    T* getData() const {
+      return this->elements;
+    }
+    /// <summary>
+    /// Get the number of elements.
+    /// </summary>
+    /// <returns>Returns the number of elements.</returns>
+    Size getLength() const {
+      return this->length;
+    }
+    /// <summary>
+    /// Get a pointer to the first element for range-based loops.
+    /// </summary>
+    /// <returns>Returns the pointer to the first element.</returns>
+    T* begin() const {
+      return this->elements;
+    }
+    /// <summary>
+    /// Get a pointer past the last element for range-based loops.
+    /// </summary>
+    /// <returns>Returns the pointer past the last element.</returns>
+    T* end() const {
+      return this->elements + this->length;
+    }
+    /// <summary>
+    /// Determines whether or not the span is empty.
+    /// </summary>
+    /// <returns>Returns true when it's empty, false otherwise.</returns>
+    bool isEmpty() const {
+      return this->length == 0;
+    }
+    /// <summary>
+    /// Get a new span iterator.
+    /// </summary>
+    /// <returns>Returns the new iterator.</returns>
+    UniqueIterator<T> getIterator() const {
+      auto* iterator = new ArraySpanIterator<T>(this->elements, this->length);
+      return UniqueIterator<T>(iterator);
+    }
+    /// <summary>
+    /// Get a view of a portion of the span based on the given range.
+    /// </summary>
+    /// <param name="from">From the zero-based index.</param>
+    /// <param name="to">To the zero-based index.</param>
+    /// <returns>Returns the new span.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    ArraySpan view(const Index from, const Index to = -1) const {
+      if (from > to || from > this->length) {
+        throw Exceptions::IndexOutOfBounds(from);
+      }
+      return ArraySpan(this->elements + from, Math::Min(to, this->length) - from);
+    }
+    /// <summary>
+    /// Get the first index occurrence of the specified element in the span.
+    /// </summary>
+    /// <param name="search">Search element.</param>
+    /// <param name="from">From the zero-based index.</param>
+    /// <returns>Returns the corresponding index or -1 when the element wasn't found.</returns>
+    Index indexOf(const T& search, const Index from = 0) const {
+      const auto start = Math::Min(from, this->length);
+      const auto index = Find<ElementType>(this->elements + start, this->length - start, search);
+      return index != -1 ? start + index : -1;
+    }
+    /// <summary>
+    /// Get the last index occurrence of the specified element in the span.
+    /// </summary>
+    /// <param name="search">Search element.</param>
+    /// <param name="from">From the zero-based index.</param>
+    /// <returns>Returns the corresponding index or -1 when the element wasn't found.</returns>
+    Index lastIndexOf(const T& search, const Index from = -1) const {
+      return FindLast<ElementType>(this->elements, Math::Min(from, this->length), search);
+    }
+    /// <summary>
+    /// Determines whether or not the span contains the specified element.
+    /// </summary>
+    /// <param name="search">Search element.</param>
+    /// <returns>Returns true when the element was found, false otherwise.</returns>
+    bool contains(const T& search) const {
+      return this->indexOf(search) != -1;
+    }
+    /// <summary>
+    /// Count all the occurrences of the specified element in the span.
+    /// </summary>
+    /// <param name="search">Search element.</param>
+    /// <returns>Returns the number of occurrences.</returns>
+    Size count(const T& search) const {
+      return Count<ElementType>(this->elements, this->length, search);
+    }
+    /// <summary>
+    /// Get the index of any occurrence of the specified element in the sorted span.
+    /// </summary>
+    /// <param name="search">Search element.</param>
+    /// <returns>Returns the corresponding index or -1 when the element wasn't found.</returns>
+    Index binarySearch(const T& search) const {
+      return BinarySearch<ElementType>(this->elements, this->length, search);
+    }
+    /// <summary>
+    /// Get the index of the first element in the sorted span that isn't less than the specified element.
+    /// </summary>
+    /// <param name="search">Search element.</param>
+    /// <returns>Returns the corresponding index or the span length when all the elements are less.</returns>
+    Index lowerBound(const T& search) const {
+      return LowerBound<ElementType>(this->elements, this->length, search);
+    }
+    /// <summary>
+    /// Get the index of the first element in the sorted span that is greater than the specified element.
+    /// </summary>
+    /// <param name="search">Search element.</param>
+    /// <returns>Returns the corresponding index or the span length when no element is greater.</returns>
+    Index upperBound(const T& search) const {
+      return UpperBound<ElementType>(this->elements, this->length, search);
+    }
+    /// <summary>
+    /// Get the range of all the occurrences of the specified element in the sorted span.
+    /// </summary>
+    /// <param name="search">Search element.</param>
+    /// <returns>Returns a pair with the first index (key) and the index after the last occurrence (value).</returns>
+    Pair<Index, Index> equalRange(const T& search) const {
+      return Pair<Index, Index>(this->lowerBound(search), this->upperBound(search));
+    }
+    /// <summary>
+    /// Compare the elements of the span with the elements of the given span (lexicographically).
+    /// </summary>
+    /// <param name="other">Other span.</param>
+    /// <returns>
+    /// Returns -1 when the span is less than the given span.
+    /// Returns  0 when the span is equals to the given span.
+    /// Returns  1 when the span is greater than the given span.
+    /// </returns>
+    int compare(const ArraySpan<const ElementType>& other) const {
+      const auto length = Math::Min(this->length, other.getLength());
+      const auto result = length > 0 ? Compare<ElementType>(this->elements, other.getData(), length) : 0;
+      if (result != 0 || this->length == other.getLength()) {
+        return result;
+      }
+      return this->length < other.getLength() ? -1 : 1;
+    }
+  public:
+    /// <summary>
+    /// Get the element that corresponds to the specified index.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <returns>Returns the corresponding element.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    T& operator [](const Index index) const {
+      if (index >= this->length) {
+        throw Exceptions::IndexOutOfBounds(index);
+      }
+      return this->elements[index];
+    }
+    /// <summary>
+    /// Check whether or not the given spans have equal elements.
+    /// </summary>
+    /// <param name="other">Other span.</param>
+    /// <returns>Returns true when both are equals, false otherwise.</returns>
+    bool operator == (const ArraySpan<const ElementType>& other) const {
+      return this->compare(other) == 0;
+    }
+    /// <summary>
+    /// Get a read-only span of the same elements.
+    /// </summary>
+    operator ArraySpan<const ElementType>() const {
+      return ArraySpan<const ElementType>(this->elements, this->length);
+    }
+  };
+  /// <summary>
+  /// Constant array span class.
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  template<typename T>
+  using ConstArraySpan = ArraySpan<const T>;
+}
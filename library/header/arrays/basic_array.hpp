@@ -4,20 +4,41 @@
 #pragma once
 
 #include "./types.hpp"
+#include "./inline_storage.hpp"
+#include "./array_span.hpp"
 
 namespace SPL::Arrays {
   /// <summary>
   /// Basic array class.
+  /// The elements are stored in uninitialized memory and only the elements in the array length are constructed.
+  /// Up to N elements are stored inline (without allocations) and all the others spill to the heap.
   /// </summary>
   /// <typeparam name="T">Element type.</typeparam>
-  template<typename T>
-  class BasicArray final {
+  /// <typeparam name="N">Inline capacity.</typeparam>
+  template<typename T, Size N>
+  class BasicArray final : private InlineStorage<Metadata::ConstantType<T>, N> {
   private:
     /// <summary>
     /// Non-constant element type.
     /// </summary>
     using ElementType = Metadata::ConstantType<T>;
     /// <summary>
+    /// Determines whether or not the elements can be copied as memory blocks.
+    /// </summary>
+    constexpr static bool Copyable = Metadata::IsTriviallyCopyable<ElementType>;
+    /// <summary>
+    /// Determines whether or not the elements can be moved as memory blocks.
+    /// </summary>
+    constexpr static bool Relocatable = Metadata::IsTriviallyRelocatable<ElementType>;
+    /// <summary>
+    /// Determines whether or not the elements can be sorted by their radix.
+    /// </summary>
+    constexpr static bool Radix = RadixKey<ElementType>::Enabled;
+    /// <summary>
+    /// Minimum number of elements to sort by radix.
+    /// </summary>
+    constexpr static Size RadixThreshold = 512;
+    /// <summary>
     /// Total number of elements.
     /// </summary>
     Size capacity;
@@ -36,25 +57,83 @@ namespace SPL::Arrays {
     /// <param name="source">Source object.</param>
     /// <param name="target">Target object.</param>
     friend void Swap(BasicArray& source, BasicArray& target) noexcept {
-      using SPL::Swap;
-      Swap(source.capacity, target.capacity);
-      Swap(source.elements, target.elements);
-      Swap(source.length, target.length);
+      if constexpr (N == 0) {
+        using SPL::Swap;
+        Swap(source.capacity, target.capacity);
+        Swap(source.elements, target.elements);
+        Swap(source.length, target.length);
+      }
+      else {
+        BasicArray array;
+        array.take(source);
+        source.take(target);
+        target.take(array);
+      }
+    }
+    /// <summary>
+    /// Move all the source elements into the target memory and destroy them.
+    /// </summary>
+    /// <param name="source">Source elements.</param>
+    /// <param name="target">Target memory.</param>
+    /// <param name="length">Number of elements.</param>
+    static void Relocate(ElementType source[], ElementType target[], const Size length) {
+      if constexpr (Relocatable) {
+        MemoryCopy(source, target, length);
+      }
+      else {
+        for (Size offset = 0; offset < length; ++offset) {
+          Construct(&target[offset], Move(source[offset]));
+        }
+        Destroy(source, length);
+      }
+    }
+    /// <summary>
+    /// Determines whether or not the elements are stored inline.
+    /// </summary>
+    /// <returns>Returns true when the elements are inline, false otherwise.</returns>
+    bool isInline() {
+      return this->elements == this->getInline();
+    }
+    /// <summary>
+    /// Release the current memory when it was allocated in the heap.
+    /// </summary>
+    void release() {
+      if (!this->isInline()) {
+        Deallocate(this->elements);
+      }
+    }
+    /// <summary>
+    /// Take all the elements from the given array leaving it empty.
+    /// Heap elements are taken by pointer and inline elements are moved.
+    /// IMPORTANT: The current array must be empty and without heap memory.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    void take(BasicArray& other) {
+      if (other.isInline()) {
+        Relocate(other.elements, this->getInline(), other.length);
+        this->elements = this->getInline();
+      }
+      else {
+        this->elements = other.elements;
+      }
+      this->capacity = other.capacity;
+      this->length = other.length;
+      other.capacity = N;
+      other.elements = other.getInline();
+      other.length = 0;
     }
     /// <summary>
     /// Resize the current capacity based on the new one and move all elements.
+    /// When the new capacity fits in the inline capacity, all elements are moved back inline.
     /// IMPORTANT: Make sure the new capacity can store all current elements.
     /// </summary>
     /// <param name="capacity">New capacity.</param>
     void resize(const Size capacity) {
-      using SPL::Swap;
-      BasicArray array(capacity);
-      while (array.length < this->length) {
-        Swap(array.elements[array.length], this->elements[array.length]);
-        array.length++;
-      }
-      this->length = 0;
-      Swap(*this, array);
+      auto* elements = capacity > N ? Allocate<ElementType>(capacity) : this->getInline();
+      Relocate(this->elements, elements, this->length);
+      this->release();
+      this->elements = elements;
+      this->capacity = Math::Max(capacity, N);
     }
   private:
     /// <summary>
@@ -63,21 +142,33 @@ namespace SPL::Arrays {
     /// <param name="elements">Initial elements.</param>
     /// <param name="length">Initial length.</param>
     BasicArray(const T elements[], const Size length) : BasicArray(length) {
-      Copy(elements, this->elements, length);
-      this->length = length;
+      if constexpr (Copyable) {
+        MemoryCopy(elements, this->elements, length);
+        this->length = length;
+      }
+      else {
+        while (this->length < length) {
+          Construct(&this->elements[this->length], elements[this->length]);
+          this->length++;
+        }
+      }
     }
   public:
     /// <summary>
     /// Initialized constructor for capacity.
     /// </summary>
     /// <param name="capacity">Initial capacity.</param>
-    explicit BasicArray(const Size capacity) :
-      capacity(Math::Max(capacity, 4U)), elements(new ElementType[this->capacity]()), length(0) {}
+    explicit BasicArray(const Size capacity) : BasicArray() {
+      if (N == 0 || capacity > N) {
+        this->capacity = Math::Max<Size>(capacity, 4);
+        this->elements = Allocate<ElementType>(this->capacity);
+      }
+    }
     /// <summary>
     /// Default constructor.
     /// </summary>
     BasicArray() :
-      capacity(0), elements(nullptr), length(0) {}
+      capacity(N), elements(this->getInline()), length(0) {}
     /// <summary>
     /// Copy constructor.
     /// </summary>
@@ -95,7 +186,8 @@ namespace SPL::Arrays {
     /// Destructor.
     /// </summary>
     ~BasicArray() {
-      delete[] this->elements;
+      Destroy(this->elements, this->length);
+      this->release();
     }
   public:
     /// <summary>
@@ -113,21 +205,48 @@ namespace SPL::Arrays {
       return this->length;
     }
     /// <summary>
+    /// Construct a new element at the given index forwarding the specified arguments.
+    /// The element is constructed directly in the array memory, except when it must be inserted before other
+    /// elements that can't be moved as memory blocks.
+    /// </summary>
+    /// <typeparam name="...A">Argument types.</typeparam>
+    /// <param name="index">Zero-based index.</param>
+    /// <param name="...arguments">Constructor arguments.</param>
+    /// <returns>Returns a pointer to the corresponding element or null when wasn't possible to add it.</returns>
+    template<typename ...A>
+    ElementType* emplace(const Index index, A&&... arguments) {
+      if (index > this->length || this->length >= this->capacity) {
+        return nullptr;
+      }
+      if (index == this->length) {
+        Construct(&this->elements[index], Forward<A>(arguments)...);
+      }
+      else {
+        // Build the element first, the arguments may refer to the elements being shifted.
+        ElementType element(Forward<A>(arguments)...);
+        if constexpr (Relocatable) {
+          MemoryMove(&this->elements[index], &this->elements[index + 1], this->length - index);
+          Construct(&this->elements[index], Move(element));
+        }
+        else {
+          Construct(&this->elements[this->length], Move(this->elements[this->length - 1]));
+          for (Size offset = this->length - 1; offset > index; offset--) {
+            this->elements[offset] = Move(this->elements[offset - 1]);
+          }
+          this->elements[index] = Move(element);
+        }
+      }
+      this->length++;
+      return &this->elements[index];
+    }
+    /// <summary>
     /// Add the specified element at the given index by using move semantics.
     /// </summary>
     /// <param name="index">Zero-based index.</param>
     /// <param name="element">New element.</param>
     /// <returns>Returns a pointer to the corresponding element or null when wasn't possible to add it.</returns>
     ElementType* add(const Index index, ElementType&& element) {
-      if (index < this->capacity) {
-        using SPL::Swap;
-        for (Size offset = this->length++; offset > index; offset--) {
-          Swap(this->elements[offset - 1], this->elements[offset]);
-        }
-        Swap(this->elements[index], element);
-        return &this->elements[index];
-      }
-      return nullptr;
+      return this->emplace(index, Move(element));
     }
     /// <summary>
     /// Add a copy of the specified element at the given index.
@@ -136,8 +255,54 @@ namespace SPL::Arrays {
     /// <param name="element">New element.</param>
     /// <returns>Returns a pointer to the corresponding element or null when wasn't possible to add it.</returns>
     ElementType* add(const Index index, const ElementType& element) {
-      ElementType copy(element);
-      return this->add(index, Move(copy));
+      return this->emplace(index, element);
+    }
+    /// <summary>
+    /// Insert a copy of all the given elements at the given index.
+    /// The tail elements are moved only once and trivially copyable elements are copied as a single memory block.
+    /// IMPORTANT: The given elements can't be part of the array.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <param name="elements">New elements.</param>
+    /// <param name="length">Number of elements.</param>
+    /// <returns>Returns a pointer to the first inserted element or null when wasn't possible to insert them.</returns>
+    ElementType* insert(const Index index, const T elements[], const Size length) {
+      if (index > this->length || length > this->capacity - this->length) {
+        return nullptr;
+      }
+      auto* target = &this->elements[index];
+      if constexpr (Relocatable) {
+        MemoryMove(target, target + length, this->length - index);
+        if constexpr (Copyable) {
+          MemoryCopy(elements, target, length);
+        }
+        else {
+          for (Size offset = 0; offset < length; ++offset) {
+            Construct(&target[offset], elements[offset]);
+          }
+        }
+      }
+      else {
+        for (Index current = this->length; current > index; current--) {
+          const auto destination = current - 1 + length;
+          if (destination >= this->length) {
+            Construct(&this->elements[destination], Move(this->elements[current - 1]));
+          }
+          else {
+            this->elements[destination] = Move(this->elements[current - 1]);
+          }
+        }
+        for (Size offset = 0; offset < length; ++offset) {
+          if (index + offset >= this->length) {
+            Construct(&target[offset], elements[offset]);
+          }
+          else {
+            target[offset] = elements[offset];
+          }
+        }
+      }
+      this->length += length;
+      return target;
     }
     /// <summary>
     /// Merge all the given lists into a new array.
@@ -145,26 +310,36 @@ namespace SPL::Arrays {
     /// <param name="pack">Pack of lists.</param>
     /// <returns>Returns the new array.</returns>
     BasicArray concat(const ListPack<T>& pack) const {
-      using SPL::Swap;
       auto length = this->length;
       for (Index index = 0; index < pack.getLength(); ++index) {
         length += pack[index].getLength();
       }
       BasicArray array(length);
-      for (Size offset = 0; offset < this->length; ++offset) {
-        ElementType copy(this->elements[offset]);
-        Swap(array.elements[array.length++], copy);
-      }
+      array.insert(0, this->elements, this->length);
       for (Index index = 0; index < pack.getLength(); ++index) {
         const auto& current = pack[index];
         for (Size offset = 0; offset < current.getLength(); ++offset) {
-          ElementType copy(current.get(offset));
-          Swap(array.elements[array.length++], copy);
+          Construct(&array.elements[array.length], current.get(offset));
+          array.length++;
         }
       }
       return array;
     }
     /// <summary>
+    /// Get a pointer to the first element.
+    /// </summary>
+    /// <returns>Returns the pointer to the first element.</returns>
+    ElementType* begin() const {
+      return this->elements;
+    }
+    /// <summary>
+    /// Get a pointer past the last element.
+    /// </summary>
+    /// <returns>Returns the pointer past the last element.</returns>
+    ElementType* end() const {
+      return this->elements + this->length;
+    }
+    /// <summary>
     /// Get the element that corresponds to the specified index.
     /// </summary>
     /// <param name="index">Zero-based index.</param>
@@ -182,14 +357,9 @@ namespace SPL::Arrays {
     /// <param name="from">From the zero-based index.</param>
     /// <returns>Returns the corresponding index or -1 when the element wasn't found.</returns>
     Index indexOf(const T& search, const Index from = 0) const {
-      auto index = Math::Min(from, this->length);
-      while (index < this->length) {
-        if (Compare(this->elements[index], search) == 0) {
-          return index;
-        }
-        index++;
-      }
-      return -1;
+      const auto start = Math::Min(from, this->length);
+      const auto index = Find<ElementType>(&this->elements[start], this->length - start, search);
+      return index != -1 ? start + index : -1;
     }
     /// <summary>
     /// Get the last index occurrence of the specified element in the array.
@@ -198,29 +368,96 @@ namespace SPL::Arrays {
     /// <param name="from">From the zero-based index.</param>
     /// <returns>Returns the corresponding index or -1 when the element wasn't found.</returns>
     Index lastIndexOf(const T& search, const Index from = -1) const {
-      auto index = Math::Min(from, this->length);
-      while (index > 0) {
-        index--;
-        if (Compare(this->elements[index], search) == 0) {
-          return index;
-        }
-      }
-      return -1;
+      return FindLast<ElementType>(this->elements, Math::Min(from, this->length), search);
+    }
+    /// <summary>
+    /// Count all the occurrences of the specified element in the array.
+    /// </summary>
+    /// <param name="search">Search element.</param>
+    /// <returns>Returns the number of occurrences.</returns>
+    Size count(const T& search) const {
+      return Count<ElementType>(this->elements, this->length, search);
+    }
+    /// <summary>
+    /// Get the index of any occurrence of the specified element in the sorted array.
+    /// </summary>
+    /// <param name="search">Search element.</param>
+    /// <returns>Returns the corresponding index or -1 when the element wasn't found.</returns>
+    Index binarySearch(const T& search) const {
+      return BinarySearch<ElementType>(this->elements, this->length, search);
+    }
+    /// <summary>
+    /// Get the index of the first element in the sorted array that isn't less than the specified element.
+    /// </summary>
+    /// <param name="search">Search element.</param>
+    /// <returns>Returns the corresponding index or the array length when all the elements are less.</returns>
+    Index lowerBound(const T& search) const {
+      return LowerBound<ElementType>(this->elements, this->length, search);
+    }
+    /// <summary>
+    /// Get the index of the first element in the sorted array that is greater than the specified element.
+    /// </summary>
+    /// <param name="search">Search element.</param>
+    /// <returns>Returns the corresponding index or the array length when no element is greater.</returns>
+    Index upperBound(const T& search) const {
+      return UpperBound<ElementType>(this->elements, this->length, search);
+    }
+    /// <summary>
+    /// Get the range of all the occurrences of the specified element in the sorted array.
+    /// </summary>
+    /// <param name="search">Search element.</param>
+    /// <returns>Returns a pair with the first index (key) and the index after the last occurrence (value).</returns>
+    Pair<Index, Index> equalRange(const T& search) const {
+      return Pair<Index, Index>(this->lowerBound(search), this->upperBound(search));
     }
     /// <summary>
-    /// Remove the first occurrence of the element that corresponds to the specified index.
+    /// Remove and destroy the element that corresponds to the specified index.
+    /// Move the element out (see the get method) before removing it to keep its value.
     /// </summary>
     /// <param name="index">Zero-based index.</param>
-    /// <returns>Returns a pointer to the corresponding element or null when wasn't possible to find it.</returns>
-    ElementType* remove(const Index index) {
+    /// <returns>Returns true when the element was removed, false otherwise.</returns>
+    bool remove(const Index index) {
       if (index < this->length) {
-        using SPL::Swap;
-        for (Size offset = index + 1; offset < this->length; offset++) {
-          Swap(this->elements[offset - 1], this->elements[offset]);
+        if constexpr (Relocatable) {
+          Destroy(&this->elements[index], 1);
+          MemoryMove(&this->elements[index + 1], &this->elements[index], this->length - index - 1);
+        }
+        else {
+          for (Size offset = index + 1; offset < this->length; offset++) {
+            this->elements[offset - 1] = Move(this->elements[offset]);
+          }
+          Destroy(&this->elements[this->length - 1], 1);
         }
-        return &this->elements[--this->length];
+        this->length--;
+        return true;
       }
-      return nullptr;
+      return false;
+    }
+    /// <summary>
+    /// Remove and destroy all the elements in the given range.
+    /// The tail elements are moved only once.
+    /// </summary>
+    /// <param name="from">From the zero-based index.</param>
+    /// <param name="to">To the zero-based index.</param>
+    /// <returns>Returns the number of removed elements.</returns>
+    Size removeRange(const Index from, const Index to) {
+      const auto end = Math::Min(to, this->length);
+      if (from >= end) {
+        return 0;
+      }
+      const auto count = end - from;
+      if constexpr (Relocatable) {
+        Destroy(&this->elements[from], count);
+        MemoryMove(&this->elements[end], &this->elements[from], this->length - end);
+      }
+      else {
+        for (Size offset = end; offset < this->length; ++offset) {
+          this->elements[offset - count] = Move(this->elements[offset]);
+        }
+        Destroy(&this->elements[this->length - count], count);
+      }
+      this->length -= count;
+      return count;
     }
     /// <summary>
     /// Slice a portion of the array based on the given range and generate a new one.
@@ -236,14 +473,75 @@ namespace SPL::Arrays {
       return BasicArray(&this->elements[from], Math::Min(to, this->length) - from);
     }
     /// <summary>
+    /// Get a view of a portion of the array based on the given range (without copying).
+    /// </summary>
+    /// <param name="from">From the zero-based index.</param>
+    /// <param name="to">To the zero-based index.</param>
+    /// <returns>Returns the span of the corresponding elements.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    ArraySpan<T> view(const Index from, const Index to = -1) const {
+      if (from > to || from > this->length) {
+        throw Exceptions::IndexOutOfBounds(from);
+      }
+      return ArraySpan<T>(&this->elements[from], Math::Min(to, this->length) - from);
+    }
+    /// <summary>
     /// Sort the array.
+    /// Large arrays of integer or decimal elements are sorted by radix.
     /// </summary>
     void sort() {
+      if constexpr (Radix) {
+        if (this->length >= RadixThreshold) {
+          auto* buffer = Allocate<ElementType>(this->length);
+          RadixSort(this->elements, buffer, this->length);
+          Deallocate(buffer);
+          return;
+        }
+      }
       if (this->length > 1) {
         Sort(this->elements, 0, this->length - 1);
       }
     }
     /// <summary>
+    /// Sort the array using the given comparator.
+    /// </summary>
+    /// <typeparam name="C">Comparator type.</typeparam>
+    /// <param name="compare">Comparator instance.</param>
+    template<typename C>
+    void sort(const C& compare) {
+      if (this->length > 1) {
+        Sort(this->elements, 0, this->length - 1, compare);
+      }
+    }
+    /// <summary>
+    /// Sort the array keeping the order of equal elements.
+    /// </summary>
+    void stableSort() {
+      if (this->length > 1) {
+        StableSort(this->elements, 0, this->length - 1);
+      }
+    }
+    /// <summary>
+    /// Sort the array using the given comparator and keeping the order of equal elements.
+    /// </summary>
+    /// <typeparam name="C">Comparator type.</typeparam>
+    /// <param name="compare">Comparator instance.</param>
+    template<typename C>
+    void stableSort(const C& compare) {
+      if (this->length > 1) {
+        StableSort(this->elements, 0, this->length - 1, compare);
+      }
+    }
+    /// <summary>
+    /// Sort the array using the given number of worker threads.
+    /// </summary>
+    /// <param name="threads">Number of worker threads (zero for the number of hardware threads).</param>
+    void parallelSort(const Size threads) {
+      if (this->length > 1) {
+        ParallelSort(this->elements, 0, this->length - 1, threads);
+      }
+    }
+    /// <summary>
     /// Reverse the array (in-place).
     /// </summary>
     void reverse() {
@@ -253,10 +551,11 @@ namespace SPL::Arrays {
       }
     }
     /// <summary>
-    /// Clear the array.
+    /// Clear the array destroying all its elements.
     /// The current capacity will remains the same.
     /// </summary>
     void clear() {
+      Destroy(this->elements, this->length);
       this->length = 0;
     }
     /// <summary>
@@ -266,7 +565,7 @@ namespace SPL::Arrays {
     /// <param name="capacity">New capacity.</param>
     /// <returns>Returns true when the enlargement was successful, false otherwise.</returns>
     bool enlarge(const Size capacity) {
-      const auto value = Math::Max(capacity, 4U);
+      const auto value = Math::Max<Size>(capacity, 4);
       if (value > this->capacity) {
         this->resize(value);
         return true;
@@ -280,8 +579,8 @@ namespace SPL::Arrays {
     /// <param name="capacity">New capacity.</param>
     /// <returns>Returns true when the shrinkage was successful, false otherwise.</returns>
     bool shrink(const Size capacity) {
-      const auto value = Math::Max(capacity, 4U);
-      if (value > this->length && value < this->capacity) {
+      const auto value = Math::Max<Size>(capacity, 4);
+      if (value > this->length && value < this->capacity && this->capacity > N) {
         this->resize(value);
         return true;
       }
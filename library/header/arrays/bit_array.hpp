@@ -0,0 +1,366 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#include "./types.hpp"
+#include "./bit_words.hpp"
+
+namespace SPL::Arrays {
+  /// <summary>
+  /// Bit array class.
+  /// Dynamic array of flags packed 64 per word, the bits after the length in the last word are always zero, so the
+  /// counting and bulk operations work on whole words.
+  /// </summary>
+  class BitArray final {
+  private:
+    /// <summary>
+    /// Array words.
+    /// </summary>
+    BitWord* words;
+    /// <summary>
+    /// Number of allocated words.
+    /// </summary>
+    Size capacity;
+    /// <summary>
+    /// Number of bits.
+    /// </summary>
+    Size length;
+  private:
+    /// <summary>
+    /// Exchange all properties from the given objects.
+    /// </summary>
+    /// <param name="source">Source object.</param>
+    /// <param name="target">Target object.</param>
+    friend void Swap(BitArray& source, BitArray& target) noexcept {
+      using SPL::Swap;
+      Swap(source.words, target.words);
+      Swap(source.capacity, target.capacity);
+      Swap(source.length, target.length);
+    }
+    /// <summary>
+    /// Get the number of words in use.
+    /// </summary>
+    /// <returns>Returns the number of words.</returns>
+    Size getCount() const {
+      return BitWords::Count(this->length);
+    }
+    /// <summary>
+    /// Clear the bits after the length in the last word.
+    /// </summary>
+    void trim() {
+      if (this->length % BitWords::Length != 0) {
+        this->words[this->length / BitWords::Length] &= BitWords::Mask(this->length);
+      }
+    }
+    /// <summary>
+    /// Ensure the given array has the same length.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    /// <exception cref="SPL::Exceptions::InvalidArgument">Throws when the lengths are different.</exception>
+    void check(const BitArray& other) const {
+      if (this->length != other.length) {
+        throw Exceptions::InvalidArgument();
+      }
+    }
+    /// <summary>
+    /// Ensure the given index is in bounds.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    void check(const Index index) const {
+      if (index >= this->length) {
+        throw Exceptions::IndexOutOfBounds(index);
+      }
+    }
+    /// <summary>
+    /// Reallocate the array words to the given capacity.
+    /// </summary>
+    /// <param name="capacity">New capacity (in words).</param>
+    void reallocate(const Size capacity) {
+      auto* words = Allocate<BitWord>(capacity);
+      MemoryCopy(this->words, words, this->getCount());
+      if (this->words != nullptr) {
+        Deallocate(this->words);
+      }
+      this->words = words;
+      this->capacity = capacity;
+    }
+  public:
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    BitArray() :
+      words(nullptr), capacity(0), length(0) {}
+    /// <summary>
+    /// Initialized constructor for length.
+    /// </summary>
+    /// <param name="length">Number of bits.</param>
+    /// <param name="value">Initial value for all the bits.</param>
+    explicit BitArray(const Size length, const bool value = false) : BitArray() {
+      this->resize(length, value);
+    }
+    /// <summary>
+    /// Copy constructor.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    BitArray(const BitArray& other) : BitArray() {
+      if (other.length > 0) {
+        this->reallocate(other.getCount());
+        MemoryCopy(other.words, this->words, other.getCount());
+        this->length = other.length;
+      }
+    }
+    /// <summary>
+    /// Move constructor.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    BitArray(BitArray&& other) noexcept : BitArray() {
+      Swap(*this, other);
+    }
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    ~BitArray() {
+      if (this->words != nullptr) {
+        Deallocate(this->words);
+      }
+    }
+  public:
+    /// <summary>
+    /// Get the number of bits.
+    /// </summary>
+    /// <returns>Returns the array length.</returns>
+    Size getLength() const {
+      return this->length;
+    }
+    /// <summary>
+    /// Get the array words.
+    /// </summary>
+    /// <returns>Returns the pointer to the first word.</returns>
+    const BitWord* getData() const {
+      return this->words;
+    }
+    /// <summary>
+    /// Determines whether or not the array is empty.
+    /// </summary>
+    /// <returns>Returns true when it's empty, false otherwise.</returns>
+    bool isEmpty() const {
+      return this->length == 0;
+    }
+    /// <summary>
+    /// Get the bit that corresponds to the specified index.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <returns>Returns the corresponding bit.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    bool get(const Index index) const {
+      this->check(index);
+      return (this->words[index / BitWords::Length] >> (index % BitWords::Length)) & 1;
+    }
+    /// <summary>
+    /// Set the bit that corresponds to the specified index.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <param name="value">New value.</param>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    void set(const Index index, const bool value = true) {
+      this->check(index);
+      const auto bit = 1ULL << (index % BitWords::Length);
+      auto& word = this->words[index / BitWords::Length];
+      word = value ? word | bit : word & ~bit;
+    }
+    /// <summary>
+    /// Clear the bit that corresponds to the specified index.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    void reset(const Index index) {
+      this->set(index, false);
+    }
+    /// <summary>
+    /// Invert the bit that corresponds to the specified index.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    void flip(const Index index) {
+      this->check(index);
+      this->words[index / BitWords::Length] ^= 1ULL << (index % BitWords::Length);
+    }
+    /// <summary>
+    /// Invert all the bits.
+    /// </summary>
+    void flip() {
+      BitWords::Not(this->words, this->getCount());
+      this->trim();
+    }
+    /// <summary>
+    /// Set all the bits to the given value.
+    /// </summary>
+    /// <param name="value">New value.</param>
+    void fill(const bool value) {
+      BitWords::Fill(this->words, this->getCount(), value ? ~0ULL : 0ULL);
+      this->trim();
+    }
+    /// <summary>
+    /// Change the number of bits, the new bits are initialized with the given value.
+    /// </summary>
+    /// <param name="length">New length.</param>
+    /// <param name="value">Value for the new bits.</param>
+    void resize(const Size length, const bool value = false) {
+      const auto count = BitWords::Count(length);
+      if (count > this->capacity) {
+        this->reallocate(Math::Max(count, this->capacity * 2));
+      }
+      if (length > this->length) {
+        const auto start = this->getCount();
+        if (value && this->length % BitWords::Length != 0) {
+          this->words[start - 1] |= ~BitWords::Mask(this->length);
+        }
+        BitWords::Fill(this->words + start, count - start, value ? ~0ULL : 0ULL);
+      }
+      this->length = length;
+      this->trim();
+    }
+    /// <summary>
+    /// Add the given bit at the end of the array.
+    /// </summary>
+    /// <param name="value">New bit.</param>
+    /// <returns>Returns the current length of the array.</returns>
+    Size add(const bool value) {
+      if (this->length % BitWords::Length == 0) {
+        if (this->getCount() == this->capacity) {
+          this->reallocate(Math::Max<Size>(this->capacity * 2, 4));
+        }
+        this->words[this->getCount()] = 0;
+      }
+      this->words[this->length / BitWords::Length] |= static_cast<BitWord>(value) << (this->length % BitWords::Length);
+      return ++this->length;
+    }
+    /// <summary>
+    /// Get the number of set bits.
+    /// </summary>
+    /// <returns>Returns the number of set bits.</returns>
+    Size count() const {
+      return BitWords::PopCount(this->words, this->getCount());
+    }
+    /// <summary>
+    /// Get the number of set bits before the specified index.
+    /// </summary>
+    /// <param name="index">Zero-based index (up to the length).</param>
+    /// <returns>Returns the number of set bits.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    Size rank(const Index index) const {
+      if (index > this->length) {
+        throw Exceptions::IndexOutOfBounds(index);
+      }
+      return BitWords::Rank(this->words, index);
+    }
+    /// <summary>
+    /// Get the index of the first set bit.
+    /// </summary>
+    /// <returns>Returns the corresponding index or -1 when there's no set bit.</returns>
+    Index findFirst() const {
+      return BitWords::Find(this->words, this->getCount(), 0);
+    }
+    /// <summary>
+    /// Get the index of the next set bit after the specified index.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <returns>Returns the corresponding index or -1 when there's no more set bits.</returns>
+    Index findNext(const Index index) const {
+      return index + 1 < this->length ? BitWords::Find(this->words, this->getCount(), index + 1) : -1;
+    }
+    /// <summary>
+    /// Determines whether or not any bit is set.
+    /// </summary>
+    /// <returns>Returns true when at least one bit is set, false otherwise.</returns>
+    bool any() const {
+      return this->findFirst() != -1;
+    }
+    /// <summary>
+    /// Determines whether or not all the bits are set.
+    /// </summary>
+    /// <returns>Returns true when all the bits are set, false otherwise.</returns>
+    bool all() const {
+      return this->count() == this->length;
+    }
+    /// <summary>
+    /// Clear all the bits that are set in the given array.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    /// <returns>Returns the instance itself.</returns>
+    /// <exception cref="SPL::Exceptions::InvalidArgument">Throws when the lengths are different.</exception>
+    BitArray& andNot(const BitArray& other) {
+      this->check(other);
+      BitWords::AndNot(this->words, other.words, this->getCount());
+      return *this;
+    }
+    /// <summary>
+    /// Clear the array.
+    /// </summary>
+    void clear() {
+      this->length = 0;
+    }
+  public:
+    /// <summary>
+    /// Get the bit that corresponds to the specified index.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <returns>Returns the corresponding bit.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    bool operator [](const Index index) const {
+      return this->get(index);
+    }
+    /// <summary>
+    /// Apply the logical AND with the given array.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    /// <returns>Returns the instance itself.</returns>
+    /// <exception cref="SPL::Exceptions::InvalidArgument">Throws when the lengths are different.</exception>
+    BitArray& operator &= (const BitArray& other) {
+      this->check(other);
+      BitWords::And(this->words, other.words, this->getCount());
+      return *this;
+    }
+    /// <summary>
+    /// Apply the logical OR with the given array.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    /// <returns>Returns the instance itself.</returns>
+    /// <exception cref="SPL::Exceptions::InvalidArgument">Throws when the lengths are different.</exception>
+    BitArray& operator |= (const BitArray& other) {
+      this->check(other);
+      BitWords::Or(this->words, other.words, this->getCount());
+      return *this;
+    }
+    /// <summary>
+    /// Apply the logical XOR with the given array.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    /// <returns>Returns the instance itself.</returns>
+    /// <exception cref="SPL::Exceptions::InvalidArgument">Throws when the lengths are different.</exception>
+    BitArray& operator ^= (const BitArray& other) {
+      this->check(other);
+      BitWords::Xor(this->words, other.words, this->getCount());
+      return *this;
+    }
+    /// <summary>
+    /// Check whether or not the given arrays have equal bits.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    /// <returns>Returns true when both are equals, false otherwise.</returns>
+    bool operator == (const BitArray& other) const {
+      return this->length == other.length && BitWords::Equals(this->words, other.words, this->getCount());
+    }
+    /// <summary>
+    /// Assign all properties from the given array.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    /// <returns>Returns the instance itself.</returns>
+    BitArray& operator = (BitArray other) noexcept {
+      Swap(*this, other);
+      return *this;
+    }
+  };
+}
@@ -0,0 +1,258 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#include "./types.hpp"
+#include "./bit_words.hpp"
+
+namespace SPL::Arrays {
+  /// <summary>
+  /// Bit set class.
+  /// Fixed-length set of flags packed 64 per word in inline storage, the bits after the length in the last word are
+  /// always zero, so the counting and bulk operations work on whole words.
+  /// </summary>
+  /// <typeparam name="N">Number of bits.</typeparam>
+  template<Size N>
+  class BitSet final {
+  private:
+    static_assert(N > 0, "The bit set length must be greater than zero.");
+    /// <summary>
+    /// Number of words.
+    /// </summary>
+    constexpr static Size Count = BitWords::Count(N);
+    /// <summary>
+    /// Set words.
+    /// </summary>
+    BitWord words[Count];
+  private:
+    /// <summary>
+    /// Clear the bits after the length in the last word.
+    /// </summary>
+    void trim() {
+      this->words[Count - 1] &= BitWords::Mask(N);
+    }
+    /// <summary>
+    /// Ensure the given index is in bounds.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    static void Check(const Index index) {
+      if (index >= N) {
+        throw Exceptions::IndexOutOfBounds(index);
+      }
+    }
+  public:
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    /// <param name="value">Initial value for all the bits.</param>
+    explicit BitSet(const bool value = false) {
+      this->fill(value);
+    }
+  public:
+    /// <summary>
+    /// Get the number of bits.
+    /// </summary>
+    /// <returns>Returns the set length.</returns>
+    constexpr Size getLength() const {
+      return N;
+    }
+    /// <summary>
+    /// Get the set words.
+    /// </summary>
+    /// <returns>Returns the pointer to the first word.</returns>
+    const BitWord* getData() const {
+      return this->words;
+    }
+    /// <summary>
+    /// Get the bit that corresponds to the specified index.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <returns>Returns the corresponding bit.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    bool get(const Index index) const {
+      Check(index);
+      return (this->words[index / BitWords::Length] >> (index % BitWords::Length)) & 1;
+    }
+    /// <summary>
+    /// Set the bit that corresponds to the specified index.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <param name="value">New value.</param>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    void set(const Index index, const bool value = true) {
+      Check(index);
+      const auto bit = 1ULL << (index % BitWords::Length);
+      auto& word = this->words[index / BitWords::Length];
+      word = value ? word | bit : word & ~bit;
+    }
+    /// <summary>
+    /// Clear the bit that corresponds to the specified index.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    void reset(const Index index) {
+      this->set(index, false);
+    }
+    /// <summary>
+    /// Invert the bit that corresponds to the specified index.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    void flip(const Index index) {
+      Check(index);
+      this->words[index / BitWords::Length] ^= 1ULL << (index % BitWords::Length);
+    }
+    /// <summary>
+    /// Invert all the bits.
+    /// </summary>
+    void flip() {
+      BitWords::Not(this->words, Count);
+      this->trim();
+    }
+    /// <summary>
+    /// Set all the bits to the given value.
+    /// </summary>
+    /// <param name="value">New value.</param>
+    void fill(const bool value) {
+      BitWords::Fill(this->words, Count, value ? ~0ULL : 0ULL);
+      this->trim();
+    }
+    /// <summary>
+    /// Get the number of set bits.
+    /// </summary>
+    /// <returns>Returns the number of set bits.</returns>
+    Size count() const {
+      return BitWords::PopCount(this->words, Count);
+    }
+    /// <summary>
+    /// Get the number of set bits before the specified index.
+    /// </summary>
+    /// <param name="index">Zero-based index (up to the length).</param>
+    /// <returns>Returns the number of set bits.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    Size rank(const Index index) const {
+      if (index > N) {
+        throw Exceptions::IndexOutOfBounds(index);
+      }
+      return BitWords::Rank(this->words, index);
+    }
+    /// <summary>
+    /// Get the index of the first set bit.
+    /// </summary>
+    /// <returns>Returns the corresponding index or -1 when there's no set bit.</returns>
+    Index findFirst() const {
+      return BitWords::Find(this->words, Count, 0);
+    }
+    /// <summary>
+    /// Get the index of the next set bit after the specified index.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <returns>Returns the corresponding index or -1 when there's no more set bits.</returns>
+    Index findNext(const Index index) const {
+      return index + 1 < N ? BitWords::Find(this->words, Count, index + 1) : -1;
+    }
+    /// <summary>
+    /// Determines whether or not any bit is set.
+    /// </summary>
+    /// <returns>Returns true when at least one bit is set, false otherwise.</returns>
+    bool any() const {
+      return this->findFirst() != -1;
+    }
+    /// <summary>
+    /// Determines whether or not all the bits are set.
+    /// </summary>
+    /// <returns>Returns true when all the bits are set, false otherwise.</returns>
+    bool all() const {
+      return this->count() == N;
+    }
+    /// <summary>
+    /// Clear all the bits that are set in the given set.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    /// <returns>Returns the instance itself.</returns>
+    BitSet& andNot(const BitSet& other) {
+      BitWords::AndNot(this->words, other.words, Count);
+      return *this;
+    }
+  public:
+    /// <summary>
+    /// Get the bit that corresponds to the specified index.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <returns>Returns the corresponding bit.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    bool operator [](const Index index) const {
+      return this->get(index);
+    }
+    /// <summary>
+    /// Apply the logical AND with the given set.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    /// <returns>Returns the instance itself.</returns>
+    BitSet& operator &= (const BitSet& other) {
+      BitWords::And(this->words, other.words, Count);
+      return *this;
+    }
+    /// <summary>
+    /// Apply the logical OR with the given set.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    /// <returns>Returns the instance itself.</returns>
+    BitSet& operator |= (const BitSet& other) {
+      BitWords::Or(this->words, other.words, Count);
+      return *this;
+    }
+    /// <summary>
+    /// Apply the logical XOR with the given set.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    /// <returns>Returns the instance itself.</returns>
+    BitSet& operator ^= (const BitSet& other) {
+      BitWords::Xor(this->words, other.words, Count);
+      return *this;
+    }
+    /// <summary>
+    /// Get a new set with the logical AND of both sets.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    /// <returns>Returns the new set.</returns>
+    BitSet operator & (const BitSet& other) const {
+      return BitSet(*this) &= other;
+    }
+    /// <summary>
+    /// Get a new set with the logical OR of both sets.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    /// <returns>Returns the new set.</returns>
+    BitSet operator | (const BitSet& other) const {
+      return BitSet(*this) |= other;
+    }
+    /// <summary>
+    /// Get a new set with the logical XOR of both sets.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    /// <returns>Returns the new set.</returns>
+    BitSet operator ^ (const BitSet& other) const {
+      return BitSet(*this) ^= other;
+    }
+    /// <summary>
+    /// Get a new set with all the bits inverted.
+    /// </summary>
+    /// <returns>Returns the new set.</returns>
+    BitSet operator ~ () const {
+      BitSet result(*this);
+      result.flip();
+      return result;
+    }
+    /// <summary>
+    /// Check whether or not the given sets have equal bits.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    /// <returns>Returns true when both are equals, false otherwise.</returns>
+    bool operator == (const BitSet& other) const {
+      return BitWords::Equals(this->words, other.words, Count);
+    }
+  };
+}
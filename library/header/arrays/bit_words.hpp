@@ -0,0 +1,160 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#include "./types.hpp"
+
+namespace SPL::Arrays {
+  /// <summary>
+  /// Bit word type (64 flags per word).
+  /// </summary>
+  using BitWord = unsigned long long int;
+}
+
+namespace SPL::Arrays::BitWords {
+  /// <summary>
+  /// Number of bits per word.
+  /// </summary>
+  constexpr Size Length = sizeof(BitWord) * 8;
+  /// <summary>
+  /// Get the number of words needed to store the given number of bits.
+  /// </summary>
+  /// <param name="length">Number of bits.</param>
+  /// <returns>Returns the number of words.</returns>
+  constexpr Size Count(const Size length) {
+    return (length + (Length - 1)) / Length;
+  }
+  /// <summary>
+  /// Get the mask of the valid bits in the last word for the given number of bits.
+  /// </summary>
+  /// <param name="length">Number of bits.</param>
+  /// <returns>Returns the corresponding mask.</returns>
+  constexpr BitWord Mask(const Size length) {
+    return length % Length == 0 ? ~0ULL : (1ULL << (length % Length)) - 1;
+  }
+  /// <summary>
+  /// Get the number of set bits in the given words.
+  /// </summary>
+  /// <param name="words">Input words.</param>
+  /// <param name="count">Number of words.</param>
+  /// <returns>Returns the number of set bits.</returns>
+  inline Size PopCount(const BitWord words[], const Size count) {
+    Size total = 0;
+    for (Size offset = 0; offset < count; ++offset) {
+      total += Math::PopCount(words[offset]);
+    }
+    return total;
+  }
+  /// <summary>
+  /// Get the number of set bits before the given bit index.
+  /// </summary>
+  /// <param name="words">Input words.</param>
+  /// <param name="index">Zero-based bit index.</param>
+  /// <returns>Returns the number of set bits.</returns>
+  inline Size Rank(const BitWord words[], const Index index) {
+    const auto word = index / Length;
+    const auto total = PopCount(words, word);
+    return index % Length == 0 ? total : total + Math::PopCount(words[word] & Mask(index));
+  }
+  /// <summary>
+  /// Get the index of the first set bit starting from the given bit index.
+  /// </summary>
+  /// <param name="words">Input words.</param>
+  /// <param name="count">Number of words.</param>
+  /// <param name="from">From the zero-based bit index.</param>
+  /// <returns>Returns the corresponding index or -1 when there's no set bit.</returns>
+  inline Index Find(const BitWord words[], const Size count, const Index from) {
+    auto word = from / Length;
+    if (word >= count) {
+      return -1;
+    }
+    auto bits = words[word] & (~0ULL << (from % Length));
+    while (bits == 0) {
+      if (++word == count) {
+        return -1;
+      }
+      bits = words[word];
+    }
+    return word * Length + Math::CountTrailingZeros(bits);
+  }
+  /// <summary>
+  /// Fill all the given words with the given value.
+  /// </summary>
+  /// <param name="words">Target words.</param>
+  /// <param name="count">Number of words.</param>
+  /// <param name="value">Fill value.</param>
+  inline void Fill(BitWord words[], const Size count, const BitWord value) {
+    for (Size offset = 0; offset < count; ++offset) {
+      words[offset] = value;
+    }
+  }
+  /// <summary>
+  /// Determines whether or not the given words are equal.
+  /// </summary>
+  /// <param name="first">First words.</param>
+  /// <param name="second">Second words.</param>
+  /// <param name="count">Number of words.</param>
+  /// <returns>Returns true when all the words are equal, false otherwise.</returns>
+  inline bool Equals(const BitWord first[], const BitWord second[], const Size count) {
+    BitWord difference = 0;
+    for (Size offset = 0; offset < count; ++offset) {
+      difference |= first[offset] ^ second[offset];
+    }
+    return difference == 0;
+  }
+  /// <summary>
+  /// Apply the logical AND between the target and source words (into the target).
+  /// </summary>
+  /// <param name="target">Target words.</param>
+  /// <param name="source">Source words.</param>
+  /// <param name="count">Number of words.</param>
+  inline void And(BitWord target[], const BitWord source[], const Size count) {
+    for (Size offset = 0; offset < count; ++offset) {
+      target[offset] &= source[offset];
+    }
+  }
+  /// <summary>
+  /// Apply the logical OR between the target and source words (into the target).
+  /// </summary>
+  /// <param name="target">Target words.</param>
+  /// <param name="source">Source words.</param>
+  /// <param name="count">Number of words.</param>
+  inline void Or(BitWord target[], const BitWord source[], const Size count) {
+    for (Size offset = 0; offset < count; ++offset) {
+      target[offset] |= source[offset];
+    }
+  }
+  /// <summary>
+  /// Apply the logical XOR between the target and source words (into the target).
+  /// </summary>
+  /// <param name="target">Target words.</param>
+  /// <param name="source">Source words.</param>
+  /// <param name="count">Number of words.</param>
+  inline void Xor(BitWord target[], const BitWord source[], const Size count) {
+    for (Size offset = 0; offset < count; ++offset) {
+      target[offset] ^= source[offset];
+    }
+  }
+  /// <summary>
+  /// Clear in the target words all the bits that are set in the source words.
+  /// </summary>
+  /// <param name="target">Target words.</param>
+  /// <param name="source">Source words.</param>
+  /// <param name="count">Number of words.</param>
+  inline void AndNot(BitWord target[], const BitWord source[], const Size count) {
+    for (Size offset = 0; offset < count; ++offset) {
+      target[offset] &= ~source[offset];
+    }
+  }
+  /// <summary>
+  /// Invert all the bits in the given words.
+  /// </summary>
+  /// <param name="words">Target words.</param>
+  /// <param name="count">Number of words.</param>
+  inline void Not(BitWord words[], const Size count) {
+    for (Size offset = 0; offset < count; ++offset) {
+      words[offset] = ~words[offset];
+    }
+  }
+}
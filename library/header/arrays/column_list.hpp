@@ -0,0 +1,422 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#include "./types.hpp"
+#include "./basic_array.hpp"
+
+namespace SPL::Arrays {
+  /// <summary>
+  /// Column list class declaration.
+  /// </summary>
+  /// <typeparam name="T">Row type.</typeparam>
+  template<typename T>
+  class ColumnList;
+  /// <summary>
+  /// Column list class.
+  /// Each value type of the row tuple is stored in its own array (struct of arrays), so scanning a single column
+  /// reads only that column from memory and the column elements can be processed as a contiguous span.
+  /// </summary>
+  /// <typeparam name="...T">Column types.</typeparam>
+  template<typename ...T>
+  class ColumnList<Tuple<T...>> final {
+  public:
+    /// <summary>
+    /// Row type.
+    /// </summary>
+    using RowType = Tuple<T...>;
+    /// <summary>
+    /// Column types.
+    /// </summary>
+    template<Index I>
+    using Type = typename Types::Pick<I, T...>::Type;
+    /// <summary>
+    /// Row proxy class.
+    /// Refers to one row of the list and accesses each column value in place.
+    /// </summary>
+    class Row final {
+    private:
+      /// <summary>
+      /// List reference.
+      /// </summary>
+      ColumnList& list;
+      /// <summary>
+      /// Row index.
+      /// </summary>
+      Index index;
+    public:
+      /// <summary>
+      /// Default constructor.
+      /// </summary>
+      /// <param name="list">List reference.</param>
+      /// <param name="index">Row index.</param>
+      Row(ColumnList& list, const Index index) :
+        list(list), index(index) {}
+    public:
+      /// <summary>
+      /// Get the column value of the row.
+      /// </summary>
+      /// <typeparam name="I">Column index.</typeparam>
+      /// <returns>Returns the column value.</returns>
+      template<Index I>
+      Type<I>& get() const {
+        return *this->list.template getArray<I>().get(this->index);
+      }
+      /// <summary>
+      /// Set the column value of the row.
+      /// </summary>
+      /// <typeparam name="I">Column index.</typeparam>
+      /// <param name="value">New value.</param>
+      template<Index I>
+      void set(const Type<I>& value) const {
+        this->get<I>() = value;
+      }
+    public:
+      /// <summary>
+      /// Replace all the column values of the row.
+      /// </summary>
+      /// <param name="row">New row.</param>
+      /// <returns>Returns the proxy itself.</returns>
+      Row& operator = (const RowType& row) {
+        this->list.set(this->index, row);
+        return *this;
+      }
+      /// <summary>
+      /// Get a copy of all the column values of the row.
+      /// </summary>
+      operator RowType() const {
+        return this->list.get(this->index);
+      }
+    };
+  private:
+    /// <summary>
+    /// Number of columns.
+    /// </summary>
+    constexpr static Size Count = sizeof...(T);
+    /// <summary>
+    /// Column arrays.
+    /// </summary>
+    Tuple<BasicArray<T, 0>...> columns;
+  private:
+    /// <summary>
+    /// Exchange all properties from the given objects.
+    /// </summary>
+    /// <param name="source">Source object.</param>
+    /// <param name="target">Target object.</param>
+    friend void Swap(ColumnList& source, ColumnList& target) noexcept {
+      using SPL::Swap;
+      Swap(source.columns, target.columns);
+    }
+    /// <summary>
+    /// Get the array of the specified column.
+    /// </summary>
+    /// <typeparam name="I">Column index.</typeparam>
+    /// <returns>Returns the column array.</returns>
+    template<Index I>
+    BasicArray<Type<I>, 0>& getArray() {
+      return this->columns.template get<I>();
+    }
+    /// <summary>
+    /// Get the array of the specified column.
+    /// </summary>
+    /// <typeparam name="I">Column index.</typeparam>
+    /// <returns>Returns the column array.</returns>
+    template<Index I>
+    const BasicArray<Type<I>, 0>& getArray() const {
+      return this->columns.template get<I>();
+    }
+    /// <summary>
+    /// Call the given callback for each column array.
+    /// </summary>
+    /// <typeparam name="I">Current column index.</typeparam>
+    /// <typeparam name="F">Callback type.</typeparam>
+    /// <param name="callback">Callback function.</param>
+    template<Index I = 0, typename F>
+    void forEach(const F& callback) {
+      callback(this->getArray<I>());
+      if constexpr (I + 1 < Count) {
+        this->forEach<I + 1>(callback);
+      }
+    }
+    /// <summary>
+    /// Add a copy of the given values at the specified row index (one value per column).
+    /// </summary>
+    /// <typeparam name="I">Current column index.</typeparam>
+    /// <typeparam name="V">Value type.</typeparam>
+    /// <typeparam name="...R">Remaining value types.</typeparam>
+    /// <param name="index">Row index.</param>
+    /// <param name="value">Column value.</param>
+    /// <param name="...values">Remaining column values.</param>
+    template<Index I, typename V, typename ...R>
+    void insertValues(const Index index, const V& value, const R&... values) {
+      this->getArray<I>().add(index, value);
+      if constexpr (I + 1 < Count) {
+        this->insertValues<I + 1>(index, values...);
+      }
+    }
+    /// <summary>
+    /// Add a copy of the given row values at the specified row index.
+    /// </summary>
+    /// <typeparam name="I">Current column index.</typeparam>
+    /// <param name="index">Row index.</param>
+    /// <param name="row">Row values.</param>
+    template<Index I = 0>
+    void insertRow(const Index index, const RowType& row) {
+      this->getArray<I>().add(index, row.template get<I>());
+      if constexpr (I + 1 < Count) {
+        this->insertRow<I + 1>(index, row);
+      }
+    }
+    /// <summary>
+    /// Assign the given row values at the specified row index.
+    /// </summary>
+    /// <typeparam name="I">Current column index.</typeparam>
+    /// <param name="index">Row index.</param>
+    /// <param name="row">Row values.</param>
+    template<Index I = 0>
+    void assign(const Index index, const RowType& row) {
+      *this->getArray<I>().get(index) = row.template get<I>();
+      if constexpr (I + 1 < Count) {
+        this->assign<I + 1>(index, row);
+      }
+    }
+    /// <summary>
+    /// Copy the values of the specified row index into the given row.
+    /// </summary>
+    /// <typeparam name="I">Current column index.</typeparam>
+    /// <param name="index">Row index.</param>
+    /// <param name="row">Output row.</param>
+    template<Index I = 0>
+    void load(const Index index, RowType& row) const {
+      row.template get<I>() = *this->getArray<I>().get(index);
+      if constexpr (I + 1 < Count) {
+        this->load<I + 1>(index, row);
+      }
+    }
+    /// <summary>
+    /// Enlarge the current capacity of all the columns (when necessary).
+    /// </summary>
+    void enlarge() {
+      const auto capacity = this->getCapacity();
+      if (this->getLength() == capacity) {
+        this->forEach([capacity](auto& array) {
+          array.enlarge(capacity << 1);
+        });
+      }
+    }
+    /// <summary>
+    /// Shrink the current capacity of all the columns (when necessary).
+    /// </summary>
+    void shrink() {
+      const auto capacity = this->getCapacity();
+      if (this->getLength() == capacity >> 2) {
+        this->forEach([capacity](auto& array) {
+          array.shrink(capacity >> 1);
+        });
+      }
+    }
+  public:
+    /// <summary>
+    /// Initialized constructor for capacity.
+    /// </summary>
+    /// <param name="capacity">Initial capacity.</param>
+    explicit ColumnList(const Size capacity) : ColumnList() {
+      if (capacity > 0) {
+        this->forEach([capacity](auto& array) {
+          array.enlarge(NP2(capacity));
+        });
+      }
+    }
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    ColumnList() :
+      columns() {}
+    /// <summary>
+    /// Copy constructor.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    ColumnList(const ColumnList& other) :
+      columns(other.columns) {}
+    /// <summary>
+    /// Move constructor.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    ColumnList(ColumnList&& other) noexcept : ColumnList() {
+      Swap(*this, other);
+    }
+  public:
+    /// <summary>
+    /// Get the capacity of the list.
+    /// </summary>
+    /// <returns>Returns the list capacity.</returns>
+    Size getCapacity() const {
+      return this->getArray<0>().getCapacity();
+    }
+    /// <summary>
+    /// Get the number of rows in the list.
+    /// </summary>
+    /// <returns>Returns the list length.</returns>
+    Size getLength() const {
+      return this->getArray<0>().getLength();
+    }
+    /// <summary>
+    /// Determines whether or not the list is empty.
+    /// </summary>
+    /// <returns>Returns true when it's empty, false otherwise.</returns>
+    bool isEmpty() const {
+      return this->getLength() == 0;
+    }
+    /// <summary>
+    /// Get a view of all the elements in the specified column.
+    /// The elements are contiguous, so scanning a column is as fast as scanning a plain array.
+    /// </summary>
+    /// <typeparam name="I">Column index.</typeparam>
+    /// <returns>Returns the span of the column elements.</returns>
+    template<Index I>
+    ArraySpan<Type<I>> getColumn() {
+      return this->getArray<I>().view(0);
+    }
+    /// <summary>
+    /// Get a read-only view of all the elements in the specified column.
+    /// The elements are contiguous, so scanning a column is as fast as scanning a plain array.
+    /// </summary>
+    /// <typeparam name="I">Column index.</typeparam>
+    /// <returns>Returns the span of the column elements.</returns>
+    template<Index I>
+    ConstArraySpan<Type<I>> getColumn() const {
+      return this->getArray<I>().view(0);
+    }
+    /// <summary>
+    /// Add a copy of the given values (one per column) as a new row at the end of the list.
+    /// When the list is at its capacity, the current capacity will be doubled.
+    /// </summary>
+    /// <param name="...values">Column values.</param>
+    /// <returns>Returns the current length of the list.</returns>
+    Size add(const T&... values) {
+      if (this->getLength() == this->getCapacity()) {
+        // Copy the values before enlarging, they may refer to the current elements.
+        const RowType row(values...);
+        this->enlarge();
+        return this->add(row);
+      }
+      this->insertValues<0>(this->getLength(), values...);
+      return this->getLength();
+    }
+    /// <summary>
+    /// Add a copy of the given row at the end of the list.
+    /// When the list is at its capacity, the current capacity will be doubled.
+    /// </summary>
+    /// <param name="row">New row.</param>
+    /// <returns>Returns the current length of the list.</returns>
+    Size add(const RowType& row) {
+      this->enlarge();
+      this->insertRow(this->getLength(), row);
+      return this->getLength();
+    }
+    /// <summary>
+    /// Add a copy of the given row at the specified index.
+    /// When the list is at its capacity, the current capacity will be doubled.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <param name="row">New row.</param>
+    /// <returns>Returns the current length of the list.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    Size add(const Index index, const RowType& row) {
+      if (index > this->getLength()) {
+        throw Exceptions::IndexOutOfBounds(index);
+      }
+      this->enlarge();
+      this->insertRow(index, row);
+      return this->getLength();
+    }
+    /// <summary>
+    /// Get a copy of the row that corresponds to the specified index.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <returns>Returns the corresponding row.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    RowType get(const Index index) const {
+      if (index >= this->getLength()) {
+        throw Exceptions::IndexOutOfBounds(index);
+      }
+      RowType row;
+      this->load(index, row);
+      return row;
+    }
+    /// <summary>
+    /// Get the column value of the row that corresponds to the specified index.
+    /// </summary>
+    /// <typeparam name="I">Column index.</typeparam>
+    /// <param name="index">Zero-based index.</param>
+    /// <returns>Returns the corresponding value.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    template<Index I>
+    Type<I>& get(const Index index) const {
+      auto* value = this->getArray<I>().get(index);
+      if (value == nullptr) {
+        throw Exceptions::IndexOutOfBounds(index);
+      }
+      return *value;
+    }
+    /// <summary>
+    /// Replace the row at the specified index with a copy of the given one.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <param name="row">New row.</param>
+    /// <returns>Returns the replaced row.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    RowType set(const Index index, const RowType& row) {
+      auto previous = this->get(index);
+      this->assign(index, row);
+      return previous;
+    }
+    /// <summary>
+    /// Remove the row that corresponds to the specified index from the list.
+    /// When the list length is 1/4 of the current capacity, the current capacity will be reduced by half.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <returns>Returns the removed row.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    RowType remove(const Index index) {
+      auto row = this->get(index);
+      this->forEach([index](auto& array) {
+        array.remove(index);
+      });
+      this->shrink();
+      return row;
+    }
+    /// <summary>
+    /// Clear the list.
+    /// The current capacity will remains the same.
+    /// </summary>
+    void clear() {
+      this->forEach([](auto& array) {
+        array.clear();
+      });
+    }
+  public:
+    /// <summary>
+    /// Get a proxy for the row that corresponds to the specified index.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <returns>Returns the row proxy.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    Row operator [](const Index index) {
+      if (index >= this->getLength()) {
+        throw Exceptions::IndexOutOfBounds(index);
+      }
+      return Row(*this, index);
+    }
+    /// <summary>
+    /// Assign all properties from the given list.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    /// <returns>Returns the instance itself.</returns>
+    ColumnList& operator = (ColumnList other) noexcept {
+      Swap(*this, other);
+      return *this;
+    }
+  };
+}
@@ -0,0 +1,241 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#include "./types.hpp"
+#include "./array_list.hpp"
+
+namespace SPL::Arrays {
+  /// <summary>
+  /// Eytzinger array class.
+  /// Immutable view of sorted elements stored in breadth-first (Eytzinger) order, the first levels of the implicit
+  /// search tree share the same cache lines and the next levels are prefetched while searching, so lookups in very
+  /// large arrays cost only a few cache misses. Indexes refer to the layout order, not to the sorted order.
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  template<typename T>
+  class EytzingerArray final {
+  private:
+    /// <summary>
+    /// Non-constant element type.
+    /// </summary>
+    using ElementType = Metadata::ConstantType<T>;
+    /// <summary>
+    /// Number of elements per cache line (prefetch distance in tree levels).
+    /// </summary>
+    constexpr static Size LineLength = sizeof(ElementType) < 64 ? 64 / sizeof(ElementType) : 1;
+    /// <summary>
+    /// Elements in layout order (one-based, the first position is unused).
+    /// </summary>
+    ElementType* elements;
+    /// <summary>
+    /// Number of elements.
+    /// </summary>
+    Size length;
+  private:
+    /// <summary>
+    /// Exchange all properties from the given objects.
+    /// </summary>
+    /// <param name="source">Source object.</param>
+    /// <param name="target">Target object.</param>
+    friend void Swap(EytzingerArray& source, EytzingerArray& target) noexcept {
+      using SPL::Swap;
+      Swap(source.elements, target.elements);
+      Swap(source.length, target.length);
+    }
+    /// <summary>
+    /// Copy the given sorted elements into the layout following the in-order traversal of the tree.
+    /// </summary>
+    /// <param name="sorted">Sorted elements.</param>
+    /// <param name="offset">Current offset of the sorted elements.</param>
+    /// <param name="node">Current tree node (one-based).</param>
+    void build(const ElementType sorted[], Size& offset, const Size node) {
+      if (node <= this->length) {
+        this->build(sorted, offset, node * 2);
+        Construct(&this->elements[node], sorted[offset++]);
+        this->build(sorted, offset, node * 2 + 1);
+      }
+    }
+    /// <summary>
+    /// Initialize the layout with the given sorted elements.
+    /// </summary>
+    /// <param name="sorted">Sorted elements.</param>
+    /// <param name="length">Number of elements.</param>
+    void initialize(const ElementType sorted[], const Size length) {
+      this->length = length;
+      if (length > 0) {
+        Size offset = 0;
+        this->elements = Allocate<ElementType>(length + 1);
+        this->build(sorted, offset, 1);
+      }
+    }
+    /// <summary>
+    /// Search for the first element that doesn't satisfy the given predicate.
+    /// </summary>
+    /// <typeparam name="U">Determines whether or not the predicate is "less or equal" (instead of "less").</typeparam>
+    /// <param name="value">Search value.</param>
+    /// <returns>Returns the corresponding node (one-based) or zero when all the elements satisfy the predicate.</returns>
+    template<bool U>
+    Size search(const T& value) const {
+      Size node = 1;
+      while (node <= this->length) {
+        Prefetch(reinterpret_cast<const void*>(reinterpret_cast<unsigned long long>(this->elements) + node * LineLength * sizeof(ElementType)));
+        if constexpr (U) {
+          node = node * 2 + (Compare<ElementType>(this->elements[node], value) <= 0 ? 1 : 0);
+        }
+        else {
+          node = node * 2 + (Compare<ElementType>(this->elements[node], value) < 0 ? 1 : 0);
+        }
+      }
+      return static_cast<Size>(node >> (Math::CountTrailingZeros(~static_cast<unsigned long long>(node)) + 1));
+    }
+  public:
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    EytzingerArray() :
+      elements(nullptr), length(0) {}
+    /// <summary>
+    /// Initialized constructor for sorted elements.
+    /// </summary>
+    /// <param name="elements">Sorted elements.</param>
+    /// <param name="length">Number of elements.</param>
+    EytzingerArray(const T elements[], const Size length) : EytzingerArray() {
+      this->initialize(elements, length);
+    }
+    /// <summary>
+    /// Initialized constructor for sorted elements.
+    /// </summary>
+    /// <param name="elements">Sorted elements.</param>
+    template<Size L>
+    EytzingerArray(const T(&elements)[L]) : EytzingerArray() {
+      this->initialize(elements, L);
+    }
+    /// <summary>
+    /// Initialized constructor for a sorted list.
+    /// </summary>
+    /// <param name="list">Sorted list.</param>
+    template<Size N>
+    explicit EytzingerArray(const ArrayList<T, N>& list) : EytzingerArray() {
+      if (!list.isEmpty()) {
+        this->initialize(&list[0], list.getLength());
+      }
+    }
+    /// <summary>
+    /// Copy constructor.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    EytzingerArray(const EytzingerArray& other) : EytzingerArray() {
+      if (other.length > 0) {
+        this->length = other.length;
+        this->elements = Allocate<ElementType>(other.length + 1);
+        for (Size node = 1; node <= other.length; ++node) {
+          Construct(&this->elements[node], other.elements[node]);
+        }
+      }
+    }
+    /// <summary>
+    /// Move constructor.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    EytzingerArray(EytzingerArray&& other) noexcept : EytzingerArray() {
+      Swap(*this, other);
+    }
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    ~EytzingerArray() {
+      if (this->elements != nullptr) {
+        Destroy(&this->elements[1], this->length);
+        Deallocate(this->elements);
+      }
+    }
+    /// <summary>
+    /// Get the number of elements.
+    /// </summary>
+    /// <returns>Returns the number of elements.</returns>
+    Size getLength() const {
+      return this->length;
+    }
+    /// <summary>
+    /// Determines whether or not the array is empty.
+    /// </summary>
+    /// <returns>Returns true when the array is empty, false otherwise.</returns>
+    bool isEmpty() const {
+      return this->length == 0;
+    }
+    /// <summary>
+    /// Get a pointer to the first element in layout order for range-based loops.
+    /// </summary>
+    /// <returns>Returns the pointer to the first element.</returns>
+    const T* begin() const {
+      return this->elements != nullptr ? &this->elements[1] : nullptr;
+    }
+    /// <summary>
+    /// Get a pointer past the last element in layout order for range-based loops.
+    /// </summary>
+    /// <returns>Returns the pointer past the last element.</returns>
+    const T* end() const {
+      return this->begin() + this->length;
+    }
+    /// <summary>
+    /// Get the layout index of the first element that isn't less than the given value.
+    /// </summary>
+    /// <param name="value">Search value.</param>
+    /// <returns>Returns the corresponding index or -1 when all the elements are less.</returns>
+    Index lowerBound(const T& value) const {
+      return static_cast<Index>(this->search<false>(value) - 1);
+    }
+    /// <summary>
+    /// Get the layout index of the first element that is greater than the given value.
+    /// </summary>
+    /// <param name="value">Search value.</param>
+    /// <returns>Returns the corresponding index or -1 when no element is greater.</returns>
+    Index upperBound(const T& value) const {
+      return static_cast<Index>(this->search<true>(value) - 1);
+    }
+    /// <summary>
+    /// Get the layout index of the first occurrence of the given value.
+    /// </summary>
+    /// <param name="value">Search value.</param>
+    /// <returns>Returns the corresponding index or -1 when the value wasn't found.</returns>
+    Index indexOf(const T& value) const {
+      const auto node = this->search<false>(value);
+      if (node != 0 && Compare<ElementType>(this->elements[node], value) == 0) {
+        return static_cast<Index>(node - 1);
+      }
+      return -1;
+    }
+    /// <summary>
+    /// Determines whether or not the array contains the given value.
+    /// </summary>
+    /// <param name="value">Search value.</param>
+    /// <returns>Returns true when the value was found, false otherwise.</returns>
+    bool contains(const T& value) const {
+      return this->indexOf(value) != -1;
+    }
+  public:
+    /// <summary>
+    /// Get the element that corresponds to the specified layout index.
+    /// </summary>
+    /// <param name="index">Zero-based layout index.</param>
+    /// <returns>Returns the element reference.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    const T& operator [](const Index index) const {
+      if (index >= this->length) {
+        throw Exceptions::IndexOutOfBounds(index);
+      }
+      return this->elements[index + 1];
+    }
+    /// <summary>
+    /// Assign all properties from the given array.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    /// <returns>Returns the instance itself.</returns>
+    EytzingerArray& operator = (EytzingerArray other) noexcept {
+      Swap(*this, other);
+      return *this;
+    }
+  };
+}
@@ -0,0 +1,399 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#include "./types.hpp"
+#include "./basic_array.hpp"
+#include "./array_span.hpp"
+
+namespace SPL::Arrays {
+  /// <summary>
+  /// Flat map class.
+  /// The keys and the values are stored in two contiguous arrays sorted by key, so the searches are branchless
+  /// binary searches over the keys only and an ordered range of entries is a pair of indices into both arrays.
+  /// It's meant for maps that are built once and read often, inserting or removing keys costs O(n).
+  /// </summary>
+  /// <typeparam name="K">Key type.</typeparam>
+  /// <typeparam name="V">Value type.</typeparam>
+  /// <typeparam name="C">Key comparator type.</typeparam>
+  template<typename K, typename V, typename C = Comparator<Metadata::ConstantType<K>>>
+  class FlatMap final : public Map<K, V> {
+  private:
+    /// <summary>
+    /// Non-constant key type.
+    /// </summary>
+    using KeyType = Metadata::ConstantType<K>;
+    /// <summary>
+    /// Non-constant value type.
+    /// </summary>
+    using ValueType = Metadata::ConstantType<V>;
+    /// <summary>
+    /// Input pair type.
+    /// </summary>
+    using PairType = Pair<KeyType, ValueType>;
+    /// <summary>
+    /// Input order class.
+    /// Compare the input positions by the key of the corresponding pairs.
+    /// </summary>
+    class Order final {
+    private:
+      /// <summary>
+      /// Input pairs.
+      /// </summary>
+      const PairType* pairs;
+      /// <summary>
+      /// Key comparator.
+      /// </summary>
+      const C& compare;
+    public:
+      /// <summary>
+      /// Initialized constructor.
+      /// </summary>
+      /// <param name="pairs">Input pairs.</param>
+      /// <param name="compare">Key comparator.</param>
+      Order(const PairType* pairs, const C& compare) :
+        pairs(pairs), compare(compare) {}
+    public:
+      /// <summary>
+      /// Compare the keys of the given input positions.
+      /// </summary>
+      /// <param name="source">Source position.</param>
+      /// <param name="target">Target position.</param>
+      /// <returns>Returns the comparison result.</returns>
+      int operator()(const Index& source, const Index& target) const {
+        return this->compare(this->pairs[source].key, this->pairs[target].key);
+      }
+    };
+    /// <summary>
+    /// Sorted keys.
+    /// </summary>
+    BasicArray<K, 0> keys;
+    /// <summary>
+    /// Values in the same order of the keys.
+    /// </summary>
+    BasicArray<V, 0> values;
+    /// <summary>
+    /// Comparator instance.
+    /// </summary>
+    C compare;
+  private:
+    /// <summary>
+    /// Exchange all properties from the given objects.
+    /// </summary>
+    /// <param name="source">Source object.</param>
+    /// <param name="target">Target object.</param>
+    friend void Swap(FlatMap& source, FlatMap& target) noexcept {
+      using SPL::Swap;
+      Swap(source.keys, target.keys);
+      Swap(source.values, target.values);
+      Swap(source.compare, target.compare);
+    }
+    /// <summary>
+    /// Get the index of the specified key.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <returns>Returns the corresponding index or -1 when the key wasn't found.</returns>
+    Index find(const KeyType& key) const {
+      return BinarySearch(static_cast<const KeyType*>(this->keys), this->keys.getLength(), key, this->compare);
+    }
+    /// <summary>
+    /// Insert the given key and value at the specified index.
+    /// When the arrays are at their capacity, the current capacity will double.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <param name="key">Entry key.</param>
+    /// <param name="value">Entry value.</param>
+    /// <returns>Returns the inserted value.</returns>
+    ValueType& insert(const Index index, const KeyType& key, ValueType&& value) {
+      const auto capacity = this->keys.getCapacity();
+      if (this->keys.getLength() == capacity) {
+        this->keys.enlarge(capacity << 1);
+        this->values.enlarge(capacity << 1);
+      }
+      this->keys.add(index, key);
+      return *this->values.add(index, Move(value));
+    }
+    /// <summary>
+    /// Remove the key and the value at the specified index.
+    /// When the length is a quarter of the capacity, the current capacity will reduce by half.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <returns>Returns the removed value.</returns>
+    V take(const Index index) {
+      V previous(Move(*this->values.get(index)));
+      this->keys.remove(index);
+      this->values.remove(index);
+      const auto capacity = this->keys.getCapacity();
+      if (this->keys.getLength() == capacity >> 2) {
+        this->keys.shrink(capacity >> 1);
+        this->values.shrink(capacity >> 1);
+      }
+      return previous;
+    }
+  public:
+    /// <summary>
+    /// Initialized constructor for capacity.
+    /// </summary>
+    /// <param name="capacity">Initial capacity.</param>
+    /// <param name="compare">Comparator instance.</param>
+    explicit FlatMap(const Size capacity, const C& compare = C()) :
+      keys(NP2(capacity)), values(NP2(capacity)), compare(compare) {}
+    /// <summary>
+    /// Initialized constructor for unsorted pairs.
+    /// The pairs are sorted once and the last value of each duplicate key is kept.
+    /// </summary>
+    /// <param name="pairs">Initial pairs.</param>
+    /// <param name="compare">Comparator instance.</param>
+    explicit FlatMap(const ConstArraySpan<PairType>& pairs, const C& compare = C()) :
+      FlatMap(pairs.getLength(), compare) {
+      const auto length = pairs.getLength();
+      if (length > 0) {
+        auto* order = Allocate<Index>(length);
+        for (Index offset = 0; offset < length; ++offset) {
+          order[offset] = offset;
+        }
+        StableSort(order, 0, length - 1, Order(pairs.getData(), this->compare));
+        for (Index offset = 0; offset < length; ++offset) {
+          const auto& pair = pairs[order[offset]];
+          const auto last = this->keys.getLength();
+          if (last > 0 && this->compare(*this->keys.get(last - 1), pair.key) == 0) {
+            *this->values.get(last - 1) = pair.value;
+          }
+          else {
+            this->keys.add(last, pair.key);
+            this->values.add(last, pair.value);
+          }
+        }
+        Deallocate(order);
+      }
+    }
+    /// <summary>
+    /// Initialized constructor for unsorted pairs.
+    /// The pairs are sorted once and the last value of each duplicate key is kept.
+    /// </summary>
+    /// <param name="pairs">Initial pairs.</param>
+    template<Size N>
+    FlatMap(const PairType(&pairs)[N]) :
+      FlatMap(ConstArraySpan<PairType>(pairs, N)) {}
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    FlatMap() :
+      keys(), values(), compare() {}
+    /// <summary>
+    /// Copy constructor.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    FlatMap(const FlatMap& other) :
+      keys(other.keys), values(other.values), compare(other.compare) {}
+    /// <summary>
+    /// Move constructor.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    FlatMap(FlatMap&& other) noexcept : FlatMap() {
+      Swap(*this, other);
+    }
+  public:
+    /// <summary>
+    /// Get the map capacity.
+    /// </summary>
+    /// <returns>Returns the map capacity.</returns>
+    Size getCapacity() const {
+      return this->keys.getCapacity();
+    }
+    /// <summary>
+    /// Get the number of entries in the map.
+    /// </summary>
+    /// <returns>Returns the map size.</returns>
+    Size getSize() const override {
+      return this->keys.getLength();
+    }
+    /// <summary>
+    /// Determines whether or not the map is empty.
+    /// </summary>
+    /// <returns>Returns true when it's empty, false otherwise.</returns>
+    bool isEmpty() const override {
+      return this->keys.getLength() == 0;
+    }
+    /// <summary>
+    /// Get a read-only view of all the keys in ascending order.
+    /// </summary>
+    /// <returns>Returns the span of the keys.</returns>
+    ConstArraySpan<KeyType> getKeys() const {
+      return this->keys.view(0);
+    }
+    /// <summary>
+    /// Get a view of all the values in the order of their keys.
+    /// </summary>
+    /// <returns>Returns the span of the values.</returns>
+    ArraySpan<V> getValues() {
+      return this->values.view(0);
+    }
+    /// <summary>
+    /// Get a read-only view of all the values in the order of their keys.
+    /// </summary>
+    /// <returns>Returns the span of the values.</returns>
+    ConstArraySpan<ValueType> getValues() const {
+      return this->values.view(0);
+    }
+    /// <summary>
+    /// Get the index of the first key that isn't less than the specified key.
+    /// </summary>
+    /// <param name="key">Search key.</param>
+    /// <returns>Returns the corresponding index or the map size when all the keys are less.</returns>
+    Index lowerBound(const KeyType& key) const {
+      return LowerBound(static_cast<const KeyType*>(this->keys), this->keys.getLength(), key, this->compare);
+    }
+    /// <summary>
+    /// Get the index of the first key that is greater than the specified key.
+    /// </summary>
+    /// <param name="key">Search key.</param>
+    /// <returns>Returns the corresponding index or the map size when no key is greater.</returns>
+    Index upperBound(const KeyType& key) const {
+      return UpperBound(static_cast<const KeyType*>(this->keys), this->keys.getLength(), key, this->compare);
+    }
+    /// <summary>
+    /// Get the ordered range of entries with keys from the given first key and before the given last key.
+    /// Use the indices with the getKeys and getValues views to iterate over the range.
+    /// </summary>
+    /// <param name="from">First key (inclusive).</param>
+    /// <param name="to">Last key (exclusive).</param>
+    /// <returns>Returns a pair with the first index (key) and the index after the last entry (value).</returns>
+    Pair<Index, Index> range(const KeyType& from, const KeyType& to) const {
+      const auto first = this->lowerBound(from);
+      return Pair<Index, Index>(first, Math::Max(first, this->lowerBound(to)));
+    }
+    /// <summary>
+    /// Set the specified key to map the given value by using move semantics.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <param name="value">Entry value.</param>
+    /// <returns>Returns the previous value for the given key.</returns>
+    V set(const K& key, ValueType&& value) override {
+      const auto index = this->lowerBound(key);
+      if (index < this->keys.getLength() && this->compare(*this->keys.get(index), key) == 0) {
+        auto* current = this->values.get(index);
+        V previous(Move(*current));
+        using SPL::Swap;
+        Swap(*current, value);
+        return previous;
+      }
+      this->insert(index, key, Move(value));
+      return V();
+    }
+    /// <summary>
+    /// Set the specified key using the given value.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <param name="value">Entry value.</param>
+    /// <returns>Returns the previous value for the given key.</returns>
+    V set(const K& key, const ValueType& value) override {
+      ValueType copy(value);
+      return this->set(key, Move(copy));
+    }
+    /// <summary>
+    /// Get the value that corresponds to the specified key.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <returns>Returns the corresponding entry value.</returns>
+    /// <exception cref="SPL::Exceptions::KeyNotFound">Throws when the specified key doesn't exists.</exception>
+    V& get(const K& key) const override {
+      const auto index = this->find(key);
+      if (index == -1) {
+        throw Exceptions::KeyNotFound<K>(key);
+      }
+      return *this->values.get(index);
+    }
+    /// <summary>
+    /// Get a copy of the value that corresponds to the specified key.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <param name="value">Output value.</param>
+    /// <returns>Returns true when the value was found, false otherwise.</returns>
+    bool get(const K& key, ValueType& value) const override {
+      const auto index = this->find(key);
+      if (index != -1) {
+        value = *this->values.get(index);
+        return true;
+      }
+      return false;
+    }
+    /// <summary>
+    /// Determines whether or not the map contains the specified key.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <returns>Returns true when the key was found, false otherwise.</returns>
+    bool has(const K& key) const override {
+      return this->find(key) != -1;
+    }
+    /// <summary>
+    /// Remove the specified key from the map.
+    /// When the map size is a quarter of its capacity, the current capacity will reduce by half.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <returns>Returns the removed value.</returns>
+    /// <exception cref="SPL::Exceptions::KeyNotFound">Throws when the specified key doesn't exists.</exception>
+    V remove(const K& key) override {
+      const auto index = this->find(key);
+      if (index == -1) {
+        throw Exceptions::KeyNotFound<K>(key);
+      }
+      return this->take(index);
+    }
+    /// <summary>
+    /// Remove the specified key from the map.
+    /// When the map size is a quarter of its capacity, the current capacity will reduce by half.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <param name="value">Output value.</param>
+    /// <returns>Returns true when the value was removed, false otherwise.</returns>
+    bool remove(const K& key, ValueType& value) override {
+      const auto index = this->find(key);
+      if (index != -1) {
+        value = this->take(index);
+        return true;
+      }
+      return false;
+    }
+    /// <summary>
+    /// Clear the map.
+    /// The current capacity will remains the same.
+    /// </summary>
+    void clear() override {
+      this->keys.clear();
+      this->values.clear();
+    }
+  public:
+    /// <summary>
+    /// Alias for the get method.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <returns>Returns the corresponding entry value.</returns>
+    const V& operator [](const K& key) const override {
+      return this->get(key);
+    }
+    /// <summary>
+    /// Get the value that corresponds to the specified key.
+    /// It creates a new entry when the given key doesn't exists.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <returns>Returns the corresponding entry value.</returns>
+    V& operator [](const K& key) override {
+      const auto index = this->lowerBound(key);
+      if (index < this->keys.getLength() && this->compare(*this->keys.get(index), key) == 0) {
+        return *this->values.get(index);
+      }
+      return this->insert(index, key, ValueType());
+    }
+    /// <summary>
+    /// Assign all properties from the given map.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    /// <returns>Returns the instance itself.</returns>
+    FlatMap& operator = (FlatMap other) noexcept {
+      Swap(*this, other);
+      return *this;
+    }
+  };
+}
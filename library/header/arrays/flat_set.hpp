@@ -0,0 +1,254 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#include "./types.hpp"
+#include "./basic_array.hpp"
+#include "./array_span.hpp"
+#include "./array_iterator.hpp"
+
+namespace SPL::Arrays {
+  /// <summary>
+  /// Flat set class.
+  /// The values are stored in a contiguous array in ascending order, so the searches are branchless binary searches
+  /// and the iteration follows the value order.
+  /// It's meant for sets that are built once and read often, adding or removing values costs O(n).
+  /// </summary>
+  /// <typeparam name="T">Value type.</typeparam>
+  /// <typeparam name="C">Comparator type.</typeparam>
+  template<typename T, typename C = Comparator<Metadata::ConstantType<T>>>
+  class FlatSet final : public Set<T>, public Iterable<T> {
+  private:
+    /// <summary>
+    /// Non-constant value type.
+    /// </summary>
+    using ValueType = Metadata::ConstantType<T>;
+    /// <summary>
+    /// Sorted values.
+    /// </summary>
+    BasicArray<T, 0> values;
+    /// <summary>
+    /// Comparator instance.
+    /// </summary>
+    C compare;
+  private:
+    /// <summary>
+    /// Exchange all properties from the given objects.
+    /// </summary>
+    /// <param name="source">Source object.</param>
+    /// <param name="target">Target object.</param>
+    friend void Swap(FlatSet& source, FlatSet& target) noexcept {
+      using SPL::Swap;
+      Swap(source.values, target.values);
+      Swap(source.compare, target.compare);
+    }
+    /// <summary>
+    /// Get the index of the specified value.
+    /// </summary>
+    /// <param name="value">Search value.</param>
+    /// <returns>Returns the corresponding index or -1 when the value wasn't found.</returns>
+    Index find(const ValueType& value) const {
+      return BinarySearch(static_cast<const ValueType*>(this->values), this->values.getLength(), value, this->compare);
+    }
+  public:
+    /// <summary>
+    /// Initialized constructor for capacity.
+    /// </summary>
+    /// <param name="capacity">Initial capacity.</param>
+    /// <param name="compare">Comparator instance.</param>
+    explicit FlatSet(const Size capacity, const C& compare = C()) :
+      values(NP2(capacity)), compare(compare) {}
+    /// <summary>
+    /// Initialized constructor for unsorted values.
+    /// The values are sorted once and the duplicate values are discarded.
+    /// </summary>
+    /// <param name="values">Initial values.</param>
+    /// <param name="compare">Comparator instance.</param>
+    explicit FlatSet(const ConstArraySpan<ValueType>& values, const C& compare = C()) :
+      FlatSet(values.getLength(), compare) {
+      this->values.insert(0, values.getData(), values.getLength());
+      this->values.sort(this->compare);
+      Index last = 0;
+      for (Index offset = 1; offset < this->values.getLength(); ++offset) {
+        auto* current = this->values.get(offset);
+        if (this->compare(*this->values.get(last), *current) != 0 && ++last != offset) {
+          *this->values.get(last) = Move(*current);
+        }
+      }
+      this->values.removeRange(last + 1, -1);
+    }
+    /// <summary>
+    /// Initialized constructor for unsorted values.
+    /// The values are sorted once and the duplicate values are discarded.
+    /// </summary>
+    /// <param name="values">Initial values.</param>
+    template<Size N>
+    FlatSet(const ValueType(&values)[N]) :
+      FlatSet(ConstArraySpan<ValueType>(values, N)) {}
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    FlatSet() :
+      values(), compare() {}
+    /// <summary>
+    /// Copy constructor.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    FlatSet(const FlatSet& other) :
+      values(other.values), compare(other.compare) {}
+    /// <summary>
+    /// Move constructor.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    FlatSet(FlatSet&& other) noexcept : FlatSet() {
+      Swap(*this, other);
+    }
+  public:
+    /// <summary>
+    /// Get the set capacity.
+    /// </summary>
+    /// <returns>Returns the set capacity.</returns>
+    Size getCapacity() const {
+      return this->values.getCapacity();
+    }
+    /// <summary>
+    /// Get the number of values in the set.
+    /// </summary>
+    /// <returns>Returns the set size.</returns>
+    Size getSize() const override {
+      return this->values.getLength();
+    }
+    /// <summary>
+    /// Determines whether or not the set is empty.
+    /// </summary>
+    /// <returns>Returns true when it's empty, false otherwise.</returns>
+    bool isEmpty() const override {
+      return this->values.getLength() == 0;
+    }
+    /// <summary>
+    /// Get a new iterator over the values in ascending order.
+    /// </summary>
+    /// <returns>Returns the new iterator.</returns>
+    UniqueIterator<T> getIterator() const override {
+      auto* iterator = new ArrayIterator<T, 0>(this->values);
+      return UniqueIterator<T>(iterator);
+    }
+    /// <summary>
+    /// Get a pointer to the first value in ascending order for range-based loops.
+    /// </summary>
+    /// <returns>Returns the pointer to the first value.</returns>
+    const ValueType* begin() const {
+      return this->values.begin();
+    }
+    /// <summary>
+    /// Get a pointer past the last value for range-based loops.
+    /// </summary>
+    /// <returns>Returns the pointer past the last value.</returns>
+    const ValueType* end() const {
+      return this->values.end();
+    }
+    /// <summary>
+    /// Get a read-only view of all the values in ascending order.
+    /// </summary>
+    /// <returns>Returns the span of the values.</returns>
+    ConstArraySpan<ValueType> getValues() const {
+      return this->values.view(0);
+    }
+    /// <summary>
+    /// Get the index of the first value that isn't less than the specified value.
+    /// </summary>
+    /// <param name="value">Search value.</param>
+    /// <returns>Returns the corresponding index or the set size when all the values are less.</returns>
+    Index lowerBound(const ValueType& value) const {
+      return LowerBound(static_cast<const ValueType*>(this->values), this->values.getLength(), value, this->compare);
+    }
+    /// <summary>
+    /// Get the index of the first value that is greater than the specified value.
+    /// </summary>
+    /// <param name="value">Search value.</param>
+    /// <returns>Returns the corresponding index or the set size when no value is greater.</returns>
+    Index upperBound(const ValueType& value) const {
+      return UpperBound(static_cast<const ValueType*>(this->values), this->values.getLength(), value, this->compare);
+    }
+    /// <summary>
+    /// Get the ordered range of values from the given first value and before the given last value.
+    /// Use the indices with the getValues view to iterate over the range.
+    /// </summary>
+    /// <param name="from">First value (inclusive).</param>
+    /// <param name="to">Last value (exclusive).</param>
+    /// <returns>Returns a pair with the first index (key) and the index after the last value (value).</returns>
+    Pair<Index, Index> range(const ValueType& from, const ValueType& to) const {
+      const auto first = this->lowerBound(from);
+      return Pair<Index, Index>(first, Math::Max(first, this->lowerBound(to)));
+    }
+    /// <summary>
+    /// Add the specified value in the set by using move semantics.
+    /// When the set is at its capacity, the current capacity will double.
+    /// </summary>
+    /// <param name="value">Value.</param>
+    void add(ValueType&& value) override {
+      const auto index = this->lowerBound(value);
+      if (index < this->values.getLength() && this->compare(*this->values.get(index), value) == 0) {
+        return;
+      }
+      const auto capacity = this->values.getCapacity();
+      if (this->values.getLength() == capacity) {
+        this->values.enlarge(capacity << 1);
+      }
+      this->values.add(index, Move(value));
+    }
+    /// <summary>
+    /// Add a copy of the specified value in the set.
+    /// When the set is at its capacity, the current capacity will double.
+    /// </summary>
+    /// <param name="value">Value.</param>
+    void add(const ValueType& value) override {
+      ValueType copy(value);
+      this->add(Move(copy));
+    }
+    /// <summary>
+    /// Determines whether or not the set contains the specified value.
+    /// </summary>
+    /// <param name="value">Value.</param>
+    /// <returns>Returns true when the value was found, false otherwise.</returns>
+    bool has(const ValueType& value) const override {
+      return this->find(value) != -1;
+    }
+    /// <summary>
+    /// Remove the specified value from the set.
+    /// When the set size is a quarter of its capacity, the current capacity will reduce by half.
+    /// </summary>
+    /// <param name="value">Value.</param>
+    /// <returns>Returns true when the value was removed, false otherwise.</returns>
+    bool remove(const ValueType& value) override {
+      const auto index = this->find(value);
+      if (index != -1) {
+        this->values.remove(index);
+        const auto capacity = this->values.getCapacity();
+        if (this->values.getLength() == capacity >> 2) {
+          this->values.shrink(capacity >> 1);
+        }
+        return true;
+      }
+      return false;
+    }
+    /// <summary>
+    /// Clear the set.
+    /// The current capacity will remains the same.
+    /// </summary>
+    void clear() override {
+      this->values.clear();
+    }
+  public:
+    /// <summary>
+    /// Assign all properties from the given set.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    /// <returns>Returns the instance itself.</returns>
+    FlatSet& operator = (FlatSet other) noexcept {
+      Swap(*this, other);
+      return *this;
+    }
+  };
+}
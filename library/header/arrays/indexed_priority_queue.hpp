@@ -0,0 +1,334 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#include "./types.hpp"
+
+namespace SPL::Arrays {
+  /// <summary>
+  /// Indexed priority queue class.
+  /// Each element is associated with a key in the range [0, keys) and the element of any key in the queue can be
+  /// updated or removed in O(log n), which is the decrease-key operation needed by schedulers and shortest path
+  /// searches. The keys are stored in a 4-ary heap and the top key is the one with the least element.
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  /// <typeparam name="C">Comparator type.</typeparam>
+  template<typename T, typename C = Comparator<Metadata::ConstantType<T>>>
+  class IndexedPriorityQueue final {
+  private:
+    /// <summary>
+    /// Non-constant element type.
+    /// </summary>
+    using ElementType = Metadata::ConstantType<T>;
+    /// <summary>
+    /// Number of children per node.
+    /// </summary>
+    constexpr static Size Arity = 4;
+    /// <summary>
+    /// Heap of keys (compact to keep more of the heap in cache).
+    /// </summary>
+    CompactIndex* heap;
+    /// <summary>
+    /// Heap position of each key (or -1 when the key isn't in the queue).
+    /// </summary>
+    CompactIndex* positions;
+    /// <summary>
+    /// Element of each key (constructed only when the key is in the queue).
+    /// </summary>
+    ElementType* elements;
+    /// <summary>
+    /// Number of keys.
+    /// </summary>
+    Size keys;
+    /// <summary>
+    /// Current number of elements.
+    /// </summary>
+    Size length;
+    /// <summary>
+    /// Comparator instance.
+    /// </summary>
+    C compare;
+  private:
+    /// <summary>
+    /// Exchange all properties from the given objects.
+    /// </summary>
+    /// <param name="source">Source object.</param>
+    /// <param name="target">Target object.</param>
+    friend void Swap(IndexedPriorityQueue& source, IndexedPriorityQueue& target) noexcept {
+      using SPL::Swap;
+      Swap(source.heap, target.heap);
+      Swap(source.positions, target.positions);
+      Swap(source.elements, target.elements);
+      Swap(source.keys, target.keys);
+      Swap(source.length, target.length);
+      Swap(source.compare, target.compare);
+    }
+    /// <summary>
+    /// Compare the elements of the given keys.
+    /// </summary>
+    /// <param name="source">Source key.</param>
+    /// <param name="target">Target key.</param>
+    /// <returns>Returns the comparison result.</returns>
+    int compareKeys(const Index source, const Index target) const {
+      return this->compare(this->elements[source], this->elements[target]);
+    }
+    /// <summary>
+    /// Move the key at the given position up until its parent isn't greater.
+    /// </summary>
+    /// <param name="position">Zero-based heap position.</param>
+    void siftUp(Index position) {
+      const auto key = this->heap[position];
+      while (position > 0) {
+        const auto parent = (position - 1) / Arity;
+        if (this->compareKeys(key, this->heap[parent]) >= 0) {
+          break;
+        }
+        this->heap[position] = this->heap[parent];
+        this->positions[this->heap[position]] = static_cast<CompactIndex>(position);
+        position = parent;
+      }
+      this->heap[position] = key;
+      this->positions[key] = static_cast<CompactIndex>(position);
+    }
+    /// <summary>
+    /// Move the key at the given position down until none of its children is less.
+    /// </summary>
+    /// <param name="position">Zero-based heap position.</param>
+    void siftDown(Index position) {
+      const auto key = this->heap[position];
+      for (auto first = position * Arity + 1; first < this->length; first = position * Arity + 1) {
+        const auto last = Math::Min(first + Arity, this->length);
+        auto least = first;
+        for (auto child = first + 1; child < last; ++child) {
+          if (this->compareKeys(this->heap[child], this->heap[least]) < 0) {
+            least = child;
+          }
+        }
+        if (this->compareKeys(this->heap[least], key) >= 0) {
+          break;
+        }
+        this->heap[position] = this->heap[least];
+        this->positions[this->heap[position]] = static_cast<CompactIndex>(position);
+        position = least;
+      }
+      this->heap[position] = key;
+      this->positions[key] = static_cast<CompactIndex>(position);
+    }
+    /// <summary>
+    /// Ensure the given key is in the queue.
+    /// </summary>
+    /// <param name="key">Element key.</param>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified key is out of bounds.</exception>
+    /// <exception cref="SPL::Exceptions::InvalidOperation">Throws when the specified key isn't in the queue.</exception>
+    void check(const Index key) const {
+      if (key >= this->keys) {
+        throw Exceptions::IndexOutOfBounds(key);
+      }
+      if (this->positions[key] == -1) {
+        throw Exceptions::InvalidOperation();
+      }
+    }
+  public:
+    /// <summary>
+    /// Initialized constructor for keys.
+    /// </summary>
+    /// <param name="keys">Number of keys.</param>
+    /// <param name="compare">Comparator instance.</param>
+    /// <exception cref="SPL::Exceptions::InvalidArgument">Throws when the number of keys exceeds the compact index range.</exception>
+    explicit IndexedPriorityQueue(const Size keys, const C& compare = C()) : IndexedPriorityQueue() {
+      if (keys >= static_cast<CompactIndex>(-1)) {
+        throw Exceptions::InvalidArgument();
+      }
+      if (keys > 0) {
+        this->heap = Allocate<CompactIndex>(keys);
+        this->positions = Allocate<CompactIndex>(keys);
+        this->elements = Allocate<ElementType>(keys);
+        this->keys = keys;
+        for (Index key = 0; key < keys; ++key) {
+          this->positions[key] = -1;
+        }
+      }
+      this->compare = compare;
+    }
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    IndexedPriorityQueue() :
+      heap(nullptr), positions(nullptr), elements(nullptr), keys(0), length(0), compare() {}
+    /// <summary>
+    /// Copy constructor.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    IndexedPriorityQueue(const IndexedPriorityQueue& other) : IndexedPriorityQueue(other.keys, other.compare) {
+      for (Index position = 0; position < other.length; ++position) {
+        const auto key = other.heap[position];
+        Construct(&this->elements[key], other.elements[key]);
+        this->heap[position] = key;
+        this->positions[key] = static_cast<CompactIndex>(position);
+        this->length++;
+      }
+    }
+    /// <summary>
+    /// Move constructor.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    IndexedPriorityQueue(IndexedPriorityQueue&& other) noexcept : IndexedPriorityQueue() {
+      Swap(*this, other);
+    }
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    ~IndexedPriorityQueue() {
+      if (this->keys > 0) {
+        this->clear();
+        Deallocate(this->heap);
+        Deallocate(this->positions);
+        Deallocate(this->elements);
+      }
+    }
+  public:
+    /// <summary>
+    /// Get the number of keys.
+    /// </summary>
+    /// <returns>Returns the number of keys.</returns>
+    Size getCapacity() const {
+      return this->keys;
+    }
+    /// <summary>
+    /// Get the number of elements in the queue.
+    /// </summary>
+    /// <returns>Returns the queue length.</returns>
+    Size getLength() const {
+      return this->length;
+    }
+    /// <summary>
+    /// Determines whether or not the queue is empty.
+    /// </summary>
+    /// <returns>Returns true when it's empty, false otherwise.</returns>
+    bool isEmpty() const {
+      return this->length == 0;
+    }
+    /// <summary>
+    /// Determines whether or not the specified key is in the queue.
+    /// </summary>
+    /// <param name="key">Element key.</param>
+    /// <returns>Returns true when the key is in the queue, false otherwise.</returns>
+    bool contains(const Index key) const {
+      return key < this->keys && this->positions[key] != -1;
+    }
+    /// <summary>
+    /// Get the element of the specified key.
+    /// </summary>
+    /// <param name="key">Element key.</param>
+    /// <returns>Returns the corresponding element.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified key is out of bounds.</exception>
+    /// <exception cref="SPL::Exceptions::InvalidOperation">Throws when the specified key isn't in the queue.</exception>
+    const T& get(const Index key) const {
+      this->check(key);
+      return this->elements[key];
+    }
+    /// <summary>
+    /// Push the specified key with a copy of the given element into the queue.
+    /// </summary>
+    /// <param name="key">Element key.</param>
+    /// <param name="element">New element.</param>
+    /// <returns>Returns the current length of the queue.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified key is out of bounds.</exception>
+    /// <exception cref="SPL::Exceptions::InvalidOperation">Throws when the specified key is already in the queue.</exception>
+    Size push(const Index key, const ElementType& element) {
+      if (key >= this->keys) {
+        throw Exceptions::IndexOutOfBounds(key);
+      }
+      if (this->positions[key] != -1) {
+        throw Exceptions::InvalidOperation();
+      }
+      Construct(&this->elements[key], element);
+      this->heap[this->length] = static_cast<CompactIndex>(key);
+      this->siftUp(this->length++);
+      return this->length;
+    }
+    /// <summary>
+    /// Replace the element of the specified key and restore its position (decrease or increase key).
+    /// </summary>
+    /// <param name="key">Element key.</param>
+    /// <param name="element">New element.</param>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified key is out of bounds.</exception>
+    /// <exception cref="SPL::Exceptions::InvalidOperation">Throws when the specified key isn't in the queue.</exception>
+    void update(const Index key, const ElementType& element) {
+      this->check(key);
+      const auto order = this->compare(element, this->elements[key]);
+      this->elements[key] = element;
+      if (order < 0) {
+        this->siftUp(this->positions[key]);
+      }
+      else if (order > 0) {
+        this->siftDown(this->positions[key]);
+      }
+    }
+    /// <summary>
+    /// Remove the specified key (and its element) from the queue.
+    /// </summary>
+    /// <param name="key">Element key.</param>
+    /// <returns>Returns true when the key was removed, false otherwise.</returns>
+    bool remove(const Index key) {
+      if (!this->contains(key)) {
+        return false;
+      }
+      const auto position = this->positions[key];
+      const auto last = this->heap[--this->length];
+      Destroy(&this->elements[key], 1);
+      this->positions[key] = -1;
+      if (last != key) {
+        this->heap[position] = last;
+        this->positions[last] = position;
+        this->siftUp(position);
+        this->siftDown(this->positions[last]);
+      }
+      return true;
+    }
+    /// <summary>
+    /// Get the top key (with the least element) of the queue.
+    /// </summary>
+    /// <returns>Returns the top key.</returns>
+    /// <exception cref="SPL::Exceptions::InvalidOperation">Throws when the queue is empty.</exception>
+    Index top() const {
+      if (this->length == 0) {
+        throw Exceptions::InvalidOperation();
+      }
+      return this->heap[0];
+    }
+    /// <summary>
+    /// Remove the top key (with the least element) of the queue.
+    /// Get its element (see the get method) before removing it to keep its value.
+    /// </summary>
+    /// <returns>Returns the removed key.</returns>
+    /// <exception cref="SPL::Exceptions::InvalidOperation">Throws when the queue is empty.</exception>
+    Index pop() {
+      const auto key = this->top();
+      this->remove(key);
+      return key;
+    }
+    /// <summary>
+    /// Clear the queue.
+    /// </summary>
+    void clear() {
+      for (Index position = 0; position < this->length; ++position) {
+        const auto key = this->heap[position];
+        Destroy(&this->elements[key], 1);
+        this->positions[key] = -1;
+      }
+      this->length = 0;
+    }
+  public:
+    /// <summary>
+    /// Assign all properties from the given queue.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    /// <returns>Returns the instance itself.</returns>
+    IndexedPriorityQueue& operator = (IndexedPriorityQueue other) noexcept {
+      Swap(*this, other);
+      return *this;
+    }
+  };
+}
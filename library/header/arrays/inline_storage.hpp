@@ -0,0 +1,46 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#include "./types.hpp"
+
+namespace SPL::Arrays {
+  /// <summary>
+  /// Inline storage class.
+  /// Provides uninitialized memory for N elements inside the owner object.
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  /// <typeparam name="N">Number of elements.</typeparam>
+  template<typename T, Size N>
+  class InlineStorage {
+  private:
+    /// <summary>
+    /// Uninitialized memory for the elements.
+    /// </summary>
+    alignas(T) unsigned char memory[sizeof(T) * N];
+  protected:
+    /// <summary>
+    /// Get the inline elements.
+    /// </summary>
+    /// <returns>Returns the inline elements.</returns>
+    T* getInline() {
+      return reinterpret_cast<T*>(this->memory);
+    }
+  };
+  /// <summary>
+  /// Inline storage class (without elements).
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  template<typename T>
+  class InlineStorage<T, 0> {
+  protected:
+    /// <summary>
+    /// Get the inline elements.
+    /// </summary>
+    /// <returns>Returns null, there's no inline element.</returns>
+    T* getInline() {
+      return nullptr;
+    }
+  };
+}
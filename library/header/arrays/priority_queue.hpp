@@ -0,0 +1,323 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#include "./types.hpp"
+#include "./basic_array.hpp"
+#include "./array_list.hpp"
+
+namespace SPL::Arrays {
+  /// <summary>
+  /// Priority queue class.
+  /// The elements are stored in a 4-ary heap, all the children of a node are adjacent in memory (usually in the same
+  /// cache line) and the heap is half as deep as a binary one. The top element is the least one for the comparator.
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  /// <typeparam name="C">Comparator type.</typeparam>
+  template<typename T, typename C = Comparator<Metadata::ConstantType<T>>>
+  class PriorityQueue final {
+  private:
+    /// <summary>
+    /// Basic array type.
+    /// </summary>
+    using BasicType = BasicArray<T, 0>;
+    /// <summary>
+    /// Non-constant element type.
+    /// </summary>
+    using ElementType = Metadata::ConstantType<T>;
+    /// <summary>
+    /// Number of children per node.
+    /// </summary>
+    constexpr static Size Arity = 4;
+    /// <summary>
+    /// Heap elements.
+    /// </summary>
+    BasicType array;
+    /// <summary>
+    /// Comparator instance.
+    /// </summary>
+    C compare;
+  private:
+    /// <summary>
+    /// Exchange all properties from the given objects.
+    /// </summary>
+    /// <param name="source">Source object.</param>
+    /// <param name="target">Target object.</param>
+    friend void Swap(PriorityQueue& source, PriorityQueue& target) noexcept {
+      using SPL::Swap;
+      Swap(source.array, target.array);
+      Swap(source.compare, target.compare);
+    }
+    /// <summary>
+    /// Enlarge the current capacity.
+    /// </summary>
+    void enlarge() {
+      const auto capacity = this->array.getCapacity();
+      if (this->array.getLength() == capacity) {
+        this->array.enlarge(capacity << 1);
+      }
+    }
+    /// <summary>
+    /// Shrink the current capacity.
+    /// </summary>
+    void shrink() {
+      const auto capacity = this->array.getCapacity();
+      if (this->array.getLength() == capacity >> 2) {
+        this->array.shrink(capacity >> 1);
+      }
+    }
+    /// <summary>
+    /// Move the element at the given index up until its parent isn't greater.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    void siftUp(Index index) {
+      auto* elements = this->array.get(0);
+      ElementType element(Move(elements[index]));
+      while (index > 0) {
+        const auto parent = (index - 1) / Arity;
+        if (this->compare(element, elements[parent]) >= 0) {
+          break;
+        }
+        elements[index] = Move(elements[parent]);
+        index = parent;
+      }
+      elements[index] = Move(element);
+    }
+    /// <summary>
+    /// Move the element at the given index down until none of its children is less.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    void siftDown(Index index) {
+      auto* elements = this->array.get(0);
+      const auto length = this->array.getLength();
+      ElementType element(Move(elements[index]));
+      for (auto first = index * Arity + 1; first < length; first = index * Arity + 1) {
+        const auto last = Math::Min(first + Arity, length);
+        auto least = first;
+        for (auto child = first + 1; child < last; ++child) {
+          if (this->compare(elements[child], elements[least]) < 0) {
+            least = child;
+          }
+        }
+        if (this->compare(elements[least], element) >= 0) {
+          break;
+        }
+        elements[index] = Move(elements[least]);
+        index = least;
+      }
+      elements[index] = Move(element);
+    }
+    /// <summary>
+    /// Restore the heap order of all the elements in O(n), from the last parent to the root.
+    /// </summary>
+    void heapify() {
+      const auto length = this->array.getLength();
+      if (length > 1) {
+        for (auto index = (length - 2) / Arity + 1; index-- > 0;) {
+          this->siftDown(index);
+        }
+      }
+    }
+  public:
+    /// <summary>
+    /// Initialized constructor for capacity.
+    /// </summary>
+    /// <param name="capacity">Initial capacity.</param>
+    /// <param name="compare">Comparator instance.</param>
+    explicit PriorityQueue(const Size capacity, const C& compare = C()) :
+      array(capacity), compare(compare) {}
+    /// <summary>
+    /// Initialized constructor for elements.
+    /// </summary>
+    /// <param name="elements">Initial elements.</param>
+    template<Size L>
+    PriorityQueue(const ElementType(&elements)[L]) : PriorityQueue(L) {
+      for (const auto& element : elements) {
+        this->array.add(this->array.getLength(), element);
+      }
+      this->heapify();
+    }
+    /// <summary>
+    /// Initialized constructor for a list (the heap is built in O(n)).
+    /// </summary>
+    /// <param name="list">Initial list.</param>
+    /// <param name="compare">Comparator instance.</param>
+    template<Size N>
+    explicit PriorityQueue(const ArrayList<T, N>& list, const C& compare = C()) :
+      PriorityQueue(list.getLength(), compare) {
+      for (Index index = 0; index < list.getLength(); ++index) {
+        this->array.add(index, list[index]);
+      }
+      this->heapify();
+    }
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    PriorityQueue() :
+      array(), compare() {}
+    /// <summary>
+    /// Copy constructor.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    PriorityQueue(const PriorityQueue& other) :
+      array(other.array), compare(other.compare) {}
+    /// <summary>
+    /// Move constructor.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    PriorityQueue(PriorityQueue&& other) noexcept : PriorityQueue() {
+      Swap(*this, other);
+    }
+  public:
+    /// <summary>
+    /// Get the capacity of the queue.
+    /// </summary>
+    /// <returns>Returns the queue capacity.</returns>
+    Size getCapacity() const {
+      return this->array.getCapacity();
+    }
+    /// <summary>
+    /// Get the number of elements in the queue.
+    /// </summary>
+    /// <returns>Returns the queue length.</returns>
+    Size getLength() const {
+      return this->array.getLength();
+    }
+    /// <summary>
+    /// Determines whether or not the queue is empty.
+    /// </summary>
+    /// <returns>Returns true when it's empty, false otherwise.</returns>
+    bool isEmpty() const {
+      return this->array.getLength() == 0;
+    }
+    /// <summary>
+    /// Construct a new element in the queue forwarding the specified arguments.
+    /// When the queue is at its capacity, the current capacity will be doubled.
+    /// </summary>
+    /// <typeparam name="...A">Argument types.</typeparam>
+    /// <param name="...arguments">Constructor arguments.</param>
+    /// <returns>Returns the current length of the queue.</returns>
+    template<typename ...A>
+    Size emplace(A&&... arguments) {
+      if (this->array.getLength() == this->array.getCapacity()) {
+        // Build the element before enlarging, the arguments may refer to the current elements.
+        ElementType element(Forward<A>(arguments)...);
+        this->enlarge();
+        return this->emplace(Move(element));
+      }
+      const auto index = this->array.getLength();
+      this->array.emplace(index, Forward<A>(arguments)...);
+      this->siftUp(index);
+      return index + 1;
+    }
+    /// <summary>
+    /// Push the specified element into the queue by using move semantics.
+    /// When the queue is at its capacity, the current capacity will be doubled.
+    /// </summary>
+    /// <param name="element">New element.</param>
+    /// <returns>Returns the current length of the queue.</returns>
+    Size push(ElementType&& element) {
+      return this->emplace(Move(element));
+    }
+    /// <summary>
+    /// Push a copy of the specified element into the queue.
+    /// When the queue is at its capacity, the current capacity will be doubled.
+    /// </summary>
+    /// <param name="element">New element.</param>
+    /// <returns>Returns the current length of the queue.</returns>
+    Size push(const ElementType& element) {
+      return this->emplace(element);
+    }
+    /// <summary>
+    /// Get the top (least) element of the queue.
+    /// </summary>
+    /// <returns>Returns the top element.</returns>
+    /// <exception cref="SPL::Exceptions::InvalidOperation">Throws when the queue is empty.</exception>
+    const T& top() const {
+      if (this->array.getLength() == 0) {
+        throw Exceptions::InvalidOperation();
+      }
+      return *this->array.get(0);
+    }
+    /// <summary>
+    /// Remove the top (least) element of the queue and move it into the given output.
+    /// When the queue length is 1/4 of the current capacity, the current capacity will be reduced by half.
+    /// </summary>
+    /// <param name="value">Output value.</param>
+    /// <returns>Returns true when the element was removed, false otherwise.</returns>
+    bool pop(ElementType& value) {
+      const auto length = this->array.getLength();
+      if (length == 0) {
+        return false;
+      }
+      auto* elements = this->array.get(0);
+      value = Move(elements[0]);
+      if (length > 1) {
+        elements[0] = Move(elements[length - 1]);
+      }
+      this->array.remove(length - 1);
+      if (length > 2) {
+        this->siftDown(0);
+      }
+      this->shrink();
+      return true;
+    }
+    /// <summary>
+    /// Remove the top (least) element of the queue.
+    /// When the queue length is 1/4 of the current capacity, the current capacity will be reduced by half.
+    /// </summary>
+    /// <returns>Returns the removed element.</returns>
+    /// <exception cref="SPL::Exceptions::InvalidOperation">Throws when the queue is empty.</exception>
+    T pop() {
+      const auto length = this->array.getLength();
+      if (length == 0) {
+        throw Exceptions::InvalidOperation();
+      }
+      auto* elements = this->array.get(0);
+      T value(Move(elements[0]));
+      if (length > 1) {
+        elements[0] = Move(elements[length - 1]);
+      }
+      this->array.remove(length - 1);
+      if (length > 2) {
+        this->siftDown(0);
+      }
+      this->shrink();
+      return value;
+    }
+    /// <summary>
+    /// Push the specified element and remove the top (least) element of the queue in a single sift.
+    /// When the given element isn't greater than the top element, it's returned and the queue remains the same.
+    /// </summary>
+    /// <param name="element">New element.</param>
+    /// <returns>Returns the removed element.</returns>
+    T pushPop(ElementType element) {
+      if (this->array.getLength() == 0 || this->compare(element, *this->array.get(0)) <= 0) {
+        return element;
+      }
+      auto* elements = this->array.get(0);
+      T value(Move(elements[0]));
+      elements[0] = Move(element);
+      this->siftDown(0);
+      return value;
+    }
+    /// <summary>
+    /// Clear the queue.
+    /// The current capacity will remains the same.
+    /// </summary>
+    void clear() {
+      this->array.clear();
+    }
+  public:
+    /// <summary>
+    /// Assign all properties from the given queue.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    /// <returns>Returns the instance itself.</returns>
+    PriorityQueue& operator = (PriorityQueue other) noexcept {
+      Swap(*this, other);
+      return *this;
+    }
+  };
+}
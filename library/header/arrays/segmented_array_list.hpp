@@ -0,0 +1,484 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#include <iterator>
+
+#include "./types.hpp"
+#include "./array_span.hpp"
+
+namespace SPL::Arrays {
+  /// <summary>
+  /// Segmented array list class declaration.
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  /// <typeparam name="C">Chunk length.</typeparam>
+  template<typename T, Size C>
+  class SegmentedArrayList;
+  /// <summary>
+  /// Segmented array list iterator class.
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  /// <typeparam name="C">Chunk length.</typeparam>
+  template<typename T, Size C>
+  class SegmentedArrayIterator : public Iterator<T> {
+  private:
+    /// <summary>
+    /// List reference.
+    /// </summary>
+    const SegmentedArrayList<T, C>& list;
+    /// <summary>
+    /// Current index.
+    /// </summary>
+    Index index;
+  public:
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    /// <param name="list">List reference.</param>
+    explicit SegmentedArrayIterator(const SegmentedArrayList<T, C>& list) :
+      list(list), index(0) {}
+  public:
+    /// <summary>
+    /// Determines whether or not there are more elements to iterate.
+    /// </summary>
+    /// <returns>Returns true when there are more elements, false otherwise.</returns>
+    bool hasNext() const override {
+      return this->index < this->list.getLength();
+    }
+    /// <summary>
+    /// Get the next element.
+    /// </summary>
+    /// <returns>Returns the next element.</returns>
+    /// <exception cref="SPL::Exceptions::InvalidOperation">Throws when there are no more elements.</exception>
+    const T& next() override {
+      if (!this->hasNext()) {
+        throw Exceptions::InvalidOperation();
+      }
+      return this->list[this->index++];
+    }
+  };
+  /// <summary>
+  /// Non-virtual segment iterator class for range-based loops and the standard algorithms.
+  /// It walks the elements of each chunk and moves to the next chunk at the chunk end.
+  /// </summary>
+  /// <typeparam name="E">Element type.</typeparam>
+  /// <typeparam name="C">Chunk length.</typeparam>
+  template<typename E, Size C>
+  class SegmentIterator final {
+  public:
+    /// <summary>
+    /// Iterator category (for the standard algorithms).
+    /// </summary>
+    using iterator_category = std::forward_iterator_tag;
+    /// <summary>
+    /// Iterator value type.
+    /// </summary>
+    using value_type = Metadata::ConstantType<E>;
+    /// <summary>
+    /// Iterator difference type.
+    /// </summary>
+    using difference_type = std::ptrdiff_t;
+    /// <summary>
+    /// Iterator pointer type.
+    /// </summary>
+    using pointer = E*;
+    /// <summary>
+    /// Iterator reference type.
+    /// </summary>
+    using reference = E&;
+  private:
+    /// <summary>
+    /// Current chunk.
+    /// </summary>
+    value_type* const* chunk;
+    /// <summary>
+    /// Current offset in the chunk.
+    /// </summary>
+    Index offset;
+  public:
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    SegmentIterator() :
+      chunk(nullptr), offset(0) {}
+    /// <summary>
+    /// Initialized constructor.
+    /// </summary>
+    /// <param name="chunk">Current chunk.</param>
+    /// <param name="offset">Current offset in the chunk.</param>
+    SegmentIterator(value_type* const* const chunk, const Index offset) :
+      chunk(chunk), offset(offset) {}
+  public:
+    /// <summary>
+    /// Get the current element.
+    /// </summary>
+    /// <returns>Returns the current element.</returns>
+    E& operator *() const {
+      return (*this->chunk)[this->offset];
+    }
+    /// <summary>
+    /// Get the current element.
+    /// </summary>
+    /// <returns>Returns a pointer to the current element.</returns>
+    E* operator ->() const {
+      return &(*this->chunk)[this->offset];
+    }
+    /// <summary>
+    /// Move to the next element.
+    /// </summary>
+    /// <returns>Returns the iterator itself.</returns>
+    SegmentIterator& operator ++() {
+      if (++this->offset == C) {
+        this->chunk++;
+        this->offset = 0;
+      }
+      return *this;
+    }
+    /// <summary>
+    /// Move to the next element.
+    /// </summary>
+    /// <returns>Returns a copy of the iterator before moving.</returns>
+    SegmentIterator operator ++(int) {
+      auto previous = *this;
+      ++*this;
+      return previous;
+    }
+    /// <summary>
+    /// Check whether or not both iterators are at the same element.
+    /// </summary>
+    /// <param name="other">Other iterator.</param>
+    /// <returns>Returns true when both are at the same element, false otherwise.</returns>
+    bool operator == (const SegmentIterator& other) const {
+      return this->chunk == other.chunk && this->offset == other.offset;
+    }
+    /// <summary>
+    /// Check whether or not the iterators are at different elements.
+    /// </summary>
+    /// <param name="other">Other iterator.</param>
+    /// <returns>Returns true when they're at different elements, false otherwise.</returns>
+    bool operator != (const SegmentIterator& other) const {
+      return !(*this == other);
+    }
+  };
+  /// <summary>
+  /// Segmented array list class.
+  /// The elements are stored in fixed-length chunks, so growing the list only allocates a new chunk, the existing
+  /// elements are never moved and their addresses remain stable until they're removed.
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  /// <typeparam name="C">Chunk length (power of two).</typeparam>
+  template<typename T, Size C = 1024>
+  class SegmentedArrayList final : public Iterable<T> {
+  private:
+    static_assert(C > 0 && (C & (C - 1)) == 0, "The chunk length must be a power of two.");
+    /// <summary>
+    /// Non-constant element type.
+    /// </summary>
+    using ElementType = Metadata::ConstantType<T>;
+    /// <summary>
+    /// Chunk index.
+    /// </summary>
+    ElementType** chunks;
+    /// <summary>
+    /// Capacity of the chunk index.
+    /// </summary>
+    Size capacity;
+    /// <summary>
+    /// Number of allocated chunks.
+    /// </summary>
+    Size count;
+    /// <summary>
+    /// Current number of elements.
+    /// </summary>
+    Size length;
+  private:
+    /// <summary>
+    /// Exchange all properties from the given objects.
+    /// </summary>
+    /// <param name="source">Source object.</param>
+    /// <param name="target">Target object.</param>
+    friend void Swap(SegmentedArrayList& source, SegmentedArrayList& target) noexcept {
+      using SPL::Swap;
+      Swap(source.chunks, target.chunks);
+      Swap(source.capacity, target.capacity);
+      Swap(source.count, target.count);
+      Swap(source.length, target.length);
+    }
+    /// <summary>
+    /// Get the element memory that corresponds to the given index.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <returns>Returns the element memory.</returns>
+    ElementType* locate(const Index index) const {
+      return &this->chunks[index / C][index % C];
+    }
+    /// <summary>
+    /// Allocate a new chunk when the list is at its capacity.
+    /// Only the chunk index is reallocated (when it's full), the elements are never moved.
+    /// </summary>
+    void enlarge() {
+      if (this->length == this->count * C) {
+        if (this->count == this->capacity) {
+          const auto capacity = Math::Max<Size>(this->capacity << 1, 4);
+          auto* chunks = new ElementType*[capacity];
+          MemoryCopy(this->chunks, chunks, this->count);
+          delete[] this->chunks;
+          this->chunks = chunks;
+          this->capacity = capacity;
+        }
+        this->chunks[this->count++] = Allocate<ElementType>(C);
+      }
+    }
+    /// <summary>
+    /// Deallocate the last chunks keeping only one empty chunk after the elements.
+    /// </summary>
+    void shrink() {
+      while (this->count > 1 && this->length + C * 2 <= this->count * C) {
+        Deallocate(this->chunks[--this->count]);
+      }
+    }
+  public:
+    /// <summary>
+    /// Initialized constructor for elements.
+    /// </summary>
+    /// <param name="elements">Initial elements.</param>
+    template<Size L>
+    SegmentedArrayList(const ElementType(&elements)[L]) : SegmentedArrayList() {
+      for (const auto& element : elements) {
+        this->add(element);
+      }
+    }
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    SegmentedArrayList() :
+      chunks(nullptr), capacity(0), count(0), length(0) {}
+    /// <summary>
+    /// Copy constructor.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    SegmentedArrayList(const SegmentedArrayList& other) : SegmentedArrayList() {
+      for (Index index = 0; index < other.length; ++index) {
+        this->add(*other.locate(index));
+      }
+    }
+    /// <summary>
+    /// Move constructor.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    SegmentedArrayList(SegmentedArrayList&& other) noexcept : SegmentedArrayList() {
+      Swap(*this, other);
+    }
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    ~SegmentedArrayList() {
+      this->clear();
+      for (Size chunk = 0; chunk < this->count; ++chunk) {
+        Deallocate(this->chunks[chunk]);
+      }
+      delete[] this->chunks;
+    }
+  public:
+    /// <summary>
+    /// Get the capacity of the list (allocated chunks times the chunk length).
+    /// </summary>
+    /// <returns>Returns the list capacity.</returns>
+    Size getCapacity() const {
+      return this->count * C;
+    }
+    /// <summary>
+    /// Get the number of elements in the list.
+    /// </summary>
+    /// <returns>Returns the list length.</returns>
+    Size getLength() const {
+      return this->length;
+    }
+    /// <summary>
+    /// Determines whether or not the list is empty.
+    /// </summary>
+    /// <returns>Returns true when it's empty, false otherwise.</returns>
+    bool isEmpty() const {
+      return this->length == 0;
+    }
+    /// <summary>
+    /// Get the number of chunks with elements.
+    /// </summary>
+    /// <returns>Returns the number of chunks.</returns>
+    Size getChunkCount() const {
+      return (this->length + (C - 1)) / C;
+    }
+    /// <summary>
+    /// Get a view of all the elements in the specified chunk.
+    /// Iterating over the chunks is the fastest way to visit all the elements.
+    /// </summary>
+    /// <param name="chunk">Zero-based chunk index.</param>
+    /// <returns>Returns the span of the corresponding elements.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified chunk is out of bounds.</exception>
+    ArraySpan<T> getChunk(const Index chunk) const {
+      if (chunk >= this->getChunkCount()) {
+        throw Exceptions::IndexOutOfBounds(chunk);
+      }
+      return ArraySpan<T>(this->chunks[chunk], Math::Min(this->length - chunk * C, C));
+    }
+    /// <summary>
+    /// Get a new list iterator.
+    /// </summary>
+    /// <returns>Returns the new iterator.</returns>
+    UniqueIterator<T> getIterator() const override {
+      auto* iterator = new SegmentedArrayIterator<T, C>(*this);
+      return UniqueIterator<T>(iterator);
+    }
+    /// <summary>
+    /// Get an iterator at the first element for range-based loops.
+    /// The iterator is invalidated when its chunk is released.
+    /// </summary>
+    /// <returns>Returns the segment iterator.</returns>
+    SegmentIterator<const T, C> begin() const {
+      return SegmentIterator<const T, C>(this->chunks, 0);
+    }
+    /// <summary>
+    /// Get an iterator past the last element for range-based loops.
+    /// </summary>
+    /// <returns>Returns the segment iterator.</returns>
+    SegmentIterator<const T, C> end() const {
+      return SegmentIterator<const T, C>(this->chunks + this->length / C, this->length % C);
+    }
+    /// <summary>
+    /// Get an iterator at the first element for range-based loops.
+    /// The iterator is invalidated when its chunk is released.
+    /// </summary>
+    /// <returns>Returns the segment iterator.</returns>
+    SegmentIterator<T, C> begin() {
+      return SegmentIterator<T, C>(this->chunks, 0);
+    }
+    /// <summary>
+    /// Get an iterator past the last element for range-based loops.
+    /// </summary>
+    /// <returns>Returns the segment iterator.</returns>
+    SegmentIterator<T, C> end() {
+      return SegmentIterator<T, C>(this->chunks + this->length / C, this->length % C);
+    }
+    /// <summary>
+    /// Construct a new element at the end of the list forwarding the specified arguments.
+    /// When the list is at its capacity, a new chunk is allocated.
+    /// </summary>
+    /// <typeparam name="...A">Argument types.</typeparam>
+    /// <param name="...arguments">Constructor arguments.</param>
+    /// <returns>Returns the new element.</returns>
+    template<typename ...A>
+    T& emplace(A&&... arguments) {
+      this->enlarge();
+      auto* element = Construct(this->locate(this->length), Forward<A>(arguments)...);
+      this->length++;
+      return *element;
+    }
+    /// <summary>
+    /// Add the specified element at the end of the list by using move semantics.
+    /// When the list is at its capacity, a new chunk is allocated.
+    /// </summary>
+    /// <param name="element">New element.</param>
+    /// <returns>Returns the current length of the list.</returns>
+    Size add(ElementType&& element) {
+      this->emplace(Move(element));
+      return this->length;
+    }
+    /// <summary>
+    /// Add a copy of the specified element at the end of the list.
+    /// When the list is at its capacity, a new chunk is allocated.
+    /// </summary>
+    /// <param name="element">New element.</param>
+    /// <returns>Returns the current length of the list.</returns>
+    Size add(const ElementType& element) {
+      this->emplace(element);
+      return this->length;
+    }
+    /// <summary>
+    /// Remove the last element of the list.
+    /// Empty chunks are deallocated, except the one right after the elements.
+    /// </summary>
+    /// <returns>Returns the removed element.</returns>
+    /// <exception cref="SPL::Exceptions::InvalidOperation">Throws when the list is empty.</exception>
+    T removeLast() {
+      if (this->length == 0) {
+        throw Exceptions::InvalidOperation();
+      }
+      auto* element = this->locate(this->length - 1);
+      T value(Move(*element));
+      Destroy(element, 1);
+      this->length--;
+      this->shrink();
+      return value;
+    }
+    /// <summary>
+    /// Get the first index occurrence of the specified element in the list.
+    /// </summary>
+    /// <param name="search">Search element.</param>
+    /// <param name="from">From the zero-based index.</param>
+    /// <returns>Returns the corresponding index or -1 when the element wasn't found.</returns>
+    Index indexOf(const T& search, const Index from = 0) const {
+      for (auto start = from; start < this->length; start += C - start % C) {
+        const auto available = Math::Min(C - start % C, this->length - start);
+        const auto index = Find<ElementType>(this->locate(start), available, search);
+        if (index != -1) {
+          return start + index;
+        }
+      }
+      return -1;
+    }
+    /// <summary>
+    /// Determines whether or not the list contains the specified element.
+    /// </summary>
+    /// <param name="search">Search element.</param>
+    /// <returns>Returns true when the element was found, false otherwise.</returns>
+    bool contains(const T& search) const {
+      return this->indexOf(search) != -1;
+    }
+    /// <summary>
+    /// Clear the list.
+    /// </summary>
+    void clear() {
+      for (Size chunk = 0; chunk < this->getChunkCount(); ++chunk) {
+        Destroy(this->chunks[chunk], Math::Min(this->length - chunk * C, C));
+      }
+      this->length = 0;
+      this->shrink();
+    }
+  public:
+    /// <summary>
+    /// Get the element that corresponds to the specified index.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <returns>Returns the corresponding element.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    const T& operator [](const Index index) const {
+      if (index >= this->length) {
+        throw Exceptions::IndexOutOfBounds(index);
+      }
+      return *this->locate(index);
+    }
+    /// <summary>
+    /// Get the element that corresponds to the specified index.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <returns>Returns the corresponding element.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    T& operator [](const Index index) {
+      if (index >= this->length) {
+        throw Exceptions::IndexOutOfBounds(index);
+      }
+      return *this->locate(index);
+    }
+    /// <summary>
+    /// Assign all properties from the given list.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    /// <returns>Returns the instance itself.</returns>
+    SegmentedArrayList& operator = (SegmentedArrayList other) noexcept {
+      Swap(*this, other);
+      return *this;
+    }
+  };
+}
@@ -0,0 +1,497 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#include "./types.hpp"
+#include "./array_list.hpp"
+#include "./array_span.hpp"
+
+namespace SPL::Arrays {
+  /// <summary>
+  /// Shared array list class (copy-on-write).
+  /// The elements are stored in a reference-counted array list shared by all the copies, so copying the list is O(1)
+  /// and the elements are cloned only on the first change of a shared copy.
+  /// Once a mutable element reference is handed out, the elements are no longer shared and copies are deep.
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  template<typename T>
+  class SharedArrayList final : public List<T>, public Iterable<T> {
+  private:
+    /// <summary>
+    /// Non-constant element type.
+    /// </summary>
+    using ElementType = Metadata::ConstantType<T>;
+    /// <summary>
+    /// Shared storage class.
+    /// </summary>
+    class Storage final {
+    public:
+      /// <summary>
+      /// Number of references.
+      /// </summary>
+      volatile Size references;
+      /// <summary>
+      /// Array list.
+      /// </summary>
+      ArrayList<T> list;
+      /// <summary>
+      /// Determines whether or not the list can be shared (false once a mutable element reference was handed out).
+      /// </summary>
+      bool shareable;
+    public:
+      /// <summary>
+      /// Initialized constructor.
+      /// </summary>
+      /// <param name="list">Initial list.</param>
+      explicit Storage(const ArrayList<T>& list) :
+        references(1), list(list), shareable(true) {}
+      /// <summary>
+      /// Initialized constructor.
+      /// </summary>
+      /// <param name="list">Initial list.</param>
+      explicit Storage(ArrayList<T>&& list) :
+        references(1), list(Move(list)), shareable(true) {}
+    };
+    /// <summary>
+    /// Current storage (or null when the list was never changed).
+    /// It's mutable because handing out a mutable element reference from a constant list must unshare it.
+    /// </summary>
+    mutable Storage* storage;
+  private:
+    /// <summary>
+    /// Exchange all properties from the given objects.
+    /// </summary>
+    /// <param name="source">Source object.</param>
+    /// <param name="target">Target object.</param>
+    friend void Swap(SharedArrayList& source, SharedArrayList& target) noexcept {
+      using SPL::Swap;
+      Swap(source.storage, target.storage);
+    }
+    /// <summary>
+    /// Release one reference of the given storage and delete it when there are no more references.
+    /// </summary>
+    /// <param name="storage">Storage pointer.</param>
+    static void Release(Storage* const storage) {
+      if (storage != nullptr && AtomicDecrement(storage->references) == 0) {
+        delete storage;
+      }
+    }
+    /// <summary>
+    /// Get the empty list shared by all the lists without storage.
+    /// </summary>
+    /// <returns>Returns the empty list.</returns>
+    static const ArrayList<T>& Empty() {
+      static const ArrayList<T> list;
+      return list;
+    }
+    /// <summary>
+    /// Get the current list for reading.
+    /// </summary>
+    /// <returns>Returns the current list.</returns>
+    const ArrayList<T>& read() const {
+      return this->storage != nullptr ? this->storage->list : Empty();
+    }
+    /// <summary>
+    /// Get the current list for writing, cloning it first when it's shared with other lists.
+    /// </summary>
+    /// <returns>Returns the current list.</returns>
+    ArrayList<T>& write() {
+      if (this->storage == nullptr) {
+        this->storage = new Storage(ArrayList<T>());
+      }
+      else if (this->storage->references > 1) {
+        auto* storage = new Storage(this->storage->list);
+        Release(this->storage);
+        this->storage = storage;
+      }
+      return this->storage->list;
+    }
+    /// <summary>
+    /// Get the current list for writing and mark it as unshareable, since the caller may keep element references.
+    /// </summary>
+    /// <returns>Returns the current list.</returns>
+    ArrayList<T>& expose() const {
+      auto& list = const_cast<SharedArrayList*>(this)->write();
+      this->storage->shareable = false;
+      return list;
+    }
+  public:
+    /// <summary>
+    /// Initialized constructor for capacity.
+    /// </summary>
+    /// <param name="capacity">Initial capacity.</param>
+    explicit SharedArrayList(const Size capacity) :
+      storage(new Storage(ArrayList<T>(capacity))) {}
+    /// <summary>
+    /// Initialized constructor for elements.
+    /// </summary>
+    /// <param name="elements">Initial elements.</param>
+    template<Size L>
+    SharedArrayList(const ElementType(&elements)[L]) :
+      storage(new Storage(ArrayList<T>(elements))) {}
+    /// <summary>
+    /// Initialized constructor for a list.
+    /// </summary>
+    /// <param name="list">Initial list.</param>
+    explicit SharedArrayList(const ArrayList<T>& list) :
+      storage(new Storage(list)) {}
+    /// <summary>
+    /// Initialized constructor for a list by using move semantics.
+    /// </summary>
+    /// <param name="list">Initial list.</param>
+    explicit SharedArrayList(ArrayList<T>&& list) :
+      storage(new Storage(Move(list))) {}
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    SharedArrayList() :
+      storage(nullptr) {}
+    /// <summary>
+    /// Copy constructor.
+    /// The elements are shared until one of the lists is changed, unless they're unshareable.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    SharedArrayList(const SharedArrayList& other) :
+      storage(other.storage) {
+      if (this->storage != nullptr) {
+        if (this->storage->shareable) {
+          AtomicIncrement(this->storage->references);
+        }
+        else {
+          this->storage = new Storage(other.storage->list);
+        }
+      }
+    }
+    /// <summary>
+    /// Move constructor.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    SharedArrayList(SharedArrayList&& other) noexcept : SharedArrayList() {
+      Swap(*this, other);
+    }
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    ~SharedArrayList() {
+      Release(this->storage);
+    }
+  public:
+    /// <summary>
+    /// Get the capacity of the array.
+    /// </summary>
+    /// <returns>Returns the array capacity.</returns>
+    Size getCapacity() const {
+      return this->read().getCapacity();
+    }
+    /// <summary>
+    /// Get the number of elements in the array.
+    /// </summary>
+    /// <returns>Returns the array length.</returns>
+    Size getLength() const override {
+      return this->read().getLength();
+    }
+    /// <summary>
+    /// Determines whether or not the array is empty.
+    /// </summary>
+    /// <returns>Returns true when it's empty, false otherwise.</returns>
+    bool isEmpty() const override {
+      return this->read().isEmpty();
+    }
+    /// <summary>
+    /// Determines whether or not the elements are shared with other lists.
+    /// </summary>
+    /// <returns>Returns true when they're shared, false otherwise.</returns>
+    bool isShared() const {
+      return this->storage != nullptr && this->storage->references > 1;
+    }
+    /// <summary>
+    /// Get a new array iterator.
+    /// The iterator is invalidated by any change in the list.
+    /// </summary>
+    /// <returns>Returns the new iterator.</returns>
+    UniqueIterator<T> getIterator() const override {
+      return this->read().getIterator();
+    }
+    /// <summary>
+    /// Get a pointer to the first element for range-based loops.
+    /// Only read access is provided so that iterating never clones shared elements.
+    /// </summary>
+    /// <returns>Returns the pointer to the first element.</returns>
+    const T* begin() const {
+      return this->read().begin();
+    }
+    /// <summary>
+    /// Get a pointer past the last element for range-based loops.
+    /// </summary>
+    /// <returns>Returns the pointer past the last element.</returns>
+    const T* end() const {
+      return this->read().end();
+    }
+    /// <summary>
+    /// Add the specified element at the end of the array by using move semantics.
+    /// The elements are cloned first when they're shared with other lists.
+    /// </summary>
+    /// <param name="element">New element.</param>
+    /// <returns>Returns the current length of the array.</returns>
+    Size add(ElementType&& element) override {
+      return this->write().add(Forward<ElementType>(element));
+    }
+    /// <summary>
+    /// Add a copy of the specified element at the end of the array.
+    /// The elements are cloned first when they're shared with other lists.
+    /// </summary>
+    /// <param name="element">New element.</param>
+    /// <returns>Returns the current length of the array.</returns>
+    Size add(const ElementType& element) override {
+      return this->write().add(element);
+    }
+    /// <summary>
+    /// Add the specified element at the specified index by using move semantics.
+    /// The elements are cloned first when they're shared with other lists.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <param name="element">New element.</param>
+    /// <returns>Returns the current length of the array.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    Size add(const Index index, ElementType&& element) override {
+      if (index > this->getLength()) {
+        throw Exceptions::IndexOutOfBounds(index);
+      }
+      return this->write().add(index, Forward<ElementType>(element));
+    }
+    /// <summary>
+    /// Add a copy of the specified element at the specified index.
+    /// The elements are cloned first when they're shared with other lists.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <param name="element">New element.</param>
+    /// <returns>Returns the current length of the array.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    Size add(const Index index, const ElementType& element) override {
+      if (index > this->getLength()) {
+        throw Exceptions::IndexOutOfBounds(index);
+      }
+      return this->write().add(index, element);
+    }
+    /// <summary>
+    /// Add a copy of all the elements from the given span at the end of the array.
+    /// The elements are cloned first when they're shared with other lists.
+    /// </summary>
+    /// <param name="span">Span of elements.</param>
+    /// <returns>Returns the current length of the array.</returns>
+    Size append(const ConstArraySpan<ElementType>& span) {
+      return this->write().append(span);
+    }
+    /// <summary>
+    /// Replace the element at the specified index with the given one by using move semantics.
+    /// The elements are cloned first when they're shared with other lists.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <param name="element">New element.</param>
+    /// <returns>Returns the replaced element.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    T set(const Index index, ElementType&& element) override {
+      if (index >= this->getLength()) {
+        throw Exceptions::IndexOutOfBounds(index);
+      }
+      return this->write().set(index, Forward<ElementType>(element));
+    }
+    /// <summary>
+    /// Replace the element at the specified index with a copy of the given one.
+    /// The elements are cloned first when they're shared with other lists.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <param name="element">Element.</param>
+    /// <returns>Returns the replaced element.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    T set(const Index index, const ElementType& element) override {
+      ElementType copy(element);
+      return this->set(index, Move(copy));
+    }
+    /// <summary>
+    /// Merge all the given list into a new array.
+    /// </summary>
+    /// <param name="pack">Pack of lists.</param>
+    /// <returns>Returns the new array.</returns>
+    UniqueList<T> concat(const ListPack<T>& pack) const override {
+      return this->read().concat(pack);
+    }
+    /// <summary>
+    /// Get the element that corresponds to the specified index.
+    /// The elements are cloned first when they're shared with other lists and they're no longer shared after that.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <returns>Returns the corresponding element.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    T& get(const Index index) const override {
+      if (index >= this->getLength()) {
+        throw Exceptions::IndexOutOfBounds(index);
+      }
+      return this->expose().get(index);
+    }
+    /// <summary>
+    /// Get a copy of the element that corresponds to the specified index.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <param name="element">Output element.</param>
+    /// <returns>Returns true when the element was found, false otherwise.</returns>
+    bool get(const Index index, ElementType& element) const override {
+      return this->read().get(index, element);
+    }
+    /// <summary>
+    /// Get the first index occurrence of the specified element in the array.
+    /// </summary>
+    /// <param name="search">Search element.</param>
+    /// <param name="from">From the zero-based index.</param>
+    /// <returns>Returns the corresponding index or -1 when the element wasn't found.</returns>
+    Index indexOf(const T& search, const Index from = 0) const override {
+      return this->read().indexOf(search, from);
+    }
+    /// <summary>
+    /// Get the last index occurrence of the specified element in the array.
+    /// </summary>
+    /// <param name="search">Search element.</param>
+    /// <param name="from">From the zero-based index.</param>
+    /// <returns>Returns the corresponding index or -1 when the element wasn't found.</returns>
+    Index lastIndexOf(const T& search, const Index from = -1) const override {
+      return this->read().lastIndexOf(search, from);
+    }
+    /// <summary>
+    /// Determines whether or not the array contains the specified element.
+    /// </summary>
+    /// <param name="search">Search element.</param>
+    /// <returns>Returns true when the element was found, false otherwise.</returns>
+    bool contains(const T& search) const override {
+      return this->read().contains(search);
+    }
+    /// <summary>
+    /// Remove the element that corresponds to the specified index from the array.
+    /// The elements are cloned first when they're shared with other lists.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <returns>Returns the removed element.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    T remove(const Index index) override {
+      if (index >= this->getLength()) {
+        throw Exceptions::IndexOutOfBounds(index);
+      }
+      return this->write().remove(index);
+    }
+    /// <summary>
+    /// Remove the element that corresponds to the specified index from the array.
+    /// The elements are cloned first when they're shared with other lists.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <param name="element">Output element.</param>
+    /// <returns>Returns true when the element was removed, false otherwise.</returns>
+    bool remove(const Index index, ElementType& element) override {
+      if (index >= this->getLength()) {
+        return false;
+      }
+      return this->write().remove(index, element);
+    }
+    /// <summary>
+    /// Remove the first occurrence of the specified element from the array.
+    /// The elements are cloned first when they're shared with other lists.
+    /// </summary>
+    /// <param name="element">Element reference.</param>
+    /// <returns>Returns true when the element was removed, false otherwise.</returns>
+    bool remove(ElementType& element) override {
+      if (!this->contains(element)) {
+        return false;
+      }
+      return this->write().remove(element);
+    }
+    /// <summary>
+    /// Slice a portion of the array based on the given range and generate a new one.
+    /// </summary>
+    /// <param name="from">From the zero-based index.</param>
+    /// <param name="to">To the zero-based index.</param>
+    /// <returns>Returns the generated array.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    UniqueList<T> slice(const Index from, const Index to = -1) const override {
+      return this->read().slice(from, to);
+    }
+    /// <summary>
+    /// Get a read-only view of a portion of the array based on the given range (without copying).
+    /// The view is invalidated by any change in the list.
+    /// </summary>
+    /// <param name="from">From the zero-based index.</param>
+    /// <param name="to">To the zero-based index.</param>
+    /// <returns>Returns the span of the corresponding elements.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    ConstArraySpan<ElementType> view(const Index from = 0, const Index to = -1) const {
+      return this->read().view(from, to);
+    }
+    /// <summary>
+    /// Sort the array.
+    /// The elements are cloned first when they're shared with other lists.
+    /// </summary>
+    void sort() override {
+      this->write().sort();
+    }
+    /// <summary>
+    /// Sort the array using the given comparator.
+    /// The elements are cloned first when they're shared with other lists.
+    /// </summary>
+    /// <typeparam name="C">Comparator type.</typeparam>
+    /// <param name="compare">Comparator instance.</param>
+    template<typename C>
+    void sort(const C& compare) {
+      this->write().sort(compare);
+    }
+    /// <summary>
+    /// Reverse the array (in-place).
+    /// The elements are cloned first when they're shared with other lists.
+    /// </summary>
+    void reverse() override {
+      this->write().reverse();
+    }
+    /// <summary>
+    /// Clear the array.
+    /// When the elements are shared with other lists, they're released instead of cloned.
+    /// </summary>
+    void clear() override {
+      if (this->isShared()) {
+        Release(this->storage);
+        this->storage = nullptr;
+      }
+      else if (this->storage != nullptr) {
+        this->storage->list.clear();
+      }
+    }
+  public:
+    /// <summary>
+    /// Get the element that corresponds to the specified index.
+    /// </summary>
+    /// <param name="index">Zero based index.</param>
+    /// <returns>Returns the corresponding element.</returns>
+    const T& operator [](const Index index) const override {
+      return this->read().get(index);
+    }
+    /// <summary>
+    /// Get the element that corresponds to the specified index.
+    /// The elements are cloned first when they're shared with other lists and they're no longer shared after that.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <returns>Returns the corresponding element.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    T& operator [](const Index index) override {
+      if (index >= this->getLength()) {
+        throw Exceptions::IndexOutOfBounds(index);
+      }
+      return this->expose().get(index);
+    }
+    /// <summary>
+    /// Assign all properties from the given list.
+    /// The elements are shared until one of the lists is changed.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    /// <returns>Returns the instance itself.</returns>
+    SharedArrayList& operator = (SharedArrayList other) noexcept {
+      Swap(*this, other);
+      return *this;
+    }
+  };
+}
@@ -16,13 +16,15 @@ namespace SPL::Arrays {
   /// Basic array class declaration.
   /// </summary>
   /// <typeparam name="T">Element type.</typeparam>
-  template<typename T>
+  /// <typeparam name="N">Inline capacity.</typeparam>
+  template<typename T, Size N = 0>
   class BasicArray;
   /// <summary>
   /// Array iterator class declaration.
   /// </summary>
   /// <typeparam name="T">Element type.</typeparam>
-  template<typename T>
+  /// <typeparam name="N">Inline capacity.</typeparam>
+  template<typename T, Size N = 0>
   class ArrayIterator;
   /// <summary>
   /// List pack class.
@@ -7,10 +7,17 @@
 #include "./core/move.hpp"
 #include "./core/forward.hpp"
 #include "./core/swap.hpp"
+#include "./core/memory.hpp"
 #include "./core/copy.hpp"
 #include "./core/compare.hpp"
 #include "./core/sort.hpp"
+#include "./core/radix_sort.hpp"
+#include "./core/parallel_sort.hpp"
+#include "./core/stable_sort.hpp"
+#include "./core/search.hpp"
+#include "./core/binary_search.hpp"
 #include "./core/np2.hpp"
+#include "./core/atomic.hpp"
 #include "./core/pair.hpp"
 #include "./core/pack.hpp"
 #include "./core/tuple.hpp"
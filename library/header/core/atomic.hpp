@@ -0,0 +1,47 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "./types.hpp"
+
+namespace SPL {
+  /// <summary>
+  /// Atomically increment the given counter.
+  /// </summary>
+  /// <param name="counter">Counter reference.</param>
+  /// <returns>Returns the incremented value.</returns>
+  inline Size AtomicIncrement(volatile Size& counter) {
+#if defined(_MSC_VER)
+    if constexpr (sizeof(Size) == sizeof(long long int)) {
+      return static_cast<Size>(_InterlockedIncrement64(reinterpret_cast<volatile long long int*>(&counter)));
+    }
+    else {
+      return static_cast<Size>(_InterlockedIncrement(reinterpret_cast<volatile long int*>(&counter)));
+    }
+#else
+    return __atomic_add_fetch(&counter, 1, __ATOMIC_RELAXED);
+#endif
+  }
+  /// <summary>
+  /// Atomically decrement the given counter.
+  /// </summary>
+  /// <param name="counter">Counter reference.</param>
+  /// <returns>Returns the decremented value.</returns>
+  inline Size AtomicDecrement(volatile Size& counter) {
+#if defined(_MSC_VER)
+    if constexpr (sizeof(Size) == sizeof(long long int)) {
+      return static_cast<Size>(_InterlockedDecrement64(reinterpret_cast<volatile long long int*>(&counter)));
+    }
+    else {
+      return static_cast<Size>(_InterlockedDecrement(reinterpret_cast<volatile long int*>(&counter)));
+    }
+#else
+    return __atomic_sub_fetch(&counter, 1, __ATOMIC_ACQ_REL);
+#endif
+  }
+}
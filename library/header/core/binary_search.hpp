@@ -0,0 +1,111 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#include "./compare.hpp"
+#include "./types.hpp"
+
+namespace SPL {
+  /// <summary>
+  /// Get the index of the first value in the given sorted array that isn't less than the given value.
+  /// The search is branchless, so the loop runs exactly log2(length) times and compiles into conditional moves.
+  /// </summary>
+  /// <typeparam name="T">Value type.</typeparam>
+  /// <typeparam name="C">Comparator type.</typeparam>
+  /// <param name="array">Array of sorted values.</param>
+  /// <param name="length">Number of values.</param>
+  /// <param name="value">Search value.</param>
+  /// <param name="compare">Comparator instance.</param>
+  /// <returns>Returns the corresponding index or the array length when all the values are less.</returns>
+  template<typename T, typename C>
+  Index LowerBound(const T array[], const Size length, const T& value, const C& compare) {
+    if (length == 0) {
+      return 0;
+    }
+    const auto* base = array;
+    for (auto remaining = length; remaining > 1; remaining -= remaining / 2) {
+      base = compare(base[remaining / 2 - 1], value) < 0 ? base + remaining / 2 : base;
+    }
+    return static_cast<Index>(base - array) + (compare(*base, value) < 0 ? 1 : 0);
+  }
+  /// <summary>
+  /// Get the index of the first value in the given sorted array that is greater than the given value.
+  /// The search is branchless, so the loop runs exactly log2(length) times and compiles into conditional moves.
+  /// </summary>
+  /// <typeparam name="T">Value type.</typeparam>
+  /// <typeparam name="C">Comparator type.</typeparam>
+  /// <param name="array">Array of sorted values.</param>
+  /// <param name="length">Number of values.</param>
+  /// <param name="value">Search value.</param>
+  /// <param name="compare">Comparator instance.</param>
+  /// <returns>Returns the corresponding index or the array length when no value is greater.</returns>
+  template<typename T, typename C>
+  Index UpperBound(const T array[], const Size length, const T& value, const C& compare) {
+    if (length == 0) {
+      return 0;
+    }
+    const auto* base = array;
+    for (auto remaining = length; remaining > 1; remaining -= remaining / 2) {
+      base = compare(value, base[remaining / 2 - 1]) >= 0 ? base + remaining / 2 : base;
+    }
+    return static_cast<Index>(base - array) + (compare(value, *base) >= 0 ? 1 : 0);
+  }
+  /// <summary>
+  /// Get the index of any occurrence of the given value in the given sorted array.
+  /// </summary>
+  /// <typeparam name="T">Value type.</typeparam>
+  /// <typeparam name="C">Comparator type.</typeparam>
+  /// <param name="array">Array of sorted values.</param>
+  /// <param name="length">Number of values.</param>
+  /// <param name="value">Search value.</param>
+  /// <param name="compare">Comparator instance.</param>
+  /// <returns>Returns the corresponding index or -1 when the value wasn't found.</returns>
+  template<typename T, typename C>
+  Index BinarySearch(const T array[], const Size length, const T& value, const C& compare) {
+    const auto index = LowerBound(array, length, value, compare);
+    if (index < length && compare(array[index], value) == 0) {
+      return index;
+    }
+    return -1;
+  }
+  /// <summary>
+  /// Get the index of the first value in the given sorted array that isn't less than the given value.
+  /// </summary>
+  /// <typeparam name="T">Value type.</typeparam>
+  /// <typeparam name="C">Comparator function.</typeparam>
+  /// <param name="array">Array of sorted values.</param>
+  /// <param name="length">Number of values.</param>
+  /// <param name="value">Search value.</param>
+  /// <returns>Returns the corresponding index or the array length when all the values are less.</returns>
+  template<typename T, int(C)(const T&, const T&) = &Compare>
+  Index LowerBound(const T array[], const Size length, const T& value) {
+    return LowerBound(array, length, value, Comparator<T, C>());
+  }
+  /// <summary>
+  /// Get the index of the first value in the given sorted array that is greater than the given value.
+  /// </summary>
+  /// <typeparam name="T">Value type.</typeparam>
+  /// <typeparam name="C">Comparator function.</typeparam>
+  /// <param name="array">Array of sorted values.</param>
+  /// <param name="length">Number of values.</param>
+  /// <param name="value">Search value.</param>
+  /// <returns>Returns the corresponding index or the array length when no value is greater.</returns>
+  template<typename T, int(C)(const T&, const T&) = &Compare>
+  Index UpperBound(const T array[], const Size length, const T& value) {
+    return UpperBound(array, length, value, Comparator<T, C>());
+  }
+  /// <summary>
+  /// Get the index of any occurrence of the given value in the given sorted array.
+  /// </summary>
+  /// <typeparam name="T">Value type.</typeparam>
+  /// <typeparam name="C">Comparator function.</typeparam>
+  /// <param name="array">Array of sorted values.</param>
+  /// <param name="length">Number of values.</param>
+  /// <param name="value">Search value.</param>
+  /// <returns>Returns the corresponding index or -1 when the value wasn't found.</returns>
+  template<typename T, int(C)(const T&, const T&) = &Compare>
+  Index BinarySearch(const T array[], const Size length, const T& value) {
+    return BinarySearch(array, length, value, Comparator<T, C>());
+  }
+}
@@ -67,4 +67,23 @@ namespace SPL {
     }
     return 0;
   }
+  /// <summary>
+  /// Comparator class.
+  /// Wrap a compare function into a callable type.
+  /// </summary>
+  /// <typeparam name="T">Value type.</typeparam>
+  /// <typeparam name="C">Comparator function.</typeparam>
+  template<typename T, int(C)(const T&, const T&) = &Compare>
+  class Comparator final {
+  public:
+    /// <summary>
+    /// Compare the given source with the given target.
+    /// </summary>
+    /// <param name="source">Source value.</param>
+    /// <param name="target">Target value.</param>
+    /// <returns>Returns the comparison result.</returns>
+    int operator()(const T& source, const T& target) const {
+      return C(source, target);
+    }
+  };
 }
@@ -3,11 +3,14 @@
 ///
 #pragma once
 
+#include "../metadata/trivial.hpp"
 #include "./types.hpp"
+#include "./memory.hpp"
 
 namespace SPL {
   /// <summary>
   /// Copy the given source to the given target.
+  /// Trivially copyable types are copied as a single memory block.
   /// </summary>
   /// <typeparam name="T">Value type.</typeparam>
   /// <param name="source">Source array.</param>
@@ -16,9 +19,14 @@ namespace SPL {
   /// <returns>Returns the target array.</returns>
   template<typename T>
   T* Copy(const T source[], T target[], const Size length) {
-    for (Size offset = 0; offset < length; ++offset) {
-      target[offset] = source[offset];
+    if constexpr (Metadata::IsTriviallyCopyable<T>) {
+      return MemoryCopy(source, target, length);
+    }
+    else {
+      for (Size offset = 0; offset < length; ++offset) {
+        target[offset] = source[offset];
+      }
+      return target;
     }
-    return target;
   }
 }
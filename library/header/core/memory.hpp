@@ -0,0 +1,119 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#include <string.h>
+#include <new>
+
+#if defined(_M_X64) || defined(_M_IX86)
+#include <xmmintrin.h>
+#endif
+
+#include "../metadata/trivial.hpp"
+#include "./types.hpp"
+#include "./forward.hpp"
+
+namespace SPL {
+  /// <summary>
+  /// Copy the memory block of the given source elements into the target elements.
+  /// IMPORTANT: Both ranges can't overlap and the type must be trivially copyable (or relocatable).
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  /// <param name="source">Source elements.</param>
+  /// <param name="target">Target elements.</param>
+  /// <param name="length">Number of elements.</param>
+  /// <returns>Returns the target elements.</returns>
+  template<typename T>
+  T* MemoryCopy(const T source[], T target[], const Size length) {
+    if (length > 0) {
+      memcpy(static_cast<void*>(target), static_cast<const void*>(source), sizeof(T) * length);
+    }
+    return target;
+  }
+  /// <summary>
+  /// Move the memory block of the given source elements into the target elements.
+  /// IMPORTANT: Both ranges can overlap, but the type must be trivially copyable (or relocatable).
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  /// <param name="source">Source elements.</param>
+  /// <param name="target">Target elements.</param>
+  /// <param name="length">Number of elements.</param>
+  /// <returns>Returns the target elements.</returns>
+  template<typename T>
+  T* MemoryMove(const T source[], T target[], const Size length) {
+    if (length > 0) {
+      memmove(static_cast<void*>(target), static_cast<const void*>(source), sizeof(T) * length);
+    }
+    return target;
+  }
+  /// <summary>
+  /// Allocate an uninitialized memory block for the given number of elements.
+  /// The memory block is aligned according to the element type.
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  /// <param name="length">Number of elements.</param>
+  /// <returns>Returns the allocated elements.</returns>
+  template<typename T>
+  T* Allocate(const Size length) {
+    if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+      return static_cast<T*>(::operator new(sizeof(T) * length, static_cast<std::align_val_t>(alignof(T))));
+    }
+    else {
+      return static_cast<T*>(::operator new(sizeof(T) * length));
+    }
+  }
+  /// <summary>
+  /// Deallocate the memory block of the given elements.
+  /// IMPORTANT: All the elements must be destroyed before.
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  /// <param name="elements">Allocated elements.</param>
+  template<typename T>
+  void Deallocate(T elements[]) {
+    if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+      ::operator delete(static_cast<void*>(elements), static_cast<std::align_val_t>(alignof(T)));
+    }
+    else {
+      ::operator delete(static_cast<void*>(elements));
+    }
+  }
+  /// <summary>
+  /// Construct a new element in the given uninitialized memory.
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  /// <typeparam name="...A">Argument types.</typeparam>
+  /// <param name="target">Target memory.</param>
+  /// <param name="...arguments">Constructor arguments.</param>
+  /// <returns>Returns the constructed element.</returns>
+  template<typename T, typename ...A>
+  T* Construct(T* const target, A&&... arguments) {
+    return ::new (static_cast<void*>(target)) T(Forward<A>(arguments)...);
+  }
+  /// <summary>
+  /// Destroy the given elements keeping their memory.
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  /// <param name="elements">Elements to destroy.</param>
+  /// <param name="length">Number of elements.</param>
+  template<typename T>
+  void Destroy(T elements[], const Size length) {
+    if constexpr (!Metadata::IsTriviallyCopyable<T>) {
+      for (Size offset = 0; offset < length; ++offset) {
+        elements[offset].~T();
+      }
+    }
+  }
+  /// <summary>
+  /// Hint the processor to load the cache line of the given address.
+  /// The address doesn't need to be valid, no memory access is performed.
+  /// </summary>
+  /// <param name="address">Memory address.</param>
+  inline void Prefetch(const void* const address) {
+#if defined(_M_X64) || defined(_M_IX86)
+    _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#elif defined(__GNUC__)
+    __builtin_prefetch(address);
+#endif
+  }
+}
@@ -3,7 +3,6 @@
 ///
 #pragma once
 
-#include "../metadata/device.hpp"
 #include "./types.hpp"
 
 namespace SPL {
@@ -14,7 +13,7 @@ namespace SPL {
   /// <returns>Returns the nearest power of two.</returns>
   inline Size NP2(Size value) {
     value--;
-    for (Size bit = 1; bit < Metadata::Device::Bit; bit *= 2) {
+    for (Size bit = 1; bit < sizeof(Size) * 8; bit *= 2) {
       value |= value >> bit;
     }
     return ++value;
@@ -0,0 +1,138 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#include <thread>
+
+#include "../math/max.hpp"
+#include "../math/min.hpp"
+#include "./compare.hpp"
+#include "./sort.hpp"
+#include "./swap.hpp"
+#include "./types.hpp"
+
+namespace SPL {
+  /// <summary>
+  /// Parallel sort class.
+  /// This class implements a parallel Quicksort that splits the range with a three-way partition and hands one side
+  /// to a new worker thread until the thread budget is used, every remaining range is sorted by the pattern sort.
+  /// </summary>
+  /// <typeparam name="T">Value type.</typeparam>
+  /// <typeparam name="C">Comparator function.</typeparam>
+  template<typename T, int(C)(const T&, const T&)>
+  class ParallelSorter final {
+  private:
+    /// <summary>
+    /// Determines whether or not the first value is less than the second one.
+    /// </summary>
+    /// <param name="source">First value.</param>
+    /// <param name="target">Second value.</param>
+    /// <returns>Returns true when the first value is less, false otherwise.</returns>
+    static bool Less(const T& source, const T& target) {
+      return C(source, target) < 0;
+    }
+    /// <summary>
+    /// Get the median of the given values.
+    /// </summary>
+    /// <param name="first">First value.</param>
+    /// <param name="second">Second value.</param>
+    /// <param name="third">Third value.</param>
+    /// <returns>Returns the median value.</returns>
+    static T* Median(T* const first, T* const second, T* const third) {
+      if (Less(*first, *second)) {
+        return Less(*second, *third) ? second : (Less(*first, *third) ? third : first);
+      }
+      return Less(*first, *third) ? first : (Less(*second, *third) ? third : second);
+    }
+    /// <summary>
+    /// Partition the given range around the ninther pivot (pseudo median of 9 values).
+    /// Values less than the pivot are moved to [begin, lower), values equal to the pivot to [lower, upper) and
+    /// values greater than the pivot to [upper, end).
+    /// </summary>
+    /// <param name="begin">Range begin.</param>
+    /// <param name="end">Range end.</param>
+    /// <param name="lower">Lower bound of the pivot values.</param>
+    /// <param name="upper">Upper bound of the pivot values.</param>
+    static void Partition(T* const begin, T* const end, T*& lower, T*& upper) {
+      const auto step = static_cast<Size>(end - begin) / 8;
+      auto* pivot = Median(
+        Median(begin, begin + step, begin + step * 2),
+        Median(begin + step * 3, begin + step * 4, begin + step * 5),
+        Median(begin + step * 6, begin + step * 7, end - 1)
+      );
+      Swap(*begin, *pivot);
+      auto* less = begin + 1;
+      auto* current = begin + 1;
+      auto* greater = end;
+      while (current < greater) {
+        if (Less(*current, *begin)) {
+          Swap(*less++, *current++);
+        }
+        else if (Less(*begin, *current)) {
+          Swap(*current, *--greater);
+        }
+        else {
+          ++current;
+        }
+      }
+      Swap(*begin, *--less);
+      lower = less;
+      upper = greater;
+    }
+    /// <summary>
+    /// Sort the given range using the given number of threads.
+    /// </summary>
+    /// <param name="begin">Range begin.</param>
+    /// <param name="end">Range end.</param>
+    /// <param name="threads">Number of available threads (including the current one).</param>
+    static void Split(T* const begin, T* const end, const Size threads) {
+      if (threads < 2 || static_cast<Size>(end - begin) < Threshold) {
+        PatternSort<T, Comparator<T, C>>::Sort(begin, end, Comparator<T, C>());
+        return;
+      }
+      T* lower;
+      T* upper;
+      Partition(begin, end, lower, upper);
+      const auto left = static_cast<Size>(lower - begin);
+      const auto right = static_cast<Size>(end - upper);
+      const auto share = Math::Min(Math::Max<Size>(1ULL * threads * left / (1ULL + left + right), 1), threads - 1);
+      std::thread worker(&Split, begin, lower, share);
+      Split(upper, end, threads - share);
+      worker.join();
+    }
+  public:
+    /// <summary>
+    /// Ranges smaller than this threshold are sorted sequentially.
+    /// </summary>
+    constexpr static Size Threshold = 1U << 15;
+    /// <summary>
+    /// Sort the given range.
+    /// </summary>
+    /// <param name="begin">Range begin.</param>
+    /// <param name="end">Range end.</param>
+    /// <param name="threads">Number of worker threads (zero for the number of hardware threads).</param>
+    static void Sort(T* const begin, T* const end, Size threads) {
+      if (threads == 0) {
+        threads = Math::Max<Size>(static_cast<Size>(std::thread::hardware_concurrency()), 1);
+      }
+      Split(begin, end, threads);
+    }
+  };
+  /// <summary>
+  /// Parallel sort function.
+  /// Ranges smaller than the parallel threshold or a single thread fall back to the default sort function.
+  /// </summary>
+  /// <typeparam name="T">Value type.</typeparam>
+  /// <typeparam name="C">Comparator function.</typeparam>
+  /// <param name="array">Array of values.</param>
+  /// <param name="start">Start offset.</param>
+  /// <param name="end">End offset.</param>
+  /// <param name="threads">Number of worker threads (zero for the number of hardware threads).</param>
+  template<typename T, int(C)(const T&, const T&) = &Compare>
+  void ParallelSort(T array[], Size start, Size end, const Size threads = 0) {
+    if (start < end) {
+      ParallelSorter<T, C>::Sort(&array[start], &array[end] + 1, threads);
+    }
+  }
+}
@@ -0,0 +1,210 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#include "../metadata/character.hpp"
+#include "../metadata/constant.hpp"
+#include "../metadata/decimal.hpp"
+#include "../metadata/integer.hpp"
+#include "../metadata/trivial.hpp"
+#include "../types/select.hpp"
+#include "./memory.hpp"
+#include "./move.hpp"
+#include "./swap.hpp"
+#include "./types.hpp"
+
+namespace SPL {
+  /// <summary>
+  /// Radix key class.
+  /// Map arithmetic keys into unsigned keys with the same order, so they can be sorted digit by digit.
+  /// </summary>
+  /// <typeparam name="K">Key type.</typeparam>
+  template<typename K>
+  class RadixKey final {
+  private:
+    /// <summary>
+    /// Determines whether or not the key type is a decimal type.
+    /// </summary>
+    constexpr static bool Decimal = Metadata::IsDecimal<K>;
+    /// <summary>
+    /// Determines whether or not the key type is an integer type.
+    /// </summary>
+    constexpr static bool Integer = Metadata::IsInteger<K> || Metadata::IsCharacter<K>;
+  public:
+    /// <summary>
+    /// Determines whether or not the key type can be used by the radix sort.
+    /// </summary>
+    constexpr static bool Enabled = (Integer && (sizeof(K) == 1 || sizeof(K) == 2 || sizeof(K) == 4 || sizeof(K) == 8))
+      || (Decimal && (sizeof(K) == 4 || sizeof(K) == 8));
+    /// <summary>
+    /// Unsigned key type.
+    /// </summary>
+    using Type = Types::SelectType<sizeof(K) == 1, unsigned char,
+      Types::SelectType<sizeof(K) == 2, unsigned short int,
+      Types::SelectType<sizeof(K) == 4, unsigned int, unsigned long long int>>>;
+    /// <summary>
+    /// Number of 8-bit digits in the key.
+    /// </summary>
+    constexpr static Size Digits = sizeof(Type);
+  public:
+    /// <summary>
+    /// Get the unsigned key that corresponds to the given key.
+    /// Signed integers have their sign bit flipped, negative decimals have all their bits flipped and positive
+    /// decimals have only the sign bit flipped (IEEE 754 order).
+    /// </summary>
+    /// <param name="key">Input key.</param>
+    /// <returns>Returns the unsigned key.</returns>
+    static Type Get(const K key) {
+      constexpr auto Sign = static_cast<Type>(static_cast<Type>(1) << (sizeof(Type) * 8 - 1));
+      if constexpr (Decimal) {
+        Type bits;
+        MemoryCopy(reinterpret_cast<const unsigned char*>(&key), reinterpret_cast<unsigned char*>(&bits), sizeof(Type));
+        return (bits & Sign) != 0 ? static_cast<Type>(~bits) : static_cast<Type>(bits | Sign);
+      }
+      else if constexpr (static_cast<K>(-1) < static_cast<K>(0)) {
+        return static_cast<Type>(static_cast<Type>(key) ^ Sign);
+      }
+      else {
+        return static_cast<Type>(key);
+      }
+    }
+  };
+  /// <summary>
+  /// Radix sort class.
+  /// This class implements the LSD Radix sort algorithm (stable) with 8-bit digits. For more info, please visit:
+  /// https://en.wikipedia.org/wiki/Radix_sort
+  /// </summary>
+  /// <typeparam name="T">Value type.</typeparam>
+  /// <typeparam name="E">Key extractor function.</typeparam>
+  template<typename T, auto E>
+  class RadixSorter final {
+  private:
+    /// <summary>
+    /// Radix key type.
+    /// </summary>
+    using KeyType = RadixKey<Metadata::ConstantType<decltype(E(*static_cast<const T*>(nullptr)))>>;
+    /// <summary>
+    /// Get the unsigned key of the given value.
+    /// </summary>
+    /// <param name="value">Input value.</param>
+    /// <returns>Returns the unsigned key.</returns>
+    static typename KeyType::Type Key(const T& value) {
+      return KeyType::Get(E(value));
+    }
+  public:
+    /// <summary>
+    /// Determines whether or not the extracted key can be used by the radix sort.
+    /// </summary>
+    constexpr static bool Enabled = KeyType::Enabled;
+    /// <summary>
+    /// Sort the given values using the given buffer as scratch memory.
+    /// Digits shared by all the keys are skipped, so the number of passes depends on the key range.
+    /// </summary>
+    /// <param name="array">Array of values.</param>
+    /// <param name="buffer">Buffer of values (with the same length).</param>
+    /// <param name="length">Number of values.</param>
+    static void Sort(T array[], T buffer[], const Size length) {
+      static_assert(Enabled, "The key type must be an integer or a decimal type.");
+      if (length < 2) {
+        return;
+      }
+      Size counts[KeyType::Digits][256] = {};
+      for (Size offset = 0; offset < length; ++offset) {
+        auto key = Key(array[offset]);
+        for (Size digit = 0; digit < KeyType::Digits; ++digit) {
+          counts[digit][key & 255]++;
+          key = static_cast<typename KeyType::Type>(key >> 7 >> 1);
+        }
+      }
+      auto* source = array;
+      auto* target = buffer;
+      for (Size digit = 0; digit < KeyType::Digits; ++digit) {
+        auto* count = counts[digit];
+        const auto shift = digit * 8;
+        if (count[(Key(source[0]) >> shift) & 255] == length) {
+          continue;
+        }
+        Size offsets[256];
+        for (Size position = 0, total = 0; position < 256; ++position) {
+          offsets[position] = total;
+          total += count[position];
+        }
+        for (Size offset = 0; offset < length; ++offset) {
+          target[offsets[(Key(source[offset]) >> shift) & 255]++] = Move(source[offset]);
+        }
+        Swap(source, target);
+      }
+      if (source != array) {
+        if constexpr (Metadata::IsTriviallyCopyable<T>) {
+          MemoryCopy(source, array, length);
+        }
+        else {
+          for (Size offset = 0; offset < length; ++offset) {
+            array[offset] = Move(source[offset]);
+          }
+        }
+      }
+    }
+  };
+  /// <summary>
+  /// Get the given value as its own radix key.
+  /// </summary>
+  /// <typeparam name="T">Value type.</typeparam>
+  /// <param name="value">Input value.</param>
+  /// <returns>Returns the given value.</returns>
+  template<typename T>
+  T RadixIdentity(const T& value) {
+    return value;
+  }
+  /// <summary>
+  /// Radix sort function (with key extractor and scratch buffer).
+  /// The sort is stable and runs in O(n * k), where k is the key size in bytes.
+  /// </summary>
+  /// <typeparam name="E">Key extractor function.</typeparam>
+  /// <typeparam name="T">Value type.</typeparam>
+  /// <param name="array">Array of values.</param>
+  /// <param name="buffer">Buffer of values (with the same length).</param>
+  /// <param name="length">Number of values.</param>
+  template<auto E, typename T>
+  void RadixSort(T array[], T buffer[], const Size length) {
+    RadixSorter<T, E>::Sort(array, buffer, length);
+  }
+  /// <summary>
+  /// Radix sort function (with key extractor).
+  /// The sort is stable and runs in O(n * k), where k is the key size in bytes.
+  /// </summary>
+  /// <typeparam name="E">Key extractor function.</typeparam>
+  /// <typeparam name="T">Value type.</typeparam>
+  /// <param name="array">Array of values.</param>
+  /// <param name="length">Number of values.</param>
+  template<auto E, typename T>
+  void RadixSort(T array[], const Size length) {
+    if (length > 1) {
+      auto* buffer = new T[length];
+      RadixSorter<T, E>::Sort(array, buffer, length);
+      delete[] buffer;
+    }
+  }
+  /// <summary>
+  /// Radix sort function (with scratch buffer).
+  /// </summary>
+  /// <typeparam name="T">Value type (integer or decimal).</typeparam>
+  /// <param name="array">Array of values.</param>
+  /// <param name="buffer">Buffer of values (with the same length).</param>
+  /// <param name="length">Number of values.</param>
+  template<typename T>
+  void RadixSort(T array[], T buffer[], const Size length) {
+    RadixSorter<T, &RadixIdentity<T>>::Sort(array, buffer, length);
+  }
+  /// <summary>
+  /// Radix sort function.
+  /// </summary>
+  /// <typeparam name="T">Value type (integer or decimal).</typeparam>
+  /// <param name="array">Array of values.</param>
+  /// <param name="length">Number of values.</param>
+  template<typename T>
+  void RadixSort(T array[], const Size length) {
+    RadixSort<&RadixIdentity<T>>(array, length);
+  }
+}
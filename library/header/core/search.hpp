@@ -0,0 +1,435 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define SPL_VECTOR_SEARCH
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define SPL_TARGET_AVX2
+#else
+#define SPL_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+#include "../metadata/character.hpp"
+#include "../metadata/decimal.hpp"
+#include "../metadata/integer.hpp"
+#include "../math/bits.hpp"
+#include "./compare.hpp"
+#include "./types.hpp"
+
+namespace SPL {
+#if defined(SPL_VECTOR_SEARCH)
+  /// <summary>
+  /// Vector search class.
+  /// Compare 16 (SSE2) or 32 (AVX2) bytes of arithmetic elements per instruction, the AVX2 kernels are selected
+  /// at runtime when the processor supports them.
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  template<typename T>
+  class VectorSearch final {
+  private:
+    /// <summary>
+    /// Determines whether or not the element type is a decimal type.
+    /// </summary>
+    constexpr static bool Decimal = Metadata::IsDecimal<T>;
+    /// <summary>
+    /// Determines whether or not the element type is an integer type.
+    /// </summary>
+    constexpr static bool Integer = Metadata::IsInteger<T> || Metadata::IsCharacter<T>;
+  public:
+    /// <summary>
+    /// Determines whether or not the element type can be searched with vector instructions.
+    /// </summary>
+    constexpr static bool Enabled = (Integer && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8))
+      || (Decimal && (sizeof(T) == 4 || sizeof(T) == 8));
+  private:
+    /// <summary>
+    /// Determines whether or not the processor (and the operating system) supports AVX2 instructions.
+    /// </summary>
+    /// <returns>Returns true when it's supported, false otherwise.</returns>
+    static bool Detect() {
+#if defined(_MSC_VER)
+      int info[4];
+      __cpuid(info, 0);
+      if (info[0] < 7) {
+        return false;
+      }
+      __cpuid(info, 1);
+      if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0 || (_xgetbv(0) & 6) != 6) {
+        return false;
+      }
+      __cpuidex(info, 7, 0);
+      return (info[1] & (1 << 5)) != 0;
+#else
+      return __builtin_cpu_supports("avx2");
+#endif
+    }
+    /// <summary>
+    /// Determines whether or not the AVX2 kernels can be used (detected only once).
+    /// </summary>
+    /// <returns>Returns true when they can be used, false otherwise.</returns>
+    static bool HasAVX2() {
+      static const bool state = Detect();
+      return state;
+    }
+    /// <summary>
+    /// Fill all the lanes of a 128-bit vector with the given value.
+    /// </summary>
+    /// <param name="value">Input value.</param>
+    /// <returns>Returns the vector.</returns>
+    static __m128i Fill128(const T value) {
+      if constexpr (Decimal && sizeof(T) == 4) {
+        return _mm_castps_si128(_mm_set1_ps(static_cast<float>(value)));
+      }
+      else if constexpr (Decimal) {
+        return _mm_castpd_si128(_mm_set1_pd(static_cast<double>(value)));
+      }
+      else if constexpr (sizeof(T) == 1) {
+        return _mm_set1_epi8(static_cast<char>(value));
+      }
+      else if constexpr (sizeof(T) == 2) {
+        return _mm_set1_epi16(static_cast<short>(value));
+      }
+      else if constexpr (sizeof(T) == 4) {
+        return _mm_set1_epi32(static_cast<int>(value));
+      }
+      else {
+        return _mm_set1_epi64x(static_cast<long long>(value));
+      }
+    }
+    /// <summary>
+    /// Compare all the lanes of the given 128-bit vectors.
+    /// Decimal lanes are equal when they aren't ordered, just like the Compare function.
+    /// </summary>
+    /// <param name="block">Elements vector.</param>
+    /// <param name="value">Search vector.</param>
+    /// <returns>Returns the byte mask of the equal lanes.</returns>
+    static unsigned int Equal128(const __m128i block, const __m128i value) {
+      __m128i result;
+      if constexpr (Decimal && sizeof(T) == 4) {
+        const auto x = _mm_castsi128_ps(block), y = _mm_castsi128_ps(value);
+        result = _mm_castps_si128(_mm_or_ps(_mm_cmpeq_ps(x, y), _mm_cmpunord_ps(x, y)));
+      }
+      else if constexpr (Decimal) {
+        const auto x = _mm_castsi128_pd(block), y = _mm_castsi128_pd(value);
+        result = _mm_castpd_si128(_mm_or_pd(_mm_cmpeq_pd(x, y), _mm_cmpunord_pd(x, y)));
+      }
+      else if constexpr (sizeof(T) == 1) {
+        result = _mm_cmpeq_epi8(block, value);
+      }
+      else if constexpr (sizeof(T) == 2) {
+        result = _mm_cmpeq_epi16(block, value);
+      }
+      else if constexpr (sizeof(T) == 4) {
+        result = _mm_cmpeq_epi32(block, value);
+      }
+      else {
+        const auto halves = _mm_cmpeq_epi32(block, value);
+        result = _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+      }
+      return static_cast<unsigned int>(_mm_movemask_epi8(result));
+    }
+    /// <summary>
+    /// Fill all the lanes of a 256-bit vector with the given value.
+    /// </summary>
+    /// <param name="value">Input value.</param>
+    /// <returns>Returns the vector.</returns>
+    SPL_TARGET_AVX2 static __m256i Fill256(const T value) {
+      if constexpr (Decimal && sizeof(T) == 4) {
+        return _mm256_castps_si256(_mm256_set1_ps(static_cast<float>(value)));
+      }
+      else if constexpr (Decimal) {
+        return _mm256_castpd_si256(_mm256_set1_pd(static_cast<double>(value)));
+      }
+      else if constexpr (sizeof(T) == 1) {
+        return _mm256_set1_epi8(static_cast<char>(value));
+      }
+      else if constexpr (sizeof(T) == 2) {
+        return _mm256_set1_epi16(static_cast<short>(value));
+      }
+      else if constexpr (sizeof(T) == 4) {
+        return _mm256_set1_epi32(static_cast<int>(value));
+      }
+      else {
+        return _mm256_set1_epi64x(static_cast<long long>(value));
+      }
+    }
+    /// <summary>
+    /// Compare all the lanes of the given 256-bit vectors.
+    /// Decimal lanes are equal when they aren't ordered, just like the Compare function.
+    /// </summary>
+    /// <param name="block">Elements vector.</param>
+    /// <param name="value">Search vector.</param>
+    /// <returns>Returns the byte mask of the equal lanes.</returns>
+    SPL_TARGET_AVX2 static unsigned int Equal256(const __m256i block, const __m256i value) {
+      __m256i result;
+      if constexpr (Decimal && sizeof(T) == 4) {
+        result = _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(block), _mm256_castsi256_ps(value), _CMP_EQ_UQ));
+      }
+      else if constexpr (Decimal) {
+        result = _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(block), _mm256_castsi256_pd(value), _CMP_EQ_UQ));
+      }
+      else if constexpr (sizeof(T) == 1) {
+        result = _mm256_cmpeq_epi8(block, value);
+      }
+      else if constexpr (sizeof(T) == 2) {
+        result = _mm256_cmpeq_epi16(block, value);
+      }
+      else if constexpr (sizeof(T) == 4) {
+        result = _mm256_cmpeq_epi32(block, value);
+      }
+      else {
+        result = _mm256_cmpeq_epi64(block, value);
+      }
+      return static_cast<unsigned int>(_mm256_movemask_epi8(result));
+    }
+    /// <summary>
+    /// Get the first index of the search element (using SSE2).
+    /// </summary>
+    /// <param name="elements">Input elements.</param>
+    /// <param name="length">Number of elements.</param>
+    /// <param name="search">Search element.</param>
+    /// <returns>Returns the corresponding index or -1 when the element wasn't found.</returns>
+    static Index Find128(const T elements[], const Size length, const T& search) {
+      constexpr Size Lanes = 16 / sizeof(T);
+      const auto value = Fill128(search);
+      Size offset = 0;
+      for (; offset + Lanes <= length; offset += Lanes) {
+        const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&elements[offset]));
+        const auto mask = Equal128(block, value);
+        if (mask != 0) {
+          return offset + Math::CountTrailingZeros(mask) / sizeof(T);
+        }
+      }
+      for (; offset < length; ++offset) {
+        if (Compare(elements[offset], search) == 0) {
+          return offset;
+        }
+      }
+      return -1;
+    }
+    /// <summary>
+    /// Get the first index of the search element (using AVX2).
+    /// </summary>
+    /// <param name="elements">Input elements.</param>
+    /// <param name="length">Number of elements.</param>
+    /// <param name="search">Search element.</param>
+    /// <returns>Returns the corresponding index or -1 when the element wasn't found.</returns>
+    SPL_TARGET_AVX2 static Index Find256(const T elements[], const Size length, const T& search) {
+      constexpr Size Lanes = 32 / sizeof(T);
+      const auto value = Fill256(search);
+      Size offset = 0;
+      for (; offset + Lanes <= length; offset += Lanes) {
+        const auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&elements[offset]));
+        const auto mask = Equal256(block, value);
+        if (mask != 0) {
+          return offset + Math::CountTrailingZeros(mask) / sizeof(T);
+        }
+      }
+      for (; offset < length; ++offset) {
+        if (Compare(elements[offset], search) == 0) {
+          return offset;
+        }
+      }
+      return -1;
+    }
+    /// <summary>
+    /// Get the last index of the search element (using SSE2).
+    /// </summary>
+    /// <param name="elements">Input elements.</param>
+    /// <param name="length">Number of elements.</param>
+    /// <param name="search">Search element.</param>
+    /// <returns>Returns the corresponding index or -1 when the element wasn't found.</returns>
+    static Index FindLast128(const T elements[], const Size length, const T& search) {
+      constexpr Size Lanes = 16 / sizeof(T);
+      const auto value = Fill128(search);
+      Size offset = length;
+      for (; offset >= Lanes; offset -= Lanes) {
+        const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&elements[offset - Lanes]));
+        const auto mask = Equal128(block, value);
+        if (mask != 0) {
+          return offset - Lanes + (63 - Math::CountLeadingZeros(mask)) / sizeof(T);
+        }
+      }
+      while (offset > 0) {
+        if (Compare(elements[--offset], search) == 0) {
+          return offset;
+        }
+      }
+      return -1;
+    }
+    /// <summary>
+    /// Get the last index of the search element (using AVX2).
+    /// </summary>
+    /// <param name="elements">Input elements.</param>
+    /// <param name="length">Number of elements.</param>
+    /// <param name="search">Search element.</param>
+    /// <returns>Returns the corresponding index or -1 when the element wasn't found.</returns>
+    SPL_TARGET_AVX2 static Index FindLast256(const T elements[], const Size length, const T& search) {
+      constexpr Size Lanes = 32 / sizeof(T);
+      const auto value = Fill256(search);
+      Size offset = length;
+      for (; offset >= Lanes; offset -= Lanes) {
+        const auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&elements[offset - Lanes]));
+        const auto mask = Equal256(block, value);
+        if (mask != 0) {
+          return offset - Lanes + (63 - Math::CountLeadingZeros(mask)) / sizeof(T);
+        }
+      }
+      while (offset > 0) {
+        if (Compare(elements[--offset], search) == 0) {
+          return offset;
+        }
+      }
+      return -1;
+    }
+    /// <summary>
+    /// Count all the occurrences of the search element (using SSE2).
+    /// </summary>
+    /// <param name="elements">Input elements.</param>
+    /// <param name="length">Number of elements.</param>
+    /// <param name="search">Search element.</param>
+    /// <returns>Returns the number of occurrences.</returns>
+    static Size Count128(const T elements[], const Size length, const T& search) {
+      constexpr Size Lanes = 16 / sizeof(T);
+      const auto value = Fill128(search);
+      Size offset = 0, count = 0;
+      for (; offset + Lanes <= length; offset += Lanes) {
+        const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&elements[offset]));
+        count += Math::PopCount(Equal128(block, value)) / sizeof(T);
+      }
+      for (; offset < length; ++offset) {
+        count += Compare(elements[offset], search) == 0 ? 1 : 0;
+      }
+      return count;
+    }
+    /// <summary>
+    /// Count all the occurrences of the search element (using AVX2).
+    /// </summary>
+    /// <param name="elements">Input elements.</param>
+    /// <param name="length">Number of elements.</param>
+    /// <param name="search">Search element.</param>
+    /// <returns>Returns the number of occurrences.</returns>
+    SPL_TARGET_AVX2 static Size Count256(const T elements[], const Size length, const T& search) {
+      constexpr Size Lanes = 32 / sizeof(T);
+      const auto value = Fill256(search);
+      Size offset = 0, count = 0;
+      for (; offset + Lanes <= length; offset += Lanes) {
+        const auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&elements[offset]));
+        count += Math::PopCount(Equal256(block, value)) / sizeof(T);
+      }
+      for (; offset < length; ++offset) {
+        count += Compare(elements[offset], search) == 0 ? 1 : 0;
+      }
+      return count;
+    }
+  public:
+    /// <summary>
+    /// Get the first index of the search element.
+    /// </summary>
+    /// <param name="elements">Input elements.</param>
+    /// <param name="length">Number of elements.</param>
+    /// <param name="search">Search element.</param>
+    /// <returns>Returns the corresponding index or -1 when the element wasn't found.</returns>
+    static Index Find(const T elements[], const Size length, const T& search) {
+      return HasAVX2() ? Find256(elements, length, search) : Find128(elements, length, search);
+    }
+    /// <summary>
+    /// Get the last index of the search element.
+    /// </summary>
+    /// <param name="elements">Input elements.</param>
+    /// <param name="length">Number of elements.</param>
+    /// <param name="search">Search element.</param>
+    /// <returns>Returns the corresponding index or -1 when the element wasn't found.</returns>
+    static Index FindLast(const T elements[], const Size length, const T& search) {
+      return HasAVX2() ? FindLast256(elements, length, search) : FindLast128(elements, length, search);
+    }
+    /// <summary>
+    /// Count all the occurrences of the search element.
+    /// </summary>
+    /// <param name="elements">Input elements.</param>
+    /// <param name="length">Number of elements.</param>
+    /// <param name="search">Search element.</param>
+    /// <returns>Returns the number of occurrences.</returns>
+    static Size Count(const T elements[], const Size length, const T& search) {
+      return HasAVX2() ? Count256(elements, length, search) : Count128(elements, length, search);
+    }
+  };
+#endif
+  /// <summary>
+  /// Get the first index of the search element in the given elements.
+  /// Arithmetic elements are compared with vector instructions (when available).
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  /// <param name="elements">Input elements.</param>
+  /// <param name="length">Number of elements.</param>
+  /// <param name="search">Search element.</param>
+  /// <returns>Returns the corresponding index or -1 when the element wasn't found.</returns>
+  template<typename T>
+  Index Find(const T elements[], const Size length, const T& search) {
+#if defined(SPL_VECTOR_SEARCH)
+    if constexpr (VectorSearch<T>::Enabled) {
+      return VectorSearch<T>::Find(elements, length, search);
+    }
+#endif
+    for (Size offset = 0; offset < length; ++offset) {
+      if (Compare(elements[offset], search) == 0) {
+        return offset;
+      }
+    }
+    return -1;
+  }
+  /// <summary>
+  /// Get the last index of the search element in the given elements.
+  /// Arithmetic elements are compared with vector instructions (when available).
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  /// <param name="elements">Input elements.</param>
+  /// <param name="length">Number of elements.</param>
+  /// <param name="search">Search element.</param>
+  /// <returns>Returns the corresponding index or -1 when the element wasn't found.</returns>
+  template<typename T>
+  Index FindLast(const T elements[], const Size length, const T& search) {
+#if defined(SPL_VECTOR_SEARCH)
+    if constexpr (VectorSearch<T>::Enabled) {
+      return VectorSearch<T>::FindLast(elements, length, search);
+    }
+#endif
+    for (Size offset = length; offset > 0; --offset) {
+      if (Compare(elements[offset - 1], search) == 0) {
+        return offset - 1;
+      }
+    }
+    return -1;
+  }
+  /// <summary>
+  /// Count all the occurrences of the search element in the given elements.
+  /// Arithmetic elements are compared with vector instructions (when available).
+  /// </summary>
+  /// <typeparam name="T">Element type.</typeparam>
+  /// <param name="elements">Input elements.</param>
+  /// <param name="length">Number of elements.</param>
+  /// <param name="search">Search element.</param>
+  /// <returns>Returns the number of occurrences.</returns>
+  template<typename T>
+  Size Count(const T elements[], const Size length, const T& search) {
+#if defined(SPL_VECTOR_SEARCH)
+    if constexpr (VectorSearch<T>::Enabled) {
+      return VectorSearch<T>::Count(elements, length, search);
+    }
+#endif
+    Size count = 0;
+    for (Size offset = 0; offset < length; ++offset) {
+      if (Compare(elements[offset], search) == 0) {
+        count++;
+      }
+    }
+    return count;
+  }
+}
+
+#undef SPL_TARGET_AVX2
@@ -3,14 +3,433 @@
 ///
 #pragma once
 
+#include "../metadata/integer.hpp"
+#include "../math/min.hpp"
+#include "../math/bits.hpp"
 #include "./compare.hpp"
+#include "./move.hpp"
 #include "./swap.hpp"
 
 namespace SPL {
+  /// <summary>
+  /// Pattern sort class.
+  /// This class implements the Pattern-defeating Quicksort algorithm (an Introsort variant). For more info, please visit:
+  /// https://en.wikipedia.org/wiki/Introsort
+  /// </summary>
+  /// <typeparam name="T">Value type.</typeparam>
+  /// <typeparam name="C">Comparator type.</typeparam>
+  template<typename T, typename C>
+  class PatternSort final {
+  private:
+    /// <summary>
+    /// Ranges smaller than this threshold are sorted using insertion sort.
+    /// </summary>
+    constexpr static Size InsertionThreshold = 24;
+    /// <summary>
+    /// Ranges greater than this threshold use the ninther pivot (pseudo median of 9 elements).
+    /// </summary>
+    constexpr static Size NintherThreshold = 128;
+    /// <summary>
+    /// Maximum number of moves in a partial insertion sort before giving up.
+    /// </summary>
+    constexpr static Size PartialLimit = 8;
+    /// <summary>
+    /// Number of elements scanned per block in the branchless partition.
+    /// </summary>
+    constexpr static Size BlockSize = 64;
+    /// <summary>
+    /// Determines whether or not the branchless partition should be used (cheap comparisons only).
+    /// </summary>
+    constexpr static bool Branchless = Metadata::IsIntegerConvertible<T>;
+    /// <summary>
+    /// Comparator instance.
+    /// </summary>
+    const C& compare;
+    /// <summary>
+    /// Instance constructor.
+    /// </summary>
+    /// <param name="compare">Comparator instance.</param>
+    PatternSort(const C& compare) : compare(compare) {}
+    /// <summary>
+    /// Determines whether or not the first value is less than the second one.
+    /// </summary>
+    /// <param name="source">First value.</param>
+    /// <param name="target">Second value.</param>
+    /// <returns>Returns true when the first value is less, false otherwise.</returns>
+    bool less(const T& source, const T& target) {
+      return this->compare(source, target) < 0;
+    }
+    /// <summary>
+    /// Sort the given values in place when they are out of order.
+    /// </summary>
+    /// <param name="first">First value.</param>
+    /// <param name="second">Second value.</param>
+    void sort2(T* const first, T* const second) {
+      if (this->less(*second, *first)) {
+        Swap(*first, *second);
+      }
+    }
+    /// <summary>
+    /// Sort the given values in place.
+    /// </summary>
+    /// <param name="first">First value.</param>
+    /// <param name="second">Second value.</param>
+    /// <param name="third">Third value.</param>
+    void sort3(T* const first, T* const second, T* const third) {
+      this->sort2(first, second);
+      this->sort2(second, third);
+      this->sort2(first, second);
+    }
+    /// <summary>
+    /// Sort the given range using insertion sort.
+    /// When the range is unguarded, there must be a value before the range that's not greater than any value in it.
+    /// </summary>
+    /// <typeparam name="U">Determines whether or not the range is unguarded.</typeparam>
+    /// <param name="begin">Range begin.</param>
+    /// <param name="end">Range end.</param>
+    template<bool U>
+    void insertionSort(T* const begin, T* const end) {
+      if (begin == end) {
+        return;
+      }
+      for (auto* current = begin + 1; current != end; ++current) {
+        auto* sift = current;
+        auto* previous = current - 1;
+        if (this->less(*sift, *previous)) {
+          T value(Move(*sift));
+          do {
+            *sift-- = Move(*previous);
+          } while ((U || sift != begin) && this->less(value, *--previous));
+          *sift = Move(value);
+        }
+      }
+    }
+    /// <summary>
+    /// Try to sort the given range using insertion sort, giving up after too many moves.
+    /// </summary>
+    /// <param name="begin">Range begin.</param>
+    /// <param name="end">Range end.</param>
+    /// <returns>Returns true when the range was sorted, false otherwise.</returns>
+    bool partialInsertionSort(T* const begin, T* const end) {
+      if (begin == end) {
+        return true;
+      }
+      Size moves = 0;
+      for (auto* current = begin + 1; current != end; ++current) {
+        auto* sift = current;
+        auto* previous = current - 1;
+        if (this->less(*sift, *previous)) {
+          T value(Move(*sift));
+          do {
+            *sift-- = Move(*previous);
+          } while (sift != begin && this->less(value, *--previous));
+          *sift = Move(value);
+          moves += static_cast<Size>(current - sift);
+        }
+        if (moves > PartialLimit) {
+          return false;
+        }
+      }
+      return true;
+    }
+    /// <summary>
+    /// Move the value at the given index down to its heap position.
+    /// </summary>
+    /// <param name="heap">Heap values.</param>
+    /// <param name="index">Value index.</param>
+    /// <param name="length">Heap length.</param>
+    void siftDown(T heap[], Size index, const Size length) {
+      T value(Move(heap[index]));
+      while (true) {
+        auto child = index * 2 + 1;
+        if (child >= length) {
+          break;
+        }
+        if (child + 1 < length && this->less(heap[child], heap[child + 1])) {
+          child++;
+        }
+        if (!this->less(value, heap[child])) {
+          break;
+        }
+        heap[index] = Move(heap[child]);
+        index = child;
+      }
+      heap[index] = Move(value);
+    }
+    /// <summary>
+    /// Sort the given range using heap sort (worst case fallback).
+    /// </summary>
+    /// <param name="begin">Range begin.</param>
+    /// <param name="end">Range end.</param>
+    void heapSort(T* const begin, T* const end) {
+      const auto length = static_cast<Size>(end - begin);
+      for (auto index = length / 2; index > 0; --index) {
+        this->siftDown(begin, index - 1, length);
+      }
+      for (auto last = length - 1; last > 0; --last) {
+        Swap(begin[0], begin[last]);
+        this->siftDown(begin, 0, last);
+      }
+    }
+    /// <summary>
+    /// Exchange the values at the given offsets from both sides of the partition.
+    /// </summary>
+    /// <param name="first">Left base.</param>
+    /// <param name="last">Right base.</param>
+    /// <param name="left">Left offsets.</param>
+    /// <param name="right">Right offsets.</param>
+    /// <param name="count">Number of offsets.</param>
+    /// <param name="swaps">Determines whether or not plain swaps must be used.</param>
+    void swapOffsets(T* const first, T* const last, const unsigned char left[], const unsigned char right[], const Size count, const bool swaps) {
+      if (swaps) {
+        for (Size index = 0; index < count; ++index) {
+          Swap(*(first + left[index]), *(last - right[index]));
+        }
+      }
+      else if (count > 0) {
+        auto* source = first + left[0];
+        auto* target = last - right[0];
+        T value(Move(*source));
+        *source = Move(*target);
+        for (Size index = 1; index < count; ++index) {
+          source = first + left[index];
+          *target = Move(*source);
+          target = last - right[index];
+          *source = Move(*target);
+        }
+        *target = Move(value);
+      }
+    }
+    /// <summary>
+    /// Partition the given range around the first value, equal values go to the right side.
+    /// The comparisons are collected into offset blocks, so the partition loop doesn't branch on the results.
+    /// </summary>
+    /// <param name="begin">Range begin.</param>
+    /// <param name="end">Range end.</param>
+    /// <param name="partitioned">Output flag, true when the range was already partitioned.</param>
+    /// <returns>Returns the final pivot position.</returns>
+    T* partitionBranchless(T* const begin, T* const end, bool& partitioned) {
+      T pivot(Move(*begin));
+      auto* first = begin;
+      auto* last = end;
+      while (this->less(*++first, pivot));
+      if (first - 1 == begin) {
+        while (first < last && !this->less(*--last, pivot));
+      }
+      else {
+        while (!this->less(*--last, pivot));
+      }
+      partitioned = first >= last;
+      if (!partitioned) {
+        Swap(*first, *last);
+        ++first;
+        alignas(64) unsigned char leftOffsets[BlockSize];
+        alignas(64) unsigned char rightOffsets[BlockSize];
+        auto* leftBase = first;
+        auto* rightBase = last;
+        Size leftCount = 0, rightCount = 0, leftStart = 0, rightStart = 0;
+        while (first < last) {
+          const auto unknown = static_cast<Size>(last - first);
+          const auto leftSplit = leftCount == 0 ? (rightCount == 0 ? unknown / 2 : unknown) : 0;
+          const auto rightSplit = rightCount == 0 ? (unknown - leftSplit) : 0;
+          const auto leftLimit = Math::Min(leftSplit, BlockSize);
+          for (Size index = 0; index < leftLimit; ++index) {
+            leftOffsets[leftCount] = static_cast<unsigned char>(index);
+            leftCount += !this->less(*first, pivot);
+            ++first;
+          }
+          const auto rightLimit = Math::Min(rightSplit, BlockSize);
+          for (Size index = 0; index < rightLimit;) {
+            rightOffsets[rightCount] = static_cast<unsigned char>(++index);
+            rightCount += this->less(*--last, pivot);
+          }
+          const auto count = Math::Min(leftCount, rightCount);
+          this->swapOffsets(leftBase, rightBase, leftOffsets + leftStart, rightOffsets + rightStart, count, leftCount == rightCount);
+          leftCount -= count;
+          rightCount -= count;
+          leftStart += count;
+          rightStart += count;
+          if (leftCount == 0) {
+            leftStart = 0;
+            leftBase = first;
+          }
+          if (rightCount == 0) {
+            rightStart = 0;
+            rightBase = last;
+          }
+        }
+        if (leftCount > 0) {
+          while (leftCount-- > 0) {
+            Swap(*(leftBase + leftOffsets[leftStart + leftCount]), *--last);
+          }
+          first = last;
+        }
+        if (rightCount > 0) {
+          while (rightCount-- > 0) {
+            Swap(*(rightBase - rightOffsets[rightStart + rightCount]), *first);
+            ++first;
+          }
+          last = first;
+        }
+      }
+      auto* position = first - 1;
+      *begin = Move(*position);
+      *position = Move(pivot);
+      return position;
+    }
+    /// <summary>
+    /// Partition the given range around the first value, equal values go to the right side.
+    /// </summary>
+    /// <param name="begin">Range begin.</param>
+    /// <param name="end">Range end.</param>
+    /// <param name="partitioned">Output flag, true when the range was already partitioned.</param>
+    /// <returns>Returns the final pivot position.</returns>
+    T* partitionRight(T* const begin, T* const end, bool& partitioned) {
+      T pivot(Move(*begin));
+      auto* first = begin;
+      auto* last = end;
+      while (this->less(*++first, pivot));
+      if (first - 1 == begin) {
+        while (first < last && !this->less(*--last, pivot));
+      }
+      else {
+        while (!this->less(*--last, pivot));
+      }
+      partitioned = first >= last;
+      while (first < last) {
+        Swap(*first, *last);
+        while (this->less(*++first, pivot));
+        while (!this->less(*--last, pivot));
+      }
+      auto* position = first - 1;
+      *begin = Move(*position);
+      *position = Move(pivot);
+      return position;
+    }
+    /// <summary>
+    /// Partition the given range around the first value, equal values go to the left side.
+    /// It's used when the pivot is equal to the previous value, so all the equal values are skipped at once.
+    /// </summary>
+    /// <param name="begin">Range begin.</param>
+    /// <param name="end">Range end.</param>
+    /// <returns>Returns the final pivot position.</returns>
+    T* partitionLeft(T* const begin, T* const end) {
+      T pivot(Move(*begin));
+      auto* first = begin;
+      auto* last = end;
+      while (this->less(pivot, *--last));
+      if (last + 1 == end) {
+        while (first < last && !this->less(pivot, *++first));
+      }
+      else {
+        while (!this->less(pivot, *++first));
+      }
+      while (first < last) {
+        Swap(*first, *last);
+        while (this->less(pivot, *--last));
+        while (!this->less(pivot, *++first));
+      }
+      auto* position = last;
+      *begin = Move(*position);
+      *position = Move(pivot);
+      return position;
+    }
+    /// <summary>
+    /// Sort the given range.
+    /// </summary>
+    /// <param name="begin">Range begin.</param>
+    /// <param name="end">Range end.</param>
+    /// <param name="allowed">Number of bad partitions allowed before switching to heap sort.</param>
+    /// <param name="leftmost">Determines whether or not the range is the leftmost one.</param>
+    void loop(T* begin, T* const end, Size allowed, bool leftmost) {
+      while (true) {
+        const auto size = static_cast<Size>(end - begin);
+        if (size < InsertionThreshold) {
+          if (leftmost) {
+            this->insertionSort<false>(begin, end);
+          }
+          else {
+            this->insertionSort<true>(begin, end);
+          }
+          return;
+        }
+        const auto half = size / 2;
+        if (size > NintherThreshold) {
+          this->sort3(begin, begin + half, end - 1);
+          this->sort3(begin + 1, begin + (half - 1), end - 2);
+          this->sort3(begin + 2, begin + (half + 1), end - 3);
+          this->sort3(begin + (half - 1), begin + half, begin + (half + 1));
+          Swap(*begin, *(begin + half));
+        }
+        else {
+          this->sort3(begin + half, begin, end - 1);
+        }
+        if (!leftmost && !this->less(*(begin - 1), *begin)) {
+          begin = this->partitionLeft(begin, end) + 1;
+          continue;
+        }
+        bool partitioned;
+        T* position;
+        if constexpr (Branchless) {
+          position = this->partitionBranchless(begin, end, partitioned);
+        }
+        else {
+          position = this->partitionRight(begin, end, partitioned);
+        }
+        const auto left = static_cast<Size>(position - begin);
+        const auto right = static_cast<Size>(end - (position + 1));
+        if (left < size / 8 || right < size / 8) {
+          if (--allowed == 0) {
+            this->heapSort(begin, end);
+            return;
+          }
+          if (left >= InsertionThreshold) {
+            Swap(*begin, *(begin + left / 4));
+            Swap(*(position - 1), *(position - left / 4));
+            if (left > NintherThreshold) {
+              Swap(*(begin + 1), *(begin + (left / 4 + 1)));
+              Swap(*(begin + 2), *(begin + (left / 4 + 2)));
+              Swap(*(position - 2), *(position - (left / 4 + 1)));
+              Swap(*(position - 3), *(position - (left / 4 + 2)));
+            }
+          }
+          if (right >= InsertionThreshold) {
+            Swap(*(position + 1), *(position + (1 + right / 4)));
+            Swap(*(end - 1), *(end - right / 4));
+            if (right > NintherThreshold) {
+              Swap(*(position + 2), *(position + (2 + right / 4)));
+              Swap(*(position + 3), *(position + (3 + right / 4)));
+              Swap(*(end - 2), *(end - (1 + right / 4)));
+              Swap(*(end - 3), *(end - (2 + right / 4)));
+            }
+          }
+        }
+        else if (partitioned && this->partialInsertionSort(begin, position) && this->partialInsertionSort(position + 1, end)) {
+          return;
+        }
+        this->loop(begin, position, allowed, leftmost);
+        begin = position + 1;
+        leftmost = false;
+      }
+    }
+  public:
+    /// <summary>
+    /// Sort the given range.
+    /// </summary>
+    /// <param name="begin">Range begin.</param>
+    /// <param name="end">Range end.</param>
+    /// <param name="compare">Comparator instance.</param>
+    static void Sort(T* const begin, T* const end, const C& compare) {
+      const auto length = static_cast<Size>(end - begin);
+      if (length > 1) {
+        PatternSort(compare).loop(begin, end, 64 - Math::CountLeadingZeros(length), true);
+      }
+    }
+  };
   /// <summary>
   /// Default sort function.
-  /// This function uses the Quicksort algorithm. For more info, please visit:
-  /// https://en.wikipedia.org/wiki/Quicksort
+  /// This function uses the Pattern-defeating Quicksort algorithm, the worst case is O(n log n) and inputs with
+  /// sorted runs or many equal values are sorted in linear time.
   /// </summary>
   /// <typeparam name="T">Value type.</typeparam>
   /// <typeparam name="C">Comparator function.</typeparam>
@@ -19,25 +438,25 @@ namespace SPL {
   /// <param name="end">End offset.</param>
   template<typename T, int(C)(const T&, const T&) = &Compare>
   void Sort(T array[], Size start, Size end) {
-    Size middle = (start + end) / 2;
-    Size offset = start;
-    Size bounds = end;
-    while (offset <= bounds) {
-      while (C(array[offset], array[middle]) < 0) {
-        offset++;
-      }
-      while (C(array[bounds], array[middle]) > 0) {
-        bounds--;
-      }
-      if (offset <= bounds) {
-        Swap(array[offset++], array[bounds--]);
-      }
-    }
-    if (start < bounds) {
-      Sort<T, C>(array, start, bounds);
+    if (start < end) {
+      PatternSort<T, Comparator<T, C>>::Sort(&array[start], &array[end] + 1, Comparator<T, C>());
     }
-    if (offset < end) {
-      Sort<T, C>(array, offset, end);
+  }
+  /// <summary>
+  /// Sort function (with comparator instance).
+  /// The comparator can be any callable (like lambdas and functors) returning a negative number, zero or a positive
+  /// number in the same way as the default compare function.
+  /// </summary>
+  /// <typeparam name="T">Value type.</typeparam>
+  /// <typeparam name="C">Comparator type.</typeparam>
+  /// <param name="array">Array of values.</param>
+  /// <param name="start">Start offset.</param>
+  /// <param name="end">End offset.</param>
+  /// <param name="compare">Comparator instance.</param>
+  template<typename T, typename C>
+  void Sort(T array[], Size start, Size end, const C& compare) {
+    if (start < end) {
+      PatternSort<T, C>::Sort(&array[start], &array[end] + 1, compare);
     }
   }
 }
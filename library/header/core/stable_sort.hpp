@@ -0,0 +1,359 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#include "../math/min.hpp"
+#include "./compare.hpp"
+#include "./memory.hpp"
+#include "./move.hpp"
+#include "./swap.hpp"
+#include "./types.hpp"
+
+namespace SPL {
+  /// <summary>
+  /// Merge sort class.
+  /// This class implements an adaptive and stable merge sort (a Timsort variant) that detects natural runs, extends
+  /// short runs using binary insertion sort and merges them keeping the run lengths balanced. For more info, please
+  /// visit: https://en.wikipedia.org/wiki/Timsort
+  /// </summary>
+  /// <typeparam name="T">Value type.</typeparam>
+  /// <typeparam name="C">Comparator type.</typeparam>
+  template<typename T, typename C>
+  class MergeSort final {
+  private:
+    /// <summary>
+    /// Maximum number of pending runs (enough for any range length).
+    /// </summary>
+    constexpr static Size MaxRuns = 96;
+    /// <summary>
+    /// Ranges smaller than this threshold are sorted using a single binary insertion sort.
+    /// </summary>
+    constexpr static Size MinMerge = 64;
+    /// <summary>
+    /// Comparator instance.
+    /// </summary>
+    const C& compare;
+    /// <summary>
+    /// Scratch memory (uninitialized) for the merges.
+    /// </summary>
+    T* buffer;
+    /// <summary>
+    /// Start of each pending run.
+    /// </summary>
+    T* starts[MaxRuns];
+    /// <summary>
+    /// Length of each pending run.
+    /// </summary>
+    Size lengths[MaxRuns];
+    /// <summary>
+    /// Number of pending runs.
+    /// </summary>
+    Size runs;
+    /// <summary>
+    /// Instance constructor.
+    /// </summary>
+    /// <param name="compare">Comparator instance.</param>
+    MergeSort(const C& compare) : compare(compare), buffer(nullptr), runs(0) {}
+    /// <summary>
+    /// Instance destructor.
+    /// </summary>
+    ~MergeSort() {
+      if (this->buffer != nullptr) {
+        Deallocate(this->buffer);
+      }
+    }
+    /// <summary>
+    /// Determines whether or not the first value is less than the second one.
+    /// </summary>
+    /// <param name="source">First value.</param>
+    /// <param name="target">Second value.</param>
+    /// <returns>Returns true when the first value is less, false otherwise.</returns>
+    bool less(const T& source, const T& target) {
+      return this->compare(source, target) < 0;
+    }
+    /// <summary>
+    /// Get the minimum run length for the given range length.
+    /// </summary>
+    /// <param name="length">Range length.</param>
+    /// <returns>Returns the minimum run length.</returns>
+    static Size MinRun(Size length) {
+      Size remainder = 0;
+      while (length >= MinMerge) {
+        remainder |= length & 1;
+        length >>= 1;
+      }
+      return length + remainder;
+    }
+    /// <summary>
+    /// Get the length of the run at the beginning of the given range.
+    /// Strictly descending runs are reversed in place, so the result is always an ascending run.
+    /// </summary>
+    /// <param name="begin">Range begin.</param>
+    /// <param name="end">Range end.</param>
+    /// <returns>Returns the run length.</returns>
+    Size countRun(T* const begin, T* const end) {
+      auto* current = begin + 1;
+      if (current == end) {
+        return 1;
+      }
+      if (this->less(*current, *begin)) {
+        while (++current != end && this->less(*current, *(current - 1)));
+        for (auto *first = begin, *last = current - 1; first < last; ++first, --last) {
+          Swap(*first, *last);
+        }
+      }
+      else {
+        while (++current != end && !this->less(*current, *(current - 1)));
+      }
+      return static_cast<Size>(current - begin);
+    }
+    /// <summary>
+    /// Sort the given range using binary insertion sort, the values before the start must be already sorted.
+    /// </summary>
+    /// <param name="begin">Range begin.</param>
+    /// <param name="end">Range end.</param>
+    /// <param name="start">First unsorted value.</param>
+    void insertionSort(T* const begin, T* const end, T* start) {
+      for (; start != end; ++start) {
+        auto* lower = begin;
+        auto* upper = start;
+        while (lower < upper) {
+          auto* middle = lower + (upper - lower) / 2;
+          if (this->less(*start, *middle)) {
+            upper = middle;
+          }
+          else {
+            lower = middle + 1;
+          }
+        }
+        if (lower != start) {
+          T value(Move(*start));
+          for (auto* current = start; current != lower; --current) {
+            *current = Move(*(current - 1));
+          }
+          *lower = Move(value);
+        }
+      }
+    }
+    /// <summary>
+    /// Get the first position in the given range whose value is greater than the given value.
+    /// </summary>
+    /// <param name="begin">Range begin.</param>
+    /// <param name="end">Range end.</param>
+    /// <param name="value">Value reference.</param>
+    /// <returns>Returns the position.</returns>
+    T* upperBound(T* begin, T* end, const T& value) {
+      while (begin < end) {
+        auto* middle = begin + (end - begin) / 2;
+        if (this->less(value, *middle)) {
+          end = middle;
+        }
+        else {
+          begin = middle + 1;
+        }
+      }
+      return begin;
+    }
+    /// <summary>
+    /// Get the first position in the given range whose value isn't less than the given value.
+    /// </summary>
+    /// <param name="begin">Range begin.</param>
+    /// <param name="end">Range end.</param>
+    /// <param name="value">Value reference.</param>
+    /// <returns>Returns the position.</returns>
+    T* lowerBound(T* begin, T* end, const T& value) {
+      while (begin < end) {
+        auto* middle = begin + (end - begin) / 2;
+        if (this->less(*middle, value)) {
+          begin = middle + 1;
+        }
+        else {
+          end = middle;
+        }
+      }
+      return begin;
+    }
+    /// <summary>
+    /// Merge the given adjacent runs moving the left one into the scratch memory.
+    /// </summary>
+    /// <param name="left">Left run.</param>
+    /// <param name="leftLength">Left run length.</param>
+    /// <param name="right">Right run.</param>
+    /// <param name="rightLength">Right run length.</param>
+    void mergeLow(T* const left, const Size leftLength, T* const right, const Size rightLength) {
+      for (Size offset = 0; offset < leftLength; ++offset) {
+        Construct(&this->buffer[offset], Move(left[offset]));
+      }
+      auto* target = left;
+      auto* source = this->buffer;
+      auto* const sourceEnd = this->buffer + leftLength;
+      auto* other = right;
+      auto* const otherEnd = right + rightLength;
+      while (source != sourceEnd && other != otherEnd) {
+        if (this->less(*other, *source)) {
+          *target++ = Move(*other++);
+        }
+        else {
+          *target++ = Move(*source++);
+        }
+      }
+      while (source != sourceEnd) {
+        *target++ = Move(*source++);
+      }
+      Destroy(this->buffer, leftLength);
+    }
+    /// <summary>
+    /// Merge the given adjacent runs moving the right one into the scratch memory.
+    /// </summary>
+    /// <param name="left">Left run.</param>
+    /// <param name="leftLength">Left run length.</param>
+    /// <param name="right">Right run.</param>
+    /// <param name="rightLength">Right run length.</param>
+    void mergeHigh(T* const left, const Size leftLength, T* const right, const Size rightLength) {
+      for (Size offset = 0; offset < rightLength; ++offset) {
+        Construct(&this->buffer[offset], Move(right[offset]));
+      }
+      auto* target = right + rightLength;
+      auto* source = this->buffer + rightLength;
+      auto* other = left + leftLength;
+      while (source != this->buffer && other != left) {
+        if (this->less(*(source - 1), *(other - 1))) {
+          *--target = Move(*--other);
+        }
+        else {
+          *--target = Move(*--source);
+        }
+      }
+      while (source != this->buffer) {
+        *--target = Move(*--source);
+      }
+      Destroy(this->buffer, rightLength);
+    }
+    /// <summary>
+    /// Merge the pending runs at the given index and the next one.
+    /// </summary>
+    /// <param name="index">Run index.</param>
+    void merge(const Size index) {
+      auto* left = this->starts[index];
+      auto* right = this->starts[index + 1];
+      auto leftLength = this->lengths[index];
+      auto rightLength = this->lengths[index + 1];
+      this->lengths[index] = leftLength + rightLength;
+      for (auto next = index + 1; next + 1 < this->runs; ++next) {
+        this->starts[next] = this->starts[next + 1];
+        this->lengths[next] = this->lengths[next + 1];
+      }
+      this->runs--;
+      auto* first = this->upperBound(left, left + leftLength, *right);
+      leftLength -= static_cast<Size>(first - left);
+      if (leftLength == 0) {
+        return;
+      }
+      rightLength = static_cast<Size>(this->lowerBound(right, right + rightLength, *(right - 1)) - right);
+      if (leftLength <= rightLength) {
+        this->mergeLow(first, leftLength, right, rightLength);
+      }
+      else {
+        this->mergeHigh(first, leftLength, right, rightLength);
+      }
+    }
+    /// <summary>
+    /// Merge the pending runs until their lengths are balanced.
+    /// </summary>
+    void collapse() {
+      while (this->runs > 1) {
+        auto index = this->runs - 2;
+        const auto* lengths = this->lengths;
+        if ((index > 0 && lengths[index - 1] <= lengths[index] + lengths[index + 1])
+          || (index > 1 && lengths[index - 2] <= lengths[index - 1] + lengths[index])) {
+          if (lengths[index - 1] < lengths[index + 1]) {
+            index--;
+          }
+        }
+        else if (lengths[index] > lengths[index + 1]) {
+          break;
+        }
+        this->merge(index);
+      }
+    }
+    /// <summary>
+    /// Sort the given range.
+    /// </summary>
+    /// <param name="begin">Range begin.</param>
+    /// <param name="end">Range end.</param>
+    void run(T* const begin, T* const end) {
+      const auto length = static_cast<Size>(end - begin);
+      if (length < MinMerge) {
+        this->insertionSort(begin, end, begin + this->countRun(begin, end));
+        return;
+      }
+      const auto minimum = MinRun(length);
+      for (auto* current = begin; current != end;) {
+        auto count = this->countRun(current, end);
+        if (count < minimum) {
+          const auto forced = Math::Min(minimum, static_cast<Size>(end - current));
+          this->insertionSort(current, current + forced, current + count);
+          count = forced;
+        }
+        if (this->buffer == nullptr && count < length) {
+          this->buffer = Allocate<T>(length / 2);
+        }
+        this->starts[this->runs] = current;
+        this->lengths[this->runs++] = count;
+        this->collapse();
+        current += count;
+      }
+      while (this->runs > 1) {
+        auto index = this->runs - 2;
+        if (index > 0 && this->lengths[index - 1] < this->lengths[index + 1]) {
+          index--;
+        }
+        this->merge(index);
+      }
+    }
+  public:
+    /// <summary>
+    /// Sort the given range.
+    /// </summary>
+    /// <param name="begin">Range begin.</param>
+    /// <param name="end">Range end.</param>
+    /// <param name="compare">Comparator instance.</param>
+    static void Sort(T* const begin, T* const end, const C& compare) {
+      if (end - begin > 1) {
+        MergeSort(compare).run(begin, end);
+      }
+    }
+  };
+  /// <summary>
+  /// Stable sort function.
+  /// This function uses an adaptive merge sort, equal values keep their relative order, the worst case is
+  /// O(n log n) and inputs made of a few sorted (or reversed) runs are sorted in linear time.
+  /// </summary>
+  /// <typeparam name="T">Value type.</typeparam>
+  /// <typeparam name="C">Comparator function.</typeparam>
+  /// <param name="array">Array of values.</param>
+  /// <param name="start">Start offset.</param>
+  /// <param name="end">End offset.</param>
+  template<typename T, int(C)(const T&, const T&) = &Compare>
+  void StableSort(T array[], Size start, Size end) {
+    if (start < end) {
+      MergeSort<T, Comparator<T, C>>::Sort(&array[start], &array[end] + 1, Comparator<T, C>());
+    }
+  }
+  /// <summary>
+  /// Stable sort function (with comparator instance).
+  /// </summary>
+  /// <typeparam name="T">Value type.</typeparam>
+  /// <typeparam name="C">Comparator type.</typeparam>
+  /// <param name="array">Array of values.</param>
+  /// <param name="start">Start offset.</param>
+  /// <param name="end">End offset.</param>
+  /// <param name="compare">Comparator instance.</param>
+  template<typename T, typename C>
+  void StableSort(T array[], Size start, Size end, const C& compare) {
+    if (start < end) {
+      MergeSort<T, C>::Sort(&array[start], &array[end] + 1, compare);
+    }
+  }
+}
@@ -248,8 +248,8 @@ namespace SPL {
     /// <typeparam name="I">Value index.</typeparam>
     /// <returns>Returns the value.</returns>
     template<Index I>
-    Type<I>& get() const {
-      return static_cast<Value<I, Type<I>>&>(this->elements).value;
+    const Type<I>& get() const {
+      return static_cast<const Value<I, Type<I>>&>(this->elements).value;
     }
     /// <summary>
     /// Get the tuple value that corresponds to the given index.
@@ -7,14 +7,29 @@
 #include "../types/select.hpp"
 
 namespace SPL {
+#if defined(SPL_SIZE_32)
   /// <summary>
-  /// Size type.
+  /// Size type (32-bit on all devices).
   /// </summary>
   using Size = unsigned int;
   /// <summary>
-  /// Index type.
+  /// Index type (32-bit on all devices).
   /// </summary>
   using Index = unsigned int;
+#else
+  /// <summary>
+  /// Size type (64-bit on x64 devices, define SPL_SIZE_32 to keep it 32-bit).
+  /// </summary>
+  using Size = Types::SelectType<Metadata::Device::x64, unsigned long long int, unsigned int>;
+  /// <summary>
+  /// Index type (64-bit on x64 devices, define SPL_SIZE_32 to keep it 32-bit).
+  /// </summary>
+  using Index = Types::SelectType<Metadata::Device::x64, unsigned long long int, unsigned int>;
+#endif
+  /// <summary>
+  /// Compact index type (32-bit on all devices) for memory-compact internal structures.
+  /// </summary>
+  using CompactIndex = unsigned int;
   /// <summary>
   /// Id type.
   /// </summary>
@@ -6,6 +6,10 @@
 #include "./hash_tables/hash_function.hpp"
 #include "./hash_tables/hash_map.hpp"
 #include "./hash_tables/hash_set.hpp"
+#include "./hash_tables/bounded_cache.hpp"
+#include "./hash_tables/sparse_hash_map.hpp"
+#include "./hash_tables/dense_hash_map.hpp"
+#include "./hash_tables/persistent_map.hpp"
 
 namespace SPL {
   /// <summary>
@@ -23,4 +27,37 @@ namespace SPL {
   /// <typeparam name="H">Hash function.</typeparam>
   template<typename T, Id(H)(const T&) = &HashTables::Function>
   using HashSet = HashTables::HashSet<T, H>;
+  /// <summary>
+  /// Bounded cache class.
+  /// </summary>
+  /// <typeparam name="K">Key type.</typeparam>
+  /// <typeparam name="V">Value type.</typeparam>
+  /// <typeparam name="H">Hash function.</typeparam>
+  template<typename K, typename V, Id(H)(const K&) = &HashTables::Function>
+  using BoundedCache = HashTables::BoundedCache<K, V, H>;
+  /// <summary>
+  /// Sparse hash map class.
+  /// </summary>
+  /// <typeparam name="K">Key type.</typeparam>
+  /// <typeparam name="V">Value type.</typeparam>
+  /// <typeparam name="H">Hash function.</typeparam>
+  template<typename K, typename V, Id(H)(const K&) = &HashTables::Function>
+  using SparseHashMap = HashTables::SparseHashMap<K, V, H>;
+  /// <summary>
+  /// Dense hash map class for integer keys.
+  /// </summary>
+  /// <typeparam name="K">Key type.</typeparam>
+  /// <typeparam name="V">Value type.</typeparam>
+  /// <typeparam name="E">Empty key (reserved).</typeparam>
+  /// <typeparam name="D">Deleted key (reserved).</typeparam>
+  template<typename K, typename V, K E = static_cast<K>(-1), K D = static_cast<K>(-2)>
+  using DenseHashMap = HashTables::DenseHashMap<K, V, E, D>;
+  /// <summary>
+  /// Persistent map class.
+  /// </summary>
+  /// <typeparam name="K">Key type.</typeparam>
+  /// <typeparam name="V">Value type.</typeparam>
+  /// <typeparam name="H">Hash function.</typeparam>
+  template<typename K, typename V, Id(H)(const K&) = &HashTables::Function>
+  using PersistentMap = HashTables::PersistentMap<K, V, H>;
 }
@@ -25,6 +25,10 @@ namespace SPL::HashTables {
     /// </summary>
     using KeyType = Metadata::ConstantType<K>;
     /// <summary>
+    /// Determines whether or not the entry keys and values can be transferred by plain copies.
+    /// </summary>
+    constexpr static bool Trivial = (Metadata::IsTriviallyCopyable<KeyType> && ... && Metadata::IsTriviallyCopyable<V>);
+    /// <summary>
     /// Total number of entries.
     /// </summary>
     Size capacity;
@@ -49,6 +53,26 @@ namespace SPL::HashTables {
       Swap(source.size, target.size);
     }
     /// <summary>
+    /// Transfer all properties from the source entry to the target entry.
+    /// Trivial entries are copied member by member, otherwise both entries are exchanged.
+    /// </summary>
+    /// <param name="source">Source entry.</param>
+    /// <param name="target">Target entry.</param>
+    static void Transfer(EntryType& source, EntryType& target) {
+      if constexpr (Trivial) {
+        target.hash = source.hash;
+        target.state = source.state;
+        target.key = source.key;
+        if constexpr (sizeof...(V) > 0) {
+          target.value = source.value;
+        }
+      }
+      else {
+        using SPL::Swap;
+        Swap(source, target);
+      }
+    }
+    /// <summary>
     /// Load the entry index that corresponds to the specified hash and/or key.
     /// </summary>
     /// <param name="hash">Entry hash.</param>
@@ -80,13 +104,12 @@ namespace SPL::HashTables {
     /// </summary>
     /// <param name="capacity">New capacity.</param>
     void resize(const Size capacity) {
-      using SPL::Swap;
       BasicTable table(capacity);
       for (Size offset = 0; table.size < this->size; ++offset) {
         auto& entry = this->entries[offset];
         if (entry.state == EntryState::Occupied) {
           const auto index = table.load(entry.hash, entry.key);
-          Swap(table.entries[index], entry);
+          Transfer(entry, table.entries[index]);
           table.size++;
         }
       }
@@ -99,7 +122,7 @@ namespace SPL::HashTables {
     /// </summary>
     /// <param name="capacity">Initial capacity.</param>
     explicit BasicTable(const Size capacity) :
-      capacity(Math::Max(capacity, 4U)), entries(new EntryType[this->capacity]()), size(0) {}
+      capacity(Math::Max<Size>(capacity, 4)), entries(new EntryType[this->capacity]()), size(0) {}
     /// <summary>
     /// Default constructor.
     /// </summary>
@@ -110,12 +133,20 @@ namespace SPL::HashTables {
     /// </summary>
     /// <param name="other">Other instance.</param>
     BasicTable(const BasicTable& other) : BasicTable(other.capacity) {
-      for (Size offset = 0; this->size < other.size; ++offset) {
-        auto& entry = other.entries[offset];
-        if (entry.state == EntryState::Occupied) {
-          const auto index = this->load(entry.hash, entry.key);
-          this->entries[index] = entry;
-          this->size++;
+      if constexpr (Trivial) {
+        for (Size offset = 0; offset < other.capacity; ++offset) {
+          Transfer(other.entries[offset], this->entries[offset]);
+        }
+        this->size = other.size;
+      }
+      else {
+        for (Size offset = 0; this->size < other.size; ++offset) {
+          auto& entry = other.entries[offset];
+          if (entry.state == EntryState::Occupied) {
+            const auto index = this->load(entry.hash, entry.key);
+            this->entries[index] = entry;
+            this->size++;
+          }
         }
       }
     }
@@ -148,6 +179,17 @@ namespace SPL::HashTables {
       return this->size;
     }
     /// <summary>
+    /// Get the entry that corresponds to the specified slot index.
+    /// </summary>
+    /// <param name="index">Zero-based slot index.</param>
+    /// <returns>Returns a pointer to the corresponding entry or null when the index is out of bounds.</returns>
+    EntryType* at(const Index index) const {
+      if (index < this->capacity) {
+        return &this->entries[index];
+      }
+      return nullptr;
+    }
+    /// <summary>
     /// Set an entry for the specified key by using move semantics.
     /// If the entry doesn't exists try to create a new one.
     /// </summary>
@@ -226,7 +268,7 @@ namespace SPL::HashTables {
     /// </summary>
     /// <param name="capacity">New capacity.</param>
     void enlarge(const Size capacity) {
-      const auto newer = Math::Max(capacity, 4U);
+      const auto newer = Math::Max<Size>(capacity, 4);
       if (newer > this->capacity) {
         this->resize(newer);
       }
@@ -237,11 +279,20 @@ namespace SPL::HashTables {
     /// </summary>
     /// <param name="capacity">New capacity.</param>
     void shrink(const Size capacity) {
-      const auto newer = Math::Max(capacity, 4U);
+      const auto newer = Math::Max<Size>(capacity, 4);
       if (newer > this->size && newer < this->capacity) {
         this->resize(newer);
       }
     }
+    /// <summary>
+    /// Rehash all entries keeping the current capacity.
+    /// All the deleted entries are discarded, so the free slots can stop the probing again.
+    /// </summary>
+    void rehash() {
+      if (this->capacity > 0) {
+        this->resize(this->capacity);
+      }
+    }
   public:
     /// <summary>
     /// Assign all properties from the given table.
@@ -0,0 +1,360 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#include "./types.hpp"
+#include "./basic_table.hpp"
+
+namespace SPL::HashTables {
+  /// <summary>
+  /// Bounded cache class.
+  /// This cache uses the CLOCK (second chance) eviction policy. For more info, please visit:
+  /// https://en.wikipedia.org/wiki/Page_replacement_algorithm#Clock
+  /// The reference bits are stored in the table entries and the clock hand walks through the table slots,
+  /// so there's no additional allocation per entry.
+  /// </summary>
+  /// <typeparam name="K">Key type.</typeparam>
+  /// <typeparam name="V">Value type.</typeparam>
+  /// <typeparam name="H">Hash function.</typeparam>
+  template<typename K, typename V, Id(H)(const K&)>
+  class BoundedCache final {
+  public:
+    /// <summary>
+    /// Eviction callback type.
+    /// </summary>
+    using Callback = void(*)(const K& key, V& value);
+  private:
+    /// <summary>
+    /// Non-constant value type.
+    /// </summary>
+    using ValueType = Metadata::ConstantType<V>;
+    /// <summary>
+    /// Cache slot class.
+    /// </summary>
+    class Slot final {
+    private:
+      /// <summary>
+      /// Exchange all properties from the given objects.
+      /// </summary>
+      /// <param name="source">Source object.</param>
+      /// <param name="target">Target object.</param>
+      friend void Swap(Slot& source, Slot& target) noexcept {
+        using SPL::Swap;
+        Swap(source.value, target.value);
+        Swap(source.referenced, target.referenced);
+      }
+    public:
+      /// <summary>
+      /// Slot value.
+      /// </summary>
+      ValueType value;
+      /// <summary>
+      /// Determines whether or not the slot was referenced since the last clock hand pass.
+      /// </summary>
+      bool referenced;
+    public:
+      /// <summary>
+      /// Default constructor.
+      /// </summary>
+      Slot() :
+        value(), referenced(false) {}
+      /// <summary>
+      /// Copy constructor.
+      /// </summary>
+      /// <param name="other">Other instance.</param>
+      Slot(const Slot& other) :
+        value(other.value), referenced(other.referenced) {}
+      /// <summary>
+      /// Move constructor.
+      /// </summary>
+      /// <param name="other">Other instance.</param>
+      Slot(Slot&& other) noexcept : Slot() {
+        Swap(*this, other);
+      }
+    public:
+      /// <summary>
+      /// Assign all properties from the given slot.
+      /// </summary>
+      /// <param name="other">Other instance.</param>
+      /// <returns>Returns the instance itself.</returns>
+      Slot& operator = (Slot other) noexcept {
+        Swap(*this, other);
+        return *this;
+      }
+    };
+    /// <summary>
+    /// Hash entry type.
+    /// </summary>
+    using EntryType = HashEntry<K, Slot>;
+    /// <summary>
+    /// Base table.
+    /// </summary>
+    BasicTable<H, K, Slot> table;
+    /// <summary>
+    /// Maximum number of entries.
+    /// </summary>
+    Size limit;
+    /// <summary>
+    /// Current clock hand position.
+    /// </summary>
+    Index hand;
+    /// <summary>
+    /// Number of removals since the last rehash.
+    /// </summary>
+    Size removals;
+    /// <summary>
+    /// Number of lookups that found the key.
+    /// </summary>
+    Size hits;
+    /// <summary>
+    /// Number of lookups that didn't find the key.
+    /// </summary>
+    Size misses;
+    /// <summary>
+    /// Number of evicted entries.
+    /// </summary>
+    Size evictions;
+    /// <summary>
+    /// Eviction callback.
+    /// </summary>
+    Callback callback;
+  private:
+    /// <summary>
+    /// Exchange all properties from the given objects.
+    /// </summary>
+    /// <param name="source">Source object.</param>
+    /// <param name="target">Target object.</param>
+    friend void Swap(BoundedCache& source, BoundedCache& target) noexcept {
+      using SPL::Swap;
+      Swap(source.table, target.table);
+      Swap(source.limit, target.limit);
+      Swap(source.hand, target.hand);
+      Swap(source.removals, target.removals);
+      Swap(source.hits, target.hits);
+      Swap(source.misses, target.misses);
+      Swap(source.evictions, target.evictions);
+      Swap(source.callback, target.callback);
+    }
+    /// <summary>
+    /// Account a new deleted entry in the table.
+    /// When the deleted entries may consume half of the free slots, the table is rehashed.
+    /// </summary>
+    void release() {
+      if (++this->removals >= (this->table.getCapacity() - this->limit) / 2) {
+        this->table.rehash();
+        this->removals = 0;
+      }
+    }
+    /// <summary>
+    /// Discard the given entry from the table.
+    /// </summary>
+    /// <param name="entry">Table entry.</param>
+    void discard(EntryType* const entry) {
+      entry->value.value = ValueType();
+      this->table.unset(entry->getKey());
+      this->release();
+    }
+    /// <summary>
+    /// Move the clock hand until an unreferenced entry is found and evict it.
+    /// Referenced entries found along the way get a second chance.
+    /// </summary>
+    /// <param name="keep">Entry that must not be evicted.</param>
+    void evict(const EntryType* const keep) {
+      const auto capacity = this->table.getCapacity();
+      while (true) {
+        auto* entry = this->table.at(this->hand);
+        this->hand = (this->hand + 1) % capacity;
+        if (entry != keep && entry->getState() == EntryState::Occupied) {
+          if (entry->value.referenced) {
+            entry->value.referenced = false;
+            continue;
+          }
+          if (this->callback != nullptr) {
+            this->callback(entry->getKey(), entry->value.value);
+          }
+          this->evictions++;
+          this->discard(entry);
+          return;
+        }
+      }
+    }
+  public:
+    /// <summary>
+    /// Initialized constructor.
+    /// </summary>
+    /// <param name="capacity">Maximum number of entries.</param>
+    /// <param name="callback">Eviction callback.</param>
+    explicit BoundedCache(const Size capacity, const Callback callback = nullptr) :
+      table(NP2(capacity + (capacity >> 1) + 1)), limit(Math::Max<Size>(capacity, 1)),
+      hand(0), removals(0), hits(0), misses(0), evictions(0), callback(callback) {}
+    /// <summary>
+    /// Copy constructor.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    BoundedCache(const BoundedCache& other) :
+      table(other.table), limit(other.limit), hand(other.hand), removals(0),
+      hits(other.hits), misses(other.misses), evictions(other.evictions), callback(other.callback) {}
+    /// <summary>
+    /// Move constructor.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    BoundedCache(BoundedCache&& other) noexcept :
+      table(), limit(0), hand(0), removals(0), hits(0), misses(0), evictions(0), callback(nullptr) {
+      Swap(*this, other);
+    }
+  public:
+    /// <summary>
+    /// Get the maximum number of entries in the cache.
+    /// </summary>
+    /// <returns>Returns the cache capacity.</returns>
+    Size getCapacity() const {
+      return this->limit;
+    }
+    /// <summary>
+    /// Get the number of entries in the cache.
+    /// </summary>
+    /// <returns>Returns the cache size.</returns>
+    Size getSize() const {
+      return this->table.getSize();
+    }
+    /// <summary>
+    /// Determines whether or not the cache is empty.
+    /// </summary>
+    /// <returns>Returns true when it's empty, false otherwise.</returns>
+    bool isEmpty() const {
+      return this->table.getSize() == 0;
+    }
+    /// <summary>
+    /// Get the number of lookups that found the key.
+    /// </summary>
+    /// <returns>Returns the number of hits.</returns>
+    Size getHits() const {
+      return this->hits;
+    }
+    /// <summary>
+    /// Get the number of lookups that didn't find the key.
+    /// </summary>
+    /// <returns>Returns the number of misses.</returns>
+    Size getMisses() const {
+      return this->misses;
+    }
+    /// <summary>
+    /// Get the number of evicted entries.
+    /// </summary>
+    /// <returns>Returns the number of evictions.</returns>
+    Size getEvictions() const {
+      return this->evictions;
+    }
+    /// <summary>
+    /// Put the specified key in the cache to map the given value by using move semantics.
+    /// When the cache is full and the key doesn't exists, an entry will be evicted.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <param name="value">Entry value.</param>
+    void put(const K& key, ValueType&& value) {
+      using SPL::Swap;
+      // Find or insert the entry in a single probe, the table always has room for one entry over the limit.
+      const auto size = this->table.getSize();
+      auto* entry = this->table.set(key);
+      if (this->table.getSize() == size) {
+        entry->value.referenced = true;
+        Swap(entry->value.value, value);
+      }
+      else {
+        entry->value.referenced = false;
+        Swap(entry->value.value, value);
+        if (size == this->limit) {
+          this->evict(entry);
+        }
+      }
+    }
+    /// <summary>
+    /// Put the specified key in the cache to map a copy of the given value.
+    /// When the cache is full and the key doesn't exists, an entry will be evicted.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <param name="value">Entry value.</param>
+    void put(const K& key, const ValueType& value) {
+      ValueType copy(value);
+      this->put(key, Move(copy));
+    }
+    /// <summary>
+    /// Get the value that corresponds to the specified key.
+    /// The entry is marked as referenced and the lookup is counted as a hit or a miss.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <returns>Returns the corresponding entry value.</returns>
+    /// <exception cref="SPL::Exceptions::KeyNotFound">Throws when the specified key doesn't exists.</exception>
+    V& get(const K& key) {
+      auto* entry = this->table.get(key);
+      if (entry == nullptr) {
+        this->misses++;
+        throw Exceptions::KeyNotFound<K>(key);
+      }
+      this->hits++;
+      entry->value.referenced = true;
+      return entry->value.value;
+    }
+    /// <summary>
+    /// Get a copy of the value that corresponds to the specified key.
+    /// The entry is marked as referenced and the lookup is counted as a hit or a miss.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <param name="value">Output value.</param>
+    /// <returns>Returns true when the value was found, false otherwise.</returns>
+    bool get(const K& key, ValueType& value) {
+      auto* entry = this->table.get(key);
+      if (entry == nullptr) {
+        this->misses++;
+        return false;
+      }
+      this->hits++;
+      entry->value.referenced = true;
+      value = entry->value.value;
+      return true;
+    }
+    /// <summary>
+    /// Determines whether or not the cache contains the specified key.
+    /// It doesn't change the entry reference neither the lookup counters.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <returns>Returns true when the key was found, false otherwise.</returns>
+    bool has(const K& key) const {
+      return this->table.get(key) != nullptr;
+    }
+    /// <summary>
+    /// Remove the specified key from the cache.
+    /// The eviction callback isn't called for removed entries.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <returns>Returns true when the key was removed, false otherwise.</returns>
+    bool remove(const K& key) {
+      auto* entry = this->table.get(key);
+      if (entry != nullptr) {
+        this->discard(entry);
+        return true;
+      }
+      return false;
+    }
+    /// <summary>
+    /// Clear the cache.
+    /// The lookup and eviction counters will remains the same.
+    /// </summary>
+    void clear() {
+      this->table.clear();
+      this->hand = 0;
+      this->removals = 0;
+    }
+  public:
+    /// <summary>
+    /// Assign all properties from the given cache.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    /// <returns>Returns the instance itself.</returns>
+    BoundedCache& operator = (BoundedCache other) noexcept {
+      Swap(*this, other);
+      return *this;
+    }
+  };
+}
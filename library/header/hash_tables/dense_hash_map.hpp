@@ -0,0 +1,450 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#include "./types.hpp"
+#include "./dense_iterator.hpp"
+#include "./slot_iterator.hpp"
+
+namespace SPL::HashTables {
+  /// <summary>
+  /// Dense hash map class for integer keys.
+  /// The empty and deleted slots are represented by two reserved key values, so each entry is just a key/value pair
+  /// with no stored hash or state. Slots are addressed by a Fibonacci hash (multiplicative mix) of the key and
+  /// probed linearly through a power of two mask.
+  /// </summary>
+  /// <typeparam name="K">Key type.</typeparam>
+  /// <typeparam name="V">Value type.</typeparam>
+  /// <typeparam name="E">Empty key.</typeparam>
+  /// <typeparam name="D">Deleted key.</typeparam>
+  template<typename K, typename V, K E, K D>
+  class DenseHashMap final : public Map<K, V>, public Iterable<Pair<Metadata::ConstantType<K>, V>> {
+    static_assert(Metadata::IsInteger<K>, "SPL::HashTables::DenseHashMap is only implemented for integer key types (K).");
+    static_assert(E != D, "The empty key (E) and the deleted key (D) must be different.");
+  private:
+    /// <summary>
+    /// Dense entry type.
+    /// </summary>
+    using EntryType = Pair<Metadata::ConstantType<K>, V>;
+    /// <summary>
+    /// Non-constant value type.
+    /// </summary>
+    using ValueType = Metadata::ConstantType<V>;
+    /// <summary>
+    /// Total number of entries.
+    /// </summary>
+    Size capacity;
+    /// <summary>
+    /// Hash shift for the current capacity.
+    /// </summary>
+    Size shift;
+    /// <summary>
+    /// Array of entries.
+    /// </summary>
+    EntryType* entries;
+    /// <summary>
+    /// Current number of entries.
+    /// </summary>
+    Size size;
+    /// <summary>
+    /// Current number of deleted entries.
+    /// </summary>
+    Size deleted;
+  private:
+    /// <summary>
+    /// Exchange all properties from the given objects.
+    /// </summary>
+    /// <param name="source">Source object.</param>
+    /// <param name="target">Target object.</param>
+    friend void Swap(DenseHashMap& source, DenseHashMap& target) noexcept {
+      using SPL::Swap;
+      Swap(source.capacity, target.capacity);
+      Swap(source.shift, target.shift);
+      Swap(source.entries, target.entries);
+      Swap(source.size, target.size);
+      Swap(source.deleted, target.deleted);
+    }
+    /// <summary>
+    /// Determines whether or not the specified key is reserved.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <returns>Returns true when the key is reserved, false otherwise.</returns>
+    constexpr static bool IsReserved(const K& key) {
+      return key == E || key == D;
+    }
+    /// <summary>
+    /// Determines whether or not the specified entry is in use.
+    /// </summary>
+    /// <param name="entry">Dense entry.</param>
+    /// <returns>Returns true when the entry is in use, false otherwise.</returns>
+    static bool IsUsed(const EntryType& entry) {
+      return !IsReserved(entry.key);
+    }
+    /// <summary>
+    /// Slot iterator type.
+    /// </summary>
+    using SlotType = SlotIterator<EntryType, IsUsed>;
+    /// <summary>
+    /// Load the entry index that corresponds to the specified key.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <returns>Returns the index of the corresponding entry.</returns>
+    Index load(const K& key) const {
+      const Size mask = this->capacity - 1;
+      const auto mixed = static_cast<unsigned long long int>(key) * 0x9E3779B97F4A7C15ULL;
+      Index index = static_cast<Index>(mixed >> this->shift);
+      Index preferred = -1;
+      for (Size offset = 0; offset < this->capacity; ++offset) {
+        const auto& current = this->entries[index].key;
+        if (current == key) {
+          return index;
+        }
+        if (current == E) {
+          return preferred != -1 ? preferred : index;
+        }
+        if (current == D && preferred == -1) {
+          preferred = index;
+        }
+        index = (index + 1) & mask;
+      }
+      return preferred;
+    }
+    /// <summary>
+    /// Resize the current capacity based on the given capacity and rehash all entries.
+    /// IMPORTANT: Make sure the new capacity is a power of two and can store all the current entries.
+    /// </summary>
+    /// <param name="capacity">New capacity.</param>
+    void resize(const Size capacity) {
+      using SPL::Swap;
+      DenseHashMap map(capacity);
+      for (Size offset = 0; map.size < this->size; ++offset) {
+        auto& entry = this->entries[offset];
+        if (!IsReserved(entry.key)) {
+          Swap(map.entries[map.load(entry.key)], entry);
+          map.size++;
+        }
+      }
+      Swap(*this, map);
+    }
+    /// <summary>
+    /// Enlarge the current capacity or discard the deleted entries before inserting a new entry.
+    /// When the number of used entries is greater than or equals to 0.7f of the capacity, the map is rehashed.
+    /// </summary>
+    void enlarge() {
+      if (this->capacity == 0) {
+        this->resize(4);
+      }
+      else if (static_cast<float>(this->size + this->deleted + 1) >= this->capacity * 0.7f) {
+        if (static_cast<float>(this->size + 1) > this->capacity * 0.5f) {
+          this->resize(this->capacity << 1);
+        }
+        else {
+          this->resize(this->capacity);
+        }
+      }
+    }
+    /// <summary>
+    /// Shrink the current capacity.
+    /// </summary>
+    void shrink() {
+      if (this->capacity > 4 && this->getLoadFactor() <= 0.2f) {
+        this->resize(this->capacity >> 1);
+      }
+    }
+    /// <summary>
+    /// Get the entry that corresponds to the specified key.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <returns>Returns a pointer to the corresponding entry or null when the key doesn't exists.</returns>
+    EntryType* find(const K& key) const {
+      if (this->capacity > 0 && !IsReserved(key)) {
+        const auto index = this->load(key);
+        if (index != -1 && this->entries[index].key == key) {
+          return &this->entries[index];
+        }
+      }
+      return nullptr;
+    }
+    /// <summary>
+    /// Get the entry that corresponds to the specified key.
+    /// It creates a new entry when the given key doesn't exists.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <returns>Returns a pointer to the corresponding entry.</returns>
+    /// <exception cref="SPL::Exceptions::InvalidArgument">Throws when the specified key is reserved.</exception>
+    EntryType* insert(const K& key) {
+      if (IsReserved(key)) {
+        throw Exceptions::InvalidArgument();
+      }
+      auto* entry = this->find(key);
+      if (entry == nullptr) {
+        this->enlarge();
+        entry = &this->entries[this->load(key)];
+        if (entry->key == D) {
+          this->deleted--;
+        }
+        entry->key = key;
+        this->size++;
+      }
+      return entry;
+    }
+    /// <summary>
+    /// Move the value out of the entry that corresponds to the specified key and release it.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <param name="value">Output value.</param>
+    /// <returns>Returns true when the entry was released, false otherwise.</returns>
+    bool release(const K& key, ValueType& value) {
+      auto* entry = this->find(key);
+      if (entry != nullptr) {
+        using SPL::Swap;
+        ValueType empty{};
+        Swap(value, entry->value);
+        Swap(entry->value, empty);
+        entry->key = D;
+        this->size--;
+        this->deleted++;
+        this->shrink();
+        return true;
+      }
+      return false;
+    }
+  public:
+    /// <summary>
+    /// Initialized constructor.
+    /// </summary>
+    /// <param name="capacity">Initial capacity.</param>
+    explicit DenseHashMap(const Size capacity) :
+      capacity(NP2(Math::Max<Size>(capacity, 4))), shift(64 - Math::CountTrailingZeros(this->capacity)),
+      entries(new EntryType[this->capacity]()), size(0), deleted(0) {
+      for (Size offset = 0; offset < this->capacity; ++offset) {
+        this->entries[offset].key = E;
+      }
+    }
+    /// <summary>
+    /// Initialized constructor.
+    /// </summary>
+    /// <param name="values">Initial values.</param>
+    template<Size N>
+    DenseHashMap(const Pair<K, V>(&pairs)[N]) : DenseHashMap(N) {
+      for (const auto& pair : pairs) {
+        this->set(pair.key, pair.value);
+      }
+    }
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    DenseHashMap() :
+      capacity(0), shift(64), entries(nullptr), size(0), deleted(0) {}
+    /// <summary>
+    /// Copy constructor.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    DenseHashMap(const DenseHashMap& other) :
+      capacity(other.capacity), shift(other.shift), entries(nullptr), size(other.size), deleted(other.deleted) {
+      if (other.entries != nullptr) {
+        this->entries = new EntryType[this->capacity]();
+        for (Size offset = 0; offset < this->capacity; ++offset) {
+          this->entries[offset] = other.entries[offset];
+        }
+      }
+    }
+    /// <summary>
+    /// Move constructor.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    DenseHashMap(DenseHashMap&& other) noexcept : DenseHashMap() {
+      Swap(*this, other);
+    }
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    ~DenseHashMap() {
+      delete[] this->entries;
+    }
+  public:
+    /// <summary>
+    /// Get the dense hash map capacity.
+    /// </summary>
+    /// <returns>Returns the dense hash map capacity.</returns>
+    Size getCapacity() const {
+      return this->capacity;
+    }
+    /// <summary>
+    /// Get the load factor (between 0.0f and 1.0f).
+    /// </summary>
+    /// <returns>Returns the load factor.</returns>
+    float getLoadFactor() const {
+      return Math::Min((static_cast<float>(this->getSize()) / this->getCapacity()), 1.0f);
+    }
+    /// <summary>
+    /// Get the number of entries in the dense hash map.
+    /// </summary>
+    /// <returns>Returns the map size.</returns>
+    Size getSize() const override {
+      return this->size;
+    }
+    /// <summary>
+    /// Determines whether or not the dense hash map is empty.
+    /// </summary>
+    /// <returns>Returns true when the it's empty, false otherwise.</returns>
+    bool isEmpty() const override {
+      return this->size == 0;
+    }
+    /// <summary>
+    /// Get a new entry iterator.
+    /// </summary>
+    /// <returns>Returns the new iterator.</returns>
+    UniqueIterator<EntryType> getIterator() const override {
+      auto* iterator = new DenseIterator<K, V, E, D>(this->entries, this->size);
+      return UniqueIterator<EntryType>(iterator);
+    }
+    /// <summary>
+    /// Get an iterator at the first entry in use for range-based loops.
+    /// </summary>
+    /// <returns>Returns the slot iterator.</returns>
+    SlotType begin() const {
+      return SlotType(this->entries, this->entries + this->capacity);
+    }
+    /// <summary>
+    /// Get an iterator past the last entry in use for range-based loops.
+    /// </summary>
+    /// <returns>Returns the slot iterator.</returns>
+    SlotType end() const {
+      return SlotType(this->entries + this->capacity, this->entries + this->capacity);
+    }
+    /// <summary>
+    /// Set the specified key to map the given value by using move semantics.
+    /// When the used entries reach 0.7f of the capacity the map is rehashed and its capacity may double.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <param name="value">Entry value.</param>
+    /// <returns>Returns the previous value for the given key.</returns>
+    /// <exception cref="SPL::Exceptions::InvalidArgument">Throws when the specified key is reserved.</exception>
+    V set(const K& key, ValueType&& value) override {
+      auto* entry = this->insert(key);
+      V previous(Move(entry->value));
+      using SPL::Swap;
+      Swap(entry->value, value);
+      return previous;
+    }
+    /// <summary>
+    /// Set the specified key using the given value.
+    /// When the used entries reach 0.7f of the capacity the map is rehashed and its capacity may double.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <param name="value">Entry value.</param>
+    /// <returns>Returns the previous value for the given key.</returns>
+    /// <exception cref="SPL::Exceptions::InvalidArgument">Throws when the specified key is reserved.</exception>
+    V set(const K& key, const ValueType& value) override {
+      ValueType copy(value);
+      return this->set(key, Move(copy));
+    }
+    /// <summary>
+    /// Get the value that corresponds to the specified key.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <returns>Returns the corresponding entry value.</returns>
+    /// <exception cref="SPL::Exceptions::KeyNotFound">Throws when the specified key doesn't exists.</exception>
+    V& get(const K& key) const override {
+      auto* entry = this->find(key);
+      if (entry == nullptr) {
+        throw Exceptions::KeyNotFound<K>(key);
+      }
+      return entry->value;
+    }
+    /// <summary>
+    /// Get a copy of the value that corresponds to the specified key.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <param name="value">Output value.</param>
+    /// <returns>Returns true when the value was found, false otherwise.</returns>
+    bool get(const K& key, ValueType& value) const override {
+      auto* entry = this->find(key);
+      if (entry != nullptr) {
+        value = entry->value;
+        return true;
+      }
+      return false;
+    }
+    /// <summary>
+    /// Determines whether or not the dense hash map contains the specified key.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <returns>Returns true when the key was found, false otherwise.</returns>
+    bool has(const K& key) const override {
+      return this->find(key) != nullptr;
+    }
+    /// <summary>
+    /// Remove the specified key from the dense hash map.
+    /// When the load factor is less than or equals to 0.2f the map capacity will reduce by half.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <returns>Returns the removed value.</returns>
+    /// <exception cref="SPL::Exceptions::KeyNotFound">Throws when the specified key doesn't exists.</exception>
+    V remove(const K& key) override {
+      ValueType previous;
+      if (!this->release(key, previous)) {
+        throw Exceptions::KeyNotFound<K>(key);
+      }
+      return previous;
+    }
+    /// <summary>
+    /// Remove the specified key from the dense hash map.
+    /// When the load factor is less than or equals to 0.2f the map capacity will reduce by half.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <param name="value">Output value.</param>
+    /// <returns>Returns true when the value was removed, false otherwise.</returns>
+    bool remove(const K& key, ValueType& value) override {
+      return this->release(key, value);
+    }
+    /// <summary>
+    /// Clear the dense hash map.
+    /// The current capacity will remains the same.
+    /// </summary>
+    void clear() override {
+      using SPL::Swap;
+      for (Size offset = 0; offset < this->capacity; ++offset) {
+        auto& entry = this->entries[offset];
+        if (entry.key != E) {
+          ValueType empty{};
+          Swap(entry.value, empty);
+          entry.key = E;
+        }
+      }
+      this->size = 0;
+      this->deleted = 0;
+    }
+  public:
+    /// <summary>
+    /// Alias for the get method.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <returns>Returns the corresponding entry value.</returns>
+    const V& operator [](const K& key) const override {
+      return this->get(key);
+    }
+    /// <summary>
+    /// Get the value that corresponds to the specified key.
+    /// It creates a new entry when the given key doesn't exists.
+    /// When the used entries reach 0.7f of the capacity the map is rehashed and its capacity may double.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <returns>Returns the corresponding entry value.</returns>
+    /// <exception cref="SPL::Exceptions::InvalidArgument">Throws when the specified key is reserved.</exception>
+    V& operator [](const K& key) override {
+      return this->insert(key)->value;
+    }
+    /// <summary>
+    /// Assign all properties from the given dense hash map.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    /// <returns>Returns the instance itself.</returns>
+    DenseHashMap& operator = (DenseHashMap other) noexcept {
+      Swap(*this, other);
+      return *this;
+    }
+  };
+}
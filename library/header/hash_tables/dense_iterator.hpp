@@ -0,0 +1,71 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#include "./types.hpp"
+
+namespace SPL::HashTables {
+  /// <summary>
+  /// Dense iterator class.
+  /// </summary>
+  /// <typeparam name="K">Key type.</typeparam>
+  /// <typeparam name="V">Value type.</typeparam>
+  /// <typeparam name="E">Empty key.</typeparam>
+  /// <typeparam name="D">Deleted key.</typeparam>
+  template<typename K, typename V, K E, K D>
+  class DenseIterator : public Iterator<Pair<Metadata::ConstantType<K>, V>> {
+  private:
+    /// <summary>
+    /// Dense entry type.
+    /// </summary>
+    using EntryType = Pair<Metadata::ConstantType<K>, V>;
+    /// <summary>
+    /// Array of entries.
+    /// </summary>
+    const EntryType* entries;
+    /// <summary>
+    /// Total number of entries.
+    /// </summary>
+    Size size;
+    /// <summary>
+    /// Current count.
+    /// </summary>
+    Size count;
+    /// <summary>
+    /// Current index.
+    /// </summary>
+    Index index;
+  public:
+    /// <summary>
+    /// Initialized constructor.
+    /// </summary>
+    /// <param name="entries">Array of entries.</param>
+    /// <param name="size">Total number of entries.</param>
+    DenseIterator(const EntryType* const entries, const Size size) :
+      entries(entries), size(size), count(0), index(0) {}
+  public:
+    /// <summary>
+    /// Check whether or not the iterator has the next entry.
+    /// </summary>
+    /// <returns>Returns true when the next entry exists, false otherwise.</returns>
+    bool hasNext() const override {
+      return this->count < this->size;
+    }
+    /// <summary>
+    /// Move to the next entry and get the current one.
+    /// </summary>
+    /// <returns>Returns the current entry.</returns>
+    /// <exception cref="SPL::Exceptions::InvalidOperation">Throws when there's no next entry.</exception>
+    const EntryType& next() override {
+      if (this->count >= this->size) {
+        throw Exceptions::InvalidOperation();
+      }
+      while (this->entries[this->index].key == E || this->entries[this->index].key == D) {
+        this->index++;
+      }
+      this->count++;
+      return this->entries[this->index++];
+    }
+  };
+}
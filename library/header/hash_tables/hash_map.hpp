@@ -5,6 +5,7 @@
 
 #include "./types.hpp"
 #include "./entry_iterator.hpp"
+#include "./slot_iterator.hpp"
 #include "./basic_table.hpp"
 
 namespace SPL::HashTables {
@@ -22,6 +23,10 @@ namespace SPL::HashTables {
     /// </summary>
     using EntryType = HashEntry<K, V>;
     /// <summary>
+    /// Slot iterator type.
+    /// </summary>
+    using SlotType = SlotIterator<EntryType, IsOccupied<EntryType>>;
+    /// <summary>
     /// Non-constant value type.
     /// </summary>
     using ValueType = Metadata::ConstantType<V>;
@@ -118,6 +123,22 @@ namespace SPL::HashTables {
       return UniqueIterator<EntryType>(iterator);
     }
     /// <summary>
+    /// Get an iterator at the first occupied entry for range-based loops.
+    /// </summary>
+    /// <returns>Returns the slot iterator.</returns>
+    SlotType begin() const {
+      const EntryType* entries = this->table;
+      return SlotType(entries, entries + this->table.getCapacity());
+    }
+    /// <summary>
+    /// Get an iterator past the last occupied entry for range-based loops.
+    /// </summary>
+    /// <returns>Returns the slot iterator.</returns>
+    SlotType end() const {
+      const EntryType* entries = this->table;
+      return SlotType(entries + this->table.getCapacity(), entries + this->table.getCapacity());
+    }
+    /// <summary>
     /// Set the specified key to map the given value by using move semantics.
     /// When the load factor is greater than or equals to 0.7f the current capacity will double.
     /// </summary>
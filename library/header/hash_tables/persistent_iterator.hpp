@@ -0,0 +1,257 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#include <iterator>
+
+#include "./types.hpp"
+#include "./persistent_node.hpp"
+
+namespace SPL::HashTables {
+  /// <summary>
+  /// Persistent iterator class.
+  /// The iterator holds a reference to the root node, so it keeps iterating the same version of the map
+  /// even when the map is changed or destroyed.
+  /// </summary>
+  /// <typeparam name="K">Key type.</typeparam>
+  /// <typeparam name="V">Value type.</typeparam>
+  template<typename K, typename V>
+  class PersistentIterator : public Iterator<typename PersistentNode<K, V>::EntryType> {
+  private:
+    /// <summary>
+    /// Persistent node type.
+    /// </summary>
+    using NodeType = PersistentNode<K, V>;
+    /// <summary>
+    /// Persistent entry type.
+    /// </summary>
+    using EntryType = typename NodeType::EntryType;
+    /// <summary>
+    /// Root node.
+    /// </summary>
+    NodeType* root;
+    /// <summary>
+    /// Total number of entries.
+    /// </summary>
+    Size size;
+    /// <summary>
+    /// Current count.
+    /// </summary>
+    Size count;
+    /// <summary>
+    /// Current depth.
+    /// </summary>
+    Size depth;
+    /// <summary>
+    /// Stack of visited nodes.
+    /// </summary>
+    const NodeType* nodes[NodeType::Depth];
+    /// <summary>
+    /// Stack of positions in the visited nodes.
+    /// </summary>
+    CompactIndex positions[NodeType::Depth];
+  public:
+    /// <summary>
+    /// Initialized constructor.
+    /// </summary>
+    /// <param name="root">Root node.</param>
+    /// <param name="size">Total number of entries.</param>
+    PersistentIterator(NodeType* const root, const Size size) :
+      root(root), size(size), count(0), depth(0), nodes(), positions() {
+      if (this->root != nullptr) {
+        this->root->reference();
+        this->nodes[0] = this->root;
+        this->positions[0] = 0;
+        this->depth = 1;
+      }
+    }
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    ~PersistentIterator() {
+      NodeType::Release(this->root);
+    }
+  public:
+    /// <summary>
+    /// Check whether or not the iterator has the next entry.
+    /// </summary>
+    /// <returns>Returns true when the next entry exists, false otherwise.</returns>
+    bool hasNext() const override {
+      return this->count < this->size;
+    }
+    /// <summary>
+    /// Move to the next entry and get the current one.
+    /// </summary>
+    /// <returns>Returns the current entry.</returns>
+    /// <exception cref="SPL::Exceptions::InvalidOperation">Throws when there's no next entry.</exception>
+    const EntryType& next() override {
+      if (this->count >= this->size) {
+        throw Exceptions::InvalidOperation();
+      }
+      while (true) {
+        const auto* node = this->nodes[this->depth - 1];
+        auto& position = this->positions[this->depth - 1];
+        if (position < node->getLength()) {
+          this->count++;
+          return node->getEntries()[position++];
+        }
+        const Index child = position - node->getLength();
+        if (child < node->getCount()) {
+          position++;
+          this->nodes[this->depth] = node->getNodes()[child];
+          this->positions[this->depth++] = 0;
+          continue;
+        }
+        this->depth--;
+      }
+    }
+  };
+  /// <summary>
+  /// Non-virtual persistent slot iterator class for range-based loops and the standard algorithms.
+  /// It walks the node stack without allocating and doesn't hold a reference to the root node, so it's valid while
+  /// the map version it came from is alive.
+  /// </summary>
+  /// <typeparam name="K">Key type.</typeparam>
+  /// <typeparam name="V">Value type.</typeparam>
+  template<typename K, typename V>
+  class PersistentSlotIterator final {
+  private:
+    /// <summary>
+    /// Persistent node type.
+    /// </summary>
+    using NodeType = PersistentNode<K, V>;
+    /// <summary>
+    /// Persistent entry type.
+    /// </summary>
+    using EntryType = typename NodeType::EntryType;
+  public:
+    /// <summary>
+    /// Iterator category (for the standard algorithms).
+    /// </summary>
+    using iterator_category = std::forward_iterator_tag;
+    /// <summary>
+    /// Iterator value type.
+    /// </summary>
+    using value_type = EntryType;
+    /// <summary>
+    /// Iterator difference type.
+    /// </summary>
+    using difference_type = std::ptrdiff_t;
+    /// <summary>
+    /// Iterator pointer type.
+    /// </summary>
+    using pointer = const EntryType*;
+    /// <summary>
+    /// Iterator reference type.
+    /// </summary>
+    using reference = const EntryType&;
+  private:
+    /// <summary>
+    /// Current depth.
+    /// </summary>
+    Size depth;
+    /// <summary>
+    /// Stack of visited nodes.
+    /// </summary>
+    const NodeType* nodes[NodeType::Depth];
+    /// <summary>
+    /// Stack of positions in the visited nodes.
+    /// </summary>
+    CompactIndex positions[NodeType::Depth];
+    /// <summary>
+    /// Current entry.
+    /// </summary>
+    const EntryType* current;
+  private:
+    /// <summary>
+    /// Move to the next entry.
+    /// The entries of each node are visited before its child nodes.
+    /// </summary>
+    void advance() {
+      this->current = nullptr;
+      while (this->depth > 0) {
+        const auto* node = this->nodes[this->depth - 1];
+        auto& position = this->positions[this->depth - 1];
+        if (position < node->getLength()) {
+          this->current = &node->getEntries()[position++];
+          return;
+        }
+        const Index child = position - node->getLength();
+        if (child < node->getCount()) {
+          position++;
+          this->nodes[this->depth] = node->getNodes()[child];
+          this->positions[this->depth++] = 0;
+          continue;
+        }
+        this->depth--;
+      }
+    }
+  public:
+    /// <summary>
+    /// Default constructor (end iterator).
+    /// </summary>
+    PersistentSlotIterator() :
+      depth(0), nodes(), positions(), current(nullptr) {}
+    /// <summary>
+    /// Initialized constructor.
+    /// </summary>
+    /// <param name="root">Root node.</param>
+    explicit PersistentSlotIterator(const NodeType* const root) : PersistentSlotIterator() {
+      if (root != nullptr) {
+        this->nodes[0] = root;
+        this->positions[0] = 0;
+        this->depth = 1;
+        this->advance();
+      }
+    }
+  public:
+    /// <summary>
+    /// Get the current entry.
+    /// </summary>
+    /// <returns>Returns the current entry.</returns>
+    const EntryType& operator *() const {
+      return *this->current;
+    }
+    /// <summary>
+    /// Get the current entry.
+    /// </summary>
+    /// <returns>Returns a pointer to the current entry.</returns>
+    const EntryType* operator ->() const {
+      return this->current;
+    }
+    /// <summary>
+    /// Move to the next entry.
+    /// </summary>
+    /// <returns>Returns the iterator itself.</returns>
+    PersistentSlotIterator& operator ++() {
+      this->advance();
+      return *this;
+    }
+    /// <summary>
+    /// Move to the next entry.
+    /// </summary>
+    /// <returns>Returns a copy of the iterator before moving.</returns>
+    PersistentSlotIterator operator ++(int) {
+      auto previous = *this;
+      this->advance();
+      return previous;
+    }
+    /// <summary>
+    /// Check whether or not both iterators are at the same entry.
+    /// </summary>
+    /// <param name="other">Other iterator.</param>
+    /// <returns>Returns true when both are at the same entry, false otherwise.</returns>
+    bool operator == (const PersistentSlotIterator& other) const {
+      return this->current == other.current;
+    }
+    /// <summary>
+    /// Check whether or not the iterators are at different entries.
+    /// </summary>
+    /// <param name="other">Other iterator.</param>
+    /// <returns>Returns true when they're at different entries, false otherwise.</returns>
+    bool operator != (const PersistentSlotIterator& other) const {
+      return this->current != other.current;
+    }
+  };
+}
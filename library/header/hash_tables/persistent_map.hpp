@@ -0,0 +1,279 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#include "./types.hpp"
+#include "./persistent_node.hpp"
+#include "./persistent_iterator.hpp"
+
+namespace SPL::HashTables {
+  /// <summary>
+  /// Persistent map class.
+  /// It's a hash array mapped trie with structural sharing, copying the map is O(1) and every update creates
+  /// new nodes only for the changed path, so all the previous copies (snapshots) remain valid and unchanged.
+  /// Nodes are reference counted with atomic operations, a snapshot can be used by another thread while
+  /// the original map is still changing (each map instance must be used by a single thread at time).
+  /// </summary>
+  /// <typeparam name="K">Key type.</typeparam>
+  /// <typeparam name="V">Value type.</typeparam>
+  /// <typeparam name="H">Hash function.</typeparam>
+  template<typename K, typename V, Id(H)(const K&)>
+  class PersistentMap final : public Iterable<typename PersistentNode<K, V>::EntryType> {
+  private:
+    /// <summary>
+    /// Persistent node type.
+    /// </summary>
+    using NodeType = PersistentNode<K, V>;
+    /// <summary>
+    /// Persistent entry type.
+    /// </summary>
+    using EntryType = typename NodeType::EntryType;
+    /// <summary>
+    /// Non-constant value type.
+    /// </summary>
+    using ValueType = Metadata::ConstantType<V>;
+    /// <summary>
+    /// Root node.
+    /// </summary>
+    NodeType* root;
+    /// <summary>
+    /// Current number of entries.
+    /// </summary>
+    Size size;
+  private:
+    /// <summary>
+    /// Exchange all properties from the given objects.
+    /// </summary>
+    /// <param name="source">Source object.</param>
+    /// <param name="target">Target object.</param>
+    friend void Swap(PersistentMap& source, PersistentMap& target) noexcept {
+      using SPL::Swap;
+      Swap(source.root, target.root);
+      Swap(source.size, target.size);
+    }
+    /// <summary>
+    /// Get the entry that corresponds to the specified key.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <returns>Returns a pointer to the corresponding entry or null when the key doesn't exists.</returns>
+    const EntryType* find(const K& key) const {
+      if (this->root != nullptr) {
+        return this->root->get(H(key), key);
+      }
+      return nullptr;
+    }
+    /// <summary>
+    /// Remove the specified key from the current version.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <param name="value">Output value.</param>
+    /// <returns>Returns true when the key was removed, false otherwise.</returns>
+    bool release(const K& key, ValueType& value) {
+      if (this->root != nullptr) {
+        bool removed;
+        auto* node = this->root->unset(H(key), key, value, 0, removed);
+        if (removed) {
+          NodeType::Release(this->root);
+          this->root = node;
+          this->size--;
+          return true;
+        }
+      }
+      return false;
+    }
+  public:
+    /// <summary>
+    /// Initialized constructor.
+    /// </summary>
+    /// <param name="values">Initial values.</param>
+    template<Size N>
+    PersistentMap(const Pair<K, V>(&pairs)[N]) : PersistentMap() {
+      for (const auto& pair : pairs) {
+        this->set(pair.key, pair.value);
+      }
+    }
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    PersistentMap() :
+      root(nullptr), size(0) {}
+    /// <summary>
+    /// Copy constructor.
+    /// It's O(1), both maps share all the nodes until one of them is changed.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    PersistentMap(const PersistentMap& other) :
+      root(other.root), size(other.size) {
+      if (this->root != nullptr) {
+        this->root->reference();
+      }
+    }
+    /// <summary>
+    /// Move constructor.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    PersistentMap(PersistentMap&& other) noexcept : PersistentMap() {
+      Swap(*this, other);
+    }
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    ~PersistentMap() {
+      NodeType::Release(this->root);
+    }
+  public:
+    /// <summary>
+    /// Get the number of entries in the persistent map.
+    /// </summary>
+    /// <returns>Returns the map size.</returns>
+    Size getSize() const {
+      return this->size;
+    }
+    /// <summary>
+    /// Determines whether or not the persistent map is empty.
+    /// </summary>
+    /// <returns>Returns true when the it's empty, false otherwise.</returns>
+    bool isEmpty() const {
+      return this->size == 0;
+    }
+    /// <summary>
+    /// Get a new entry iterator for the current version.
+    /// </summary>
+    /// <returns>Returns the new iterator.</returns>
+    UniqueIterator<EntryType> getIterator() const override {
+      auto* iterator = new PersistentIterator<K, V>(this->root, this->size);
+      return UniqueIterator<EntryType>(iterator);
+    }
+    /// <summary>
+    /// Get an iterator at the first entry of the current version for range-based loops.
+    /// The iterator is valid while the current version is alive.
+    /// </summary>
+    /// <returns>Returns the persistent slot iterator.</returns>
+    PersistentSlotIterator<K, V> begin() const {
+      return PersistentSlotIterator<K, V>(this->root);
+    }
+    /// <summary>
+    /// Get an iterator past the last entry for range-based loops.
+    /// </summary>
+    /// <returns>Returns the persistent slot iterator.</returns>
+    PersistentSlotIterator<K, V> end() const {
+      return PersistentSlotIterator<K, V>();
+    }
+    /// <summary>
+    /// Set the specified key to map the given value by using move semantics.
+    /// Only the nodes in the key path are copied, all the other ones are shared with the previous version.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <param name="value">Entry value.</param>
+    /// <returns>Returns the previous value for the given key.</returns>
+    V set(const K& key, ValueType&& value) {
+      NodeType empty;
+      const auto* current = this->root != nullptr ? this->root : &empty;
+      bool added;
+      auto* node = current->template set<H>(H(key), key, value, 0, added);
+      NodeType::Release(this->root);
+      this->root = node;
+      if (added) {
+        this->size++;
+      }
+      V previous(Move(value));
+      return previous;
+    }
+    /// <summary>
+    /// Set the specified key using the given value.
+    /// Only the nodes in the key path are copied, all the other ones are shared with the previous version.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <param name="value">Entry value.</param>
+    /// <returns>Returns the previous value for the given key.</returns>
+    V set(const K& key, const ValueType& value) {
+      ValueType copy(value);
+      return this->set(key, Move(copy));
+    }
+    /// <summary>
+    /// Get the value that corresponds to the specified key.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <returns>Returns the corresponding entry value.</returns>
+    /// <exception cref="SPL::Exceptions::KeyNotFound">Throws when the specified key doesn't exists.</exception>
+    const V& get(const K& key) const {
+      const auto* entry = this->find(key);
+      if (entry == nullptr) {
+        throw Exceptions::KeyNotFound<K>(key);
+      }
+      return entry->value;
+    }
+    /// <summary>
+    /// Get a copy of the value that corresponds to the specified key.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <param name="value">Output value.</param>
+    /// <returns>Returns true when the value was found, false otherwise.</returns>
+    bool get(const K& key, ValueType& value) const {
+      const auto* entry = this->find(key);
+      if (entry != nullptr) {
+        value = entry->value;
+        return true;
+      }
+      return false;
+    }
+    /// <summary>
+    /// Determines whether or not the persistent map contains the specified key.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <returns>Returns true when the key was found, false otherwise.</returns>
+    bool has(const K& key) const {
+      return this->find(key) != nullptr;
+    }
+    /// <summary>
+    /// Remove the specified key from the persistent map.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <returns>Returns the removed value.</returns>
+    /// <exception cref="SPL::Exceptions::KeyNotFound">Throws when the specified key doesn't exists.</exception>
+    V remove(const K& key) {
+      ValueType previous;
+      if (!this->release(key, previous)) {
+        throw Exceptions::KeyNotFound<K>(key);
+      }
+      return previous;
+    }
+    /// <summary>
+    /// Remove the specified key from the persistent map.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <param name="value">Output value.</param>
+    /// <returns>Returns true when the value was removed, false otherwise.</returns>
+    bool remove(const K& key, ValueType& value) {
+      return this->release(key, value);
+    }
+    /// <summary>
+    /// Clear the persistent map.
+    /// The previous versions remain unchanged.
+    /// </summary>
+    void clear() {
+      NodeType::Release(this->root);
+      this->root = nullptr;
+      this->size = 0;
+    }
+  public:
+    /// <summary>
+    /// Alias for the get method.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <returns>Returns the corresponding entry value.</returns>
+    const V& operator [](const K& key) const {
+      return this->get(key);
+    }
+    /// <summary>
+    /// Assign all properties from the given persistent map.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    /// <returns>Returns the instance itself.</returns>
+    PersistentMap& operator = (PersistentMap other) noexcept {
+      Swap(*this, other);
+      return *this;
+    }
+  };
+}
@@ -0,0 +1,372 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#include "./types.hpp"
+
+namespace SPL::HashTables {
+  /// <summary>
+  /// Persistent node class.
+  /// Each node consumes 5 bits of the hash and keeps two bitmaps, one for the inline entries and another one for
+  /// the child nodes, both arrays are compact and indexed by the number of set bits before the hash fragment.
+  /// When all the hash bits are consumed the node becomes a collision node with a plain list of entries.
+  /// Nodes are never changed after they are shared, every update creates new nodes for the changed path only.
+  /// </summary>
+  /// <typeparam name="K">Key type.</typeparam>
+  /// <typeparam name="V">Value type.</typeparam>
+  template<typename K, typename V>
+  class PersistentNode final {
+  public:
+    /// <summary>
+    /// Persistent entry type.
+    /// </summary>
+    using EntryType = Pair<Metadata::ConstantType<K>, V>;
+    /// <summary>
+    /// Number of hash bits consumed per level.
+    /// </summary>
+    constexpr static Size Bits = 5;
+    /// <summary>
+    /// Total number of hash bits.
+    /// </summary>
+    constexpr static Size Limit = sizeof(Id) * 8;
+    /// <summary>
+    /// Maximum depth of the trie (including the collision level).
+    /// </summary>
+    constexpr static Size Depth = ((Limit + Bits - 1) / Bits) + 1;
+  private:
+    /// <summary>
+    /// Non-constant value type.
+    /// </summary>
+    using ValueType = Metadata::ConstantType<V>;
+    /// <summary>
+    /// Number of references.
+    /// </summary>
+    volatile Size references;
+    /// <summary>
+    /// Bitmap of inline entries.
+    /// </summary>
+    unsigned int datamap;
+    /// <summary>
+    /// Bitmap of child nodes.
+    /// </summary>
+    unsigned int nodemap;
+    /// <summary>
+    /// Number of entries.
+    /// </summary>
+    Size length;
+    /// <summary>
+    /// Array of entries.
+    /// </summary>
+    EntryType* entries;
+    /// <summary>
+    /// Array of child nodes.
+    /// </summary>
+    PersistentNode** nodes;
+  private:
+    /// <summary>
+    /// Get the bit that corresponds to the specified hash in the given level.
+    /// </summary>
+    /// <param name="hash">Entry hash.</param>
+    /// <param name="shift">Level shift.</param>
+    /// <returns>Returns the corresponding bit.</returns>
+    static unsigned int Fragment(const Id hash, const Size shift) {
+      return 1U << static_cast<unsigned int>((hash >> shift) & ((1U << Bits) - 1));
+    }
+    /// <summary>
+    /// Get the position in a compact array that corresponds to the given bitmap and bit.
+    /// </summary>
+    /// <param name="bitmap">Bitmap.</param>
+    /// <param name="bit">Fragment bit.</param>
+    /// <returns>Returns the compact position.</returns>
+    static Index Position(const unsigned int bitmap, const unsigned int bit) {
+      return Math::PopCount(bitmap & (bit - 1));
+    }
+    /// <summary>
+    /// Create a new node that contains only the two given entries.
+    /// </summary>
+    /// <param name="first">First entry.</param>
+    /// <param name="firstHash">First entry hash.</param>
+    /// <param name="key">Second entry key.</param>
+    /// <param name="value">Second entry value (it will be moved).</param>
+    /// <param name="hash">Second entry hash.</param>
+    /// <param name="shift">Level shift.</param>
+    /// <returns>Returns the new node.</returns>
+    static PersistentNode* Merge(const EntryType& first, const Id firstHash, const K& key, ValueType& value, const Id hash, const Size shift) {
+      using SPL::Swap;
+      if (shift >= Limit) {
+        auto* node = new PersistentNode(0, 0, 2, 0);
+        node->entries[0] = first;
+        node->entries[1].key = key;
+        Swap(node->entries[1].value, value);
+        return node;
+      }
+      const auto firstBit = Fragment(firstHash, shift);
+      const auto bit = Fragment(hash, shift);
+      if (firstBit == bit) {
+        auto* node = new PersistentNode(0, bit, 0, 1);
+        node->nodes[0] = Merge(first, firstHash, key, value, hash, shift + Bits);
+        return node;
+      }
+      auto* node = new PersistentNode(firstBit | bit, 0, 2, 0);
+      const Index position = firstBit < bit ? 0 : 1;
+      node->entries[position] = first;
+      node->entries[1 - position].key = key;
+      Swap(node->entries[1 - position].value, value);
+      return node;
+    }
+    /// <summary>
+    /// Create a copy of the current node with a different layout.
+    /// All the shared child nodes are referenced again.
+    /// </summary>
+    /// <param name="datamap">New bitmap of entries.</param>
+    /// <param name="nodemap">New bitmap of child nodes.</param>
+    /// <param name="skipEntry">Entry position to skip or -1.</param>
+    /// <param name="gapEntry">Entry position to keep empty or -1.</param>
+    /// <param name="skipNode">Node position to skip or -1.</param>
+    /// <param name="gapNode">Node position to keep empty or -1.</param>
+    /// <returns>Returns the new node.</returns>
+    PersistentNode* copy(const unsigned int datamap, const unsigned int nodemap,
+      const Index skipEntry, const Index gapEntry, const Index skipNode, const Index gapNode) const {
+      const Size count = Math::PopCount(this->nodemap);
+      const Size length = this->length - (skipEntry != -1 ? 1 : 0) + (gapEntry != -1 ? 1 : 0);
+      const Size total = count - (skipNode != -1 ? 1 : 0) + (gapNode != -1 ? 1 : 0);
+      auto* node = new PersistentNode(datamap, nodemap, length, total);
+      for (Index source = 0, target = 0; source < this->length; ++source) {
+        if (source != skipEntry) {
+          if (target == gapEntry) {
+            target++;
+          }
+          node->entries[target++] = this->entries[source];
+        }
+      }
+      for (Index source = 0, target = 0; source < count; ++source) {
+        if (source != skipNode) {
+          if (target == gapNode) {
+            target++;
+          }
+          auto* child = this->nodes[source];
+          child->reference();
+          node->nodes[target++] = child;
+        }
+      }
+      return node;
+    }
+  public:
+    /// <summary>
+    /// Initialized constructor.
+    /// </summary>
+    /// <param name="datamap">Bitmap of entries.</param>
+    /// <param name="nodemap">Bitmap of child nodes.</param>
+    /// <param name="length">Number of entries.</param>
+    /// <param name="count">Number of child nodes.</param>
+    PersistentNode(const unsigned int datamap, const unsigned int nodemap, const Size length, const Size count) :
+      references(1), datamap(datamap), nodemap(nodemap), length(length),
+      entries(length > 0 ? new EntryType[length]() : nullptr), nodes(count > 0 ? new PersistentNode*[count]() : nullptr) {}
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    PersistentNode() :
+      PersistentNode(0, 0, 0, 0) {}
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    ~PersistentNode() {
+      const Size count = Math::PopCount(this->nodemap);
+      for (Size offset = 0; offset < count; ++offset) {
+        Release(this->nodes[offset]);
+      }
+      delete[] this->nodes;
+      delete[] this->entries;
+    }
+  public:
+    /// <summary>
+    /// Release one reference of the given node and delete it when there are no more references.
+    /// </summary>
+    /// <param name="node">Node pointer.</param>
+    static void Release(PersistentNode* const node) {
+      if (node != nullptr && AtomicDecrement(node->references) == 0) {
+        delete node;
+      }
+    }
+    /// <summary>
+    /// Add one reference to the node.
+    /// </summary>
+    void reference() {
+      AtomicIncrement(this->references);
+    }
+    /// <summary>
+    /// Get the number of entries in the node.
+    /// </summary>
+    /// <returns>Returns the number of entries.</returns>
+    Size getLength() const {
+      return this->length;
+    }
+    /// <summary>
+    /// Get the number of child nodes.
+    /// </summary>
+    /// <returns>Returns the number of child nodes.</returns>
+    Size getCount() const {
+      return Math::PopCount(this->nodemap);
+    }
+    /// <summary>
+    /// Get the array of entries.
+    /// </summary>
+    /// <returns>Returns the array of entries.</returns>
+    const EntryType* getEntries() const {
+      return this->entries;
+    }
+    /// <summary>
+    /// Get the array of child nodes.
+    /// </summary>
+    /// <returns>Returns the array of child nodes.</returns>
+    const PersistentNode* const* getNodes() const {
+      return this->nodes;
+    }
+    /// <summary>
+    /// Get the entry that corresponds to the specified hash and key.
+    /// </summary>
+    /// <param name="hash">Entry hash.</param>
+    /// <param name="key">Entry key.</param>
+    /// <returns>Returns a pointer to the corresponding entry or null when the key doesn't exists.</returns>
+    const EntryType* get(const Id hash, const K& key) const {
+      const auto* node = this;
+      for (Size shift = 0; shift < Limit; shift += Bits) {
+        const auto bit = Fragment(hash, shift);
+        if ((node->datamap & bit) != 0) {
+          const auto& entry = node->entries[Position(node->datamap, bit)];
+          return Compare(entry.key, key) == 0 ? &entry : nullptr;
+        }
+        if ((node->nodemap & bit) == 0) {
+          return nullptr;
+        }
+        node = node->nodes[Position(node->nodemap, bit)];
+      }
+      for (Size offset = 0; offset < node->length; ++offset) {
+        if (Compare(node->entries[offset].key, key) == 0) {
+          return &node->entries[offset];
+        }
+      }
+      return nullptr;
+    }
+    /// <summary>
+    /// Create a new version of the node that maps the specified key to the given value.
+    /// The given value is exchanged with the previous one (or with a default value for new entries).
+    /// </summary>
+    /// <typeparam name="H">Hash function.</typeparam>
+    /// <param name="hash">Entry hash.</param>
+    /// <param name="key">Entry key.</param>
+    /// <param name="value">Entry value.</param>
+    /// <param name="shift">Level shift.</param>
+    /// <param name="added">Output flag that determines whether or not a new entry was added.</param>
+    /// <returns>Returns the new node.</returns>
+    template<auto H>
+    PersistentNode* set(const Id hash, const K& key, ValueType& value, const Size shift, bool& added) const {
+      using SPL::Swap;
+      if (shift >= Limit) {
+        for (Index offset = 0; offset < this->length; ++offset) {
+          if (Compare(this->entries[offset].key, key) == 0) {
+            auto* node = this->copy(0, 0, -1, -1, -1, -1);
+            Swap(node->entries[offset].value, value);
+            added = false;
+            return node;
+          }
+        }
+        auto* node = this->copy(0, 0, -1, this->length, -1, -1);
+        node->entries[this->length].key = key;
+        Swap(node->entries[this->length].value, value);
+        added = true;
+        return node;
+      }
+      const auto bit = Fragment(hash, shift);
+      if ((this->datamap & bit) != 0) {
+        const auto position = Position(this->datamap, bit);
+        const auto& entry = this->entries[position];
+        if (Compare(entry.key, key) == 0) {
+          auto* node = this->copy(this->datamap, this->nodemap, -1, -1, -1, -1);
+          Swap(node->entries[position].value, value);
+          added = false;
+          return node;
+        }
+        const auto target = Position(this->nodemap, bit);
+        auto* node = this->copy(this->datamap & ~bit, this->nodemap | bit, position, -1, -1, target);
+        node->nodes[target] = Merge(entry, H(entry.key), key, value, hash, shift + Bits);
+        added = true;
+        return node;
+      }
+      if ((this->nodemap & bit) != 0) {
+        const auto position = Position(this->nodemap, bit);
+        auto* child = this->nodes[position]->template set<H>(hash, key, value, shift + Bits, added);
+        auto* node = this->copy(this->datamap, this->nodemap, -1, -1, position, position);
+        node->nodes[position] = child;
+        return node;
+      }
+      const auto position = Position(this->datamap, bit);
+      auto* node = this->copy(this->datamap | bit, this->nodemap, -1, position, -1, -1);
+      node->entries[position].key = key;
+      Swap(node->entries[position].value, value);
+      added = true;
+      return node;
+    }
+    /// <summary>
+    /// Create a new version of the node without the specified key.
+    /// Child nodes left with a single entry are inlined, so the trie stays compact.
+    /// </summary>
+    /// <param name="hash">Entry hash.</param>
+    /// <param name="key">Entry key.</param>
+    /// <param name="value">Output value.</param>
+    /// <param name="shift">Level shift.</param>
+    /// <param name="removed">Output flag that determines whether or not the entry was removed.</param>
+    /// <returns>Returns the new node or null when the new node would be empty (or nothing was removed).</returns>
+    PersistentNode* unset(const Id hash, const K& key, ValueType& value, const Size shift, bool& removed) const {
+      removed = false;
+      if (shift >= Limit) {
+        for (Index offset = 0; offset < this->length; ++offset) {
+          if (Compare(this->entries[offset].key, key) == 0) {
+            value = this->entries[offset].value;
+            removed = true;
+            return this->length > 1 ? this->copy(0, 0, offset, -1, -1, -1) : nullptr;
+          }
+        }
+        return nullptr;
+      }
+      const auto bit = Fragment(hash, shift);
+      if ((this->datamap & bit) != 0) {
+        const auto position = Position(this->datamap, bit);
+        if (Compare(this->entries[position].key, key) != 0) {
+          return nullptr;
+        }
+        value = this->entries[position].value;
+        removed = true;
+        if (this->length == 1 && this->nodemap == 0) {
+          return nullptr;
+        }
+        return this->copy(this->datamap & ~bit, this->nodemap, position, -1, -1, -1);
+      }
+      if ((this->nodemap & bit) != 0) {
+        const auto position = Position(this->nodemap, bit);
+        auto* child = this->nodes[position]->unset(hash, key, value, shift + Bits, removed);
+        if (!removed) {
+          return nullptr;
+        }
+        if (child == nullptr) {
+          if (this->length == 0 && this->nodemap == bit) {
+            return nullptr;
+          }
+          return this->copy(this->datamap, this->nodemap & ~bit, -1, -1, position, -1);
+        }
+        if (child->length == 1 && child->nodemap == 0) {
+          const auto target = Position(this->datamap, bit);
+          auto* node = this->copy(this->datamap | bit, this->nodemap & ~bit, -1, target, position, -1);
+          node->entries[target] = child->entries[0];
+          Release(child);
+          return node;
+        }
+        auto* node = this->copy(this->datamap, this->nodemap, -1, -1, position, position);
+        node->nodes[position] = child;
+        return node;
+      }
+      return nullptr;
+    }
+  };
+}
@@ -0,0 +1,133 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#include <iterator>
+
+#include "./types.hpp"
+
+namespace SPL::HashTables {
+  /// <summary>
+  /// Determines whether or not the given hash entry is occupied.
+  /// </summary>
+  /// <typeparam name="E">Entry type.</typeparam>
+  /// <param name="entry">Hash entry.</param>
+  /// <returns>Returns true when the entry is occupied, false otherwise.</returns>
+  template<typename E>
+  bool IsOccupied(const E& entry) {
+    return entry.getState() == EntryState::Occupied;
+  }
+  /// <summary>
+  /// Non-virtual slot iterator class for range-based loops.
+  /// It walks the slots of a table and skips all the slots rejected by the given filter.
+  /// </summary>
+  /// <typeparam name="E">Entry type.</typeparam>
+  /// <typeparam name="F">Filter function for the used slots.</typeparam>
+  template<typename E, auto F>
+  class SlotIterator final {
+  public:
+    /// <summary>
+    /// Iterator category (for the standard algorithms).
+    /// </summary>
+    using iterator_category = std::forward_iterator_tag;
+    /// <summary>
+    /// Iterator value type.
+    /// </summary>
+    using value_type = E;
+    /// <summary>
+    /// Iterator difference type.
+    /// </summary>
+    using difference_type = std::ptrdiff_t;
+    /// <summary>
+    /// Iterator pointer type.
+    /// </summary>
+    using pointer = const E*;
+    /// <summary>
+    /// Iterator reference type.
+    /// </summary>
+    using reference = const E&;
+  private:
+    /// <summary>
+    /// Current slot.
+    /// </summary>
+    const E* current;
+    /// <summary>
+    /// Slot past the last one.
+    /// </summary>
+    const E* last;
+  private:
+    /// <summary>
+    /// Move the current slot to the next used one.
+    /// </summary>
+    void skip() {
+      while (this->current != this->last && !F(*this->current)) {
+        this->current++;
+      }
+    }
+  public:
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    SlotIterator() :
+      current(nullptr), last(nullptr) {}
+    /// <summary>
+    /// Initialized constructor.
+    /// </summary>
+    /// <param name="first">First slot.</param>
+    /// <param name="last">Slot past the last one.</param>
+    SlotIterator(const E* const first, const E* const last) :
+      current(first), last(last) {
+      this->skip();
+    }
+  public:
+    /// <summary>
+    /// Get the current entry.
+    /// </summary>
+    /// <returns>Returns the current entry.</returns>
+    const E& operator *() const {
+      return *this->current;
+    }
+    /// <summary>
+    /// Get the current entry.
+    /// </summary>
+    /// <returns>Returns a pointer to the current entry.</returns>
+    const E* operator ->() const {
+      return this->current;
+    }
+    /// <summary>
+    /// Move to the next used slot.
+    /// </summary>
+    /// <returns>Returns the iterator itself.</returns>
+    SlotIterator& operator ++() {
+      this->current++;
+      this->skip();
+      return *this;
+    }
+    /// <summary>
+    /// Move to the next used slot.
+    /// </summary>
+    /// <returns>Returns a copy of the iterator before moving.</returns>
+    SlotIterator operator ++(int) {
+      auto previous = *this;
+      ++*this;
+      return previous;
+    }
+    /// <summary>
+    /// Check whether or not both iterators are at the same slot.
+    /// </summary>
+    /// <param name="other">Other iterator.</param>
+    /// <returns>Returns true when both are at the same slot, false otherwise.</returns>
+    bool operator == (const SlotIterator& other) const {
+      return this->current == other.current;
+    }
+    /// <summary>
+    /// Check whether or not the iterators are at different slots.
+    /// </summary>
+    /// <param name="other">Other iterator.</param>
+    /// <returns>Returns true when they're at different slots, false otherwise.</returns>
+    bool operator != (const SlotIterator& other) const {
+      return this->current != other.current;
+    }
+  };
+}
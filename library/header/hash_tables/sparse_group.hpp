@@ -0,0 +1,222 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#include "./types.hpp"
+
+namespace SPL::HashTables {
+  /// <summary>
+  /// Sparse group class.
+  /// It represents a fixed number of table slots by using two bitmaps and a packed array that only contains
+  /// the occupied entries, the position of each entry in the array is the number of occupied slots before it.
+  /// </summary>
+  /// <typeparam name="K">Key type.</typeparam>
+  /// <typeparam name="V">Value type.</typeparam>
+  template<typename K, typename V>
+  class SparseGroup final {
+  public:
+    /// <summary>
+    /// Number of slots in the group.
+    /// </summary>
+    constexpr static Size Length = 64;
+    /// <summary>
+    /// Sparse entry type.
+    /// </summary>
+    using EntryType = Pair<Metadata::ConstantType<K>, V>;
+  private:
+    /// <summary>
+    /// Slot bitmap type.
+    /// </summary>
+    using BitmapType = unsigned long long int;
+    /// <summary>
+    /// Bitmap of occupied slots.
+    /// </summary>
+    BitmapType occupied;
+    /// <summary>
+    /// Bitmap of deleted slots.
+    /// </summary>
+    BitmapType deleted;
+    /// <summary>
+    /// Packed array of entries.
+    /// </summary>
+    EntryType* entries;
+  private:
+    /// <summary>
+    /// Exchange all properties from the given objects.
+    /// </summary>
+    /// <param name="source">Source object.</param>
+    /// <param name="target">Target object.</param>
+    friend void Swap(SparseGroup& source, SparseGroup& target) noexcept {
+      using SPL::Swap;
+      Swap(source.occupied, target.occupied);
+      Swap(source.deleted, target.deleted);
+      Swap(source.entries, target.entries);
+    }
+    /// <summary>
+    /// Get the bit mask that corresponds to the specified slot.
+    /// </summary>
+    /// <param name="slot">Slot index.</param>
+    /// <returns>Returns the slot mask.</returns>
+    constexpr static BitmapType Mask(const Index slot) {
+      return static_cast<BitmapType>(1) << slot;
+    }
+    /// <summary>
+    /// Get the position in the packed array that corresponds to the specified slot.
+    /// </summary>
+    /// <param name="slot">Slot index.</param>
+    /// <returns>Returns the packed position.</returns>
+    Index position(const Index slot) const {
+      return Math::PopCount(this->occupied & (Mask(slot) - 1));
+    }
+  public:
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    SparseGroup() :
+      occupied(0), deleted(0), entries(nullptr) {}
+    /// <summary>
+    /// Copy constructor.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    SparseGroup(const SparseGroup& other) :
+      occupied(other.occupied), deleted(other.deleted), entries(nullptr) {
+      const auto size = other.getSize();
+      if (size > 0) {
+        this->entries = new EntryType[size]();
+        for (Size offset = 0; offset < size; ++offset) {
+          this->entries[offset] = other.entries[offset];
+        }
+      }
+    }
+    /// <summary>
+    /// Move constructor.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    SparseGroup(SparseGroup&& other) noexcept : SparseGroup() {
+      Swap(*this, other);
+    }
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    ~SparseGroup() {
+      delete[] this->entries;
+    }
+  public:
+    /// <summary>
+    /// Get the number of occupied slots in the group.
+    /// </summary>
+    /// <returns>Returns the group size.</returns>
+    Size getSize() const {
+      return Math::PopCount(this->occupied);
+    }
+    /// <summary>
+    /// Determines whether or not the specified slot is occupied.
+    /// </summary>
+    /// <param name="slot">Slot index.</param>
+    /// <returns>Returns true when it's occupied, false otherwise.</returns>
+    bool isOccupied(const Index slot) const {
+      return (this->occupied & Mask(slot)) != 0;
+    }
+    /// <summary>
+    /// Determines whether or not the specified slot is deleted.
+    /// </summary>
+    /// <param name="slot">Slot index.</param>
+    /// <returns>Returns true when it's deleted, false otherwise.</returns>
+    bool isDeleted(const Index slot) const {
+      return (this->deleted & Mask(slot)) != 0;
+    }
+    /// <summary>
+    /// Get the entry that corresponds to the specified slot.
+    /// </summary>
+    /// <param name="slot">Slot index.</param>
+    /// <returns>Returns a pointer to the corresponding entry or null when the slot isn't occupied.</returns>
+    EntryType* get(const Index slot) const {
+      if (this->isOccupied(slot)) {
+        return &this->entries[this->position(slot)];
+      }
+      return nullptr;
+    }
+    /// <summary>
+    /// Occupy the specified slot with a new default entry.
+    /// The packed array grows by one entry and the existing entries are moved.
+    /// </summary>
+    /// <param name="slot">Slot index.</param>
+    /// <returns>Returns a pointer to the corresponding entry.</returns>
+    EntryType* set(const Index slot) {
+      if (this->isOccupied(slot)) {
+        return &this->entries[this->position(slot)];
+      }
+      using SPL::Swap;
+      const auto size = this->getSize();
+      const auto position = this->position(slot);
+      auto* entries = new EntryType[size + 1]();
+      for (Size offset = 0; offset < position; ++offset) {
+        Swap(entries[offset], this->entries[offset]);
+      }
+      for (Size offset = position; offset < size; ++offset) {
+        Swap(entries[offset + 1], this->entries[offset]);
+      }
+      delete[] this->entries;
+      this->entries = entries;
+      this->occupied |= Mask(slot);
+      this->deleted &= ~Mask(slot);
+      return &this->entries[position];
+    }
+    /// <summary>
+    /// Release the specified slot and mark it as deleted.
+    /// The packed array shrinks by one entry and the existing entries are moved.
+    /// </summary>
+    /// <param name="slot">Slot index.</param>
+    /// <returns>Returns true when the slot was released, false otherwise.</returns>
+    bool unset(const Index slot) {
+      if (!this->isOccupied(slot)) {
+        return false;
+      }
+      using SPL::Swap;
+      const auto size = this->getSize() - 1;
+      const auto position = this->position(slot);
+      EntryType* entries = nullptr;
+      if (size > 0) {
+        entries = new EntryType[size]();
+        for (Size offset = 0; offset < position; ++offset) {
+          Swap(entries[offset], this->entries[offset]);
+        }
+        for (Size offset = position; offset < size; ++offset) {
+          Swap(entries[offset], this->entries[offset + 1]);
+        }
+      }
+      delete[] this->entries;
+      this->entries = entries;
+      this->occupied &= ~Mask(slot);
+      this->deleted |= Mask(slot);
+      return true;
+    }
+    /// <summary>
+    /// Release all the slots and clear all the deleted marks.
+    /// </summary>
+    void clear() {
+      delete[] this->entries;
+      this->entries = nullptr;
+      this->occupied = 0;
+      this->deleted = 0;
+    }
+  public:
+    /// <summary>
+    /// Assign all properties from the given group.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    /// <returns>Returns the instance itself.</returns>
+    SparseGroup& operator = (SparseGroup other) noexcept {
+      Swap(*this, other);
+      return *this;
+    }
+    /// <summary>
+    /// Get the packed array of entries.
+    /// </summary>
+    /// <returns>Returns the packed array of entries.</returns>
+    operator const EntryType* () const {
+      return this->entries;
+    }
+  };
+}
@@ -0,0 +1,431 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#include "./types.hpp"
+#include "./sparse_group.hpp"
+#include "./sparse_iterator.hpp"
+
+namespace SPL::HashTables {
+  /// <summary>
+  /// Sparse hash map class.
+  /// The slots are split in groups of 64 and each group stores only its occupied entries (see SparseGroup),
+  /// so a free slot costs about 3 bits instead of a whole entry. It's intended for huge tables where memory
+  /// matters more than the insertion and removal speed (both reallocate the packed array of a group).
+  /// </summary>
+  /// <typeparam name="K">Key type.</typeparam>
+  /// <typeparam name="V">Value type.</typeparam>
+  /// <typeparam name="H">Hash function.</typeparam>
+  template<typename K, typename V, Id(H)(const K&)>
+  class SparseHashMap final : public Map<K, V>, public Iterable<typename SparseGroup<K, V>::EntryType> {
+  private:
+    /// <summary>
+    /// Sparse group type.
+    /// </summary>
+    using GroupType = SparseGroup<K, V>;
+    /// <summary>
+    /// Sparse entry type.
+    /// </summary>
+    using EntryType = typename GroupType::EntryType;
+    /// <summary>
+    /// Non-constant value type.
+    /// </summary>
+    using ValueType = Metadata::ConstantType<V>;
+    /// <summary>
+    /// Total number of slots.
+    /// </summary>
+    Size capacity;
+    /// <summary>
+    /// Array of groups.
+    /// </summary>
+    GroupType* groups;
+    /// <summary>
+    /// Current number of entries.
+    /// </summary>
+    Size size;
+    /// <summary>
+    /// Current number of deleted slots.
+    /// </summary>
+    Size deleted;
+  private:
+    /// <summary>
+    /// Exchange all properties from the given objects.
+    /// </summary>
+    /// <param name="source">Source object.</param>
+    /// <param name="target">Target object.</param>
+    friend void Swap(SparseHashMap& source, SparseHashMap& target) noexcept {
+      using SPL::Swap;
+      Swap(source.capacity, target.capacity);
+      Swap(source.groups, target.groups);
+      Swap(source.size, target.size);
+      Swap(source.deleted, target.deleted);
+    }
+    /// <summary>
+    /// Load the slot index that corresponds to the specified hash and/or key.
+    /// The slots are visited using triangular numbers, so all of them are reachable in a power of two capacity.
+    /// </summary>
+    /// <param name="hash">Entry hash.</param>
+    /// <param name="key">Entry key.</param>
+    /// <returns>Returns the index of the corresponding slot.</returns>
+    Index load(const Id hash, const K& key) const {
+      const Size mask = this->capacity - 1;
+      Index preferred = -1;
+      Index index = static_cast<Index>(hash) & mask;
+      for (Size offset = 1; offset <= this->capacity; ++offset) {
+        const auto& group = this->groups[index / GroupType::Length];
+        const Index slot = index % GroupType::Length;
+        auto* entry = group.get(slot);
+        if (entry != nullptr) {
+          if (Compare(entry->key, key) == 0) {
+            return index;
+          }
+        }
+        else {
+          if (preferred == -1) {
+            preferred = index;
+          }
+          if (!group.isDeleted(slot)) {
+            break;
+          }
+        }
+        index = (index + offset) & mask;
+      }
+      return preferred;
+    }
+    /// <summary>
+    /// Resize the current capacity based on the given capacity and rehash all entries.
+    /// IMPORTANT: Make sure the new capacity is a power of two and can store all the current entries.
+    /// </summary>
+    /// <param name="capacity">New capacity.</param>
+    void resize(const Size capacity) {
+      using SPL::Swap;
+      SparseHashMap map(capacity);
+      for (Size group = 0; map.size < this->size; ++group) {
+        auto& current = this->groups[group];
+        for (Index slot = 0; slot < GroupType::Length; ++slot) {
+          auto* entry = current.get(slot);
+          if (entry != nullptr) {
+            const auto index = map.load(H(entry->key), entry->key);
+            Swap(*map.groups[index / GroupType::Length].set(index % GroupType::Length), *entry);
+            map.size++;
+          }
+        }
+      }
+      Swap(*this, map);
+    }
+    /// <summary>
+    /// Enlarge the current capacity or discard the deleted slots before inserting a new entry.
+    /// When the number of used slots is greater than or equals to 0.8f of the capacity, the table is rehashed.
+    /// </summary>
+    void enlarge() {
+      if (this->capacity == 0) {
+        this->resize(GroupType::Length);
+      }
+      else if (this->size + this->deleted + 1 >= this->capacity - (this->capacity / 5)) {
+        if (this->size + 1 >= this->capacity / 2) {
+          this->resize(this->capacity << 1);
+        }
+        else {
+          this->resize(this->capacity);
+        }
+      }
+    }
+    /// <summary>
+    /// Shrink the current capacity.
+    /// </summary>
+    void shrink() {
+      if (this->capacity > GroupType::Length && this->getLoadFactor() <= 0.2f) {
+        this->resize(this->capacity >> 1);
+      }
+    }
+    /// <summary>
+    /// Get the entry that corresponds to the specified key.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <returns>Returns a pointer to the corresponding entry or null when the key doesn't exists.</returns>
+    EntryType* find(const K& key) const {
+      if (this->capacity > 0) {
+        const auto index = this->load(H(key), key);
+        if (index != -1) {
+          return this->groups[index / GroupType::Length].get(index % GroupType::Length);
+        }
+      }
+      return nullptr;
+    }
+    /// <summary>
+    /// Get the entry that corresponds to the specified key.
+    /// It creates a new entry when the given key doesn't exists.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <returns>Returns a pointer to the corresponding entry.</returns>
+    EntryType* insert(const K& key) {
+      auto* entry = this->find(key);
+      if (entry == nullptr) {
+        this->enlarge();
+        const auto index = this->load(H(key), key);
+        auto& group = this->groups[index / GroupType::Length];
+        const Index slot = index % GroupType::Length;
+        if (group.isDeleted(slot)) {
+          this->deleted--;
+        }
+        entry = group.set(slot);
+        entry->key = key;
+        this->size++;
+      }
+      return entry;
+    }
+    /// <summary>
+    /// Move the value out of the entry that corresponds to the specified key and release its slot.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <param name="value">Output value.</param>
+    /// <returns>Returns true when the entry was released, false otherwise.</returns>
+    bool release(const K& key, ValueType& value) {
+      if (this->capacity > 0) {
+        const auto index = this->load(H(key), key);
+        if (index != -1) {
+          auto& group = this->groups[index / GroupType::Length];
+          const Index slot = index % GroupType::Length;
+          auto* entry = group.get(slot);
+          if (entry != nullptr) {
+            using SPL::Swap;
+            Swap(value, entry->value);
+            group.unset(slot);
+            this->size--;
+            this->deleted++;
+            this->shrink();
+            return true;
+          }
+        }
+      }
+      return false;
+    }
+  public:
+    /// <summary>
+    /// Initialized constructor.
+    /// </summary>
+    /// <param name="capacity">Initial capacity.</param>
+    explicit SparseHashMap(const Size capacity) :
+      capacity(NP2(Math::Max(capacity, GroupType::Length))), groups(new GroupType[this->capacity / GroupType::Length]()),
+      size(0), deleted(0) {}
+    /// <summary>
+    /// Initialized constructor.
+    /// </summary>
+    /// <param name="values">Initial values.</param>
+    template<Size N>
+    SparseHashMap(const Pair<K, V>(&pairs)[N]) : SparseHashMap(N + (N >> 1)) {
+      for (const auto& pair : pairs) {
+        this->set(pair.key, pair.value);
+      }
+    }
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    SparseHashMap() :
+      capacity(0), groups(nullptr), size(0), deleted(0) {}
+    /// <summary>
+    /// Copy constructor.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    SparseHashMap(const SparseHashMap& other) :
+      capacity(other.capacity), groups(nullptr), size(other.size), deleted(other.deleted) {
+      if (other.groups != nullptr) {
+        const auto length = this->capacity / GroupType::Length;
+        this->groups = new GroupType[length]();
+        for (Size group = 0; group < length; ++group) {
+          this->groups[group] = other.groups[group];
+        }
+      }
+    }
+    /// <summary>
+    /// Move constructor.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    SparseHashMap(SparseHashMap&& other) noexcept : SparseHashMap() {
+      Swap(*this, other);
+    }
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    ~SparseHashMap() {
+      delete[] this->groups;
+    }
+  public:
+    /// <summary>
+    /// Get the sparse hash map capacity.
+    /// </summary>
+    /// <returns>Returns the sparse hash map capacity.</returns>
+    Size getCapacity() const {
+      return this->capacity;
+    }
+    /// <summary>
+    /// Get the load factor (between 0.0f and 1.0f).
+    /// </summary>
+    /// <returns>Returns the load factor.</returns>
+    float getLoadFactor() const {
+      return Math::Min((static_cast<float>(this->getSize()) / this->getCapacity()), 1.0f);
+    }
+    /// <summary>
+    /// Get the number of entries in the sparse hash map.
+    /// </summary>
+    /// <returns>Returns the map size.</returns>
+    Size getSize() const override {
+      return this->size;
+    }
+    /// <summary>
+    /// Determines whether or not the sparse hash map is empty.
+    /// </summary>
+    /// <returns>Returns true when the it's empty, false otherwise.</returns>
+    bool isEmpty() const override {
+      return this->size == 0;
+    }
+    /// <summary>
+    /// Get a new entry iterator.
+    /// </summary>
+    /// <returns>Returns the new iterator.</returns>
+    UniqueIterator<EntryType> getIterator() const override {
+      auto* iterator = new SparseIterator<K, V>(this->groups, this->size);
+      return UniqueIterator<EntryType>(iterator);
+    }
+    /// <summary>
+    /// Get an iterator at the first entry for range-based loops.
+    /// </summary>
+    /// <returns>Returns the sparse slot iterator.</returns>
+    SparseSlotIterator<K, V> begin() const {
+      return SparseSlotIterator<K, V>(this->groups, this->groups + this->capacity / GroupType::Length);
+    }
+    /// <summary>
+    /// Get an iterator past the last entry for range-based loops.
+    /// </summary>
+    /// <returns>Returns the sparse slot iterator.</returns>
+    SparseSlotIterator<K, V> end() const {
+      const auto* last = this->groups + this->capacity / GroupType::Length;
+      return SparseSlotIterator<K, V>(last, last);
+    }
+    /// <summary>
+    /// Set the specified key to map the given value by using move semantics.
+    /// When the used slots reach 0.8f of the capacity the map is rehashed and its capacity may double.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <param name="value">Entry value.</param>
+    /// <returns>Returns the previous value for the given key.</returns>
+    V set(const K& key, ValueType&& value) override {
+      auto* entry = this->insert(key);
+      V previous(Move(entry->value));
+      using SPL::Swap;
+      Swap(entry->value, value);
+      return previous;
+    }
+    /// <summary>
+    /// Set the specified key using the given value.
+    /// When the used slots reach 0.8f of the capacity the map is rehashed and its capacity may double.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <param name="value">Entry value.</param>
+    /// <returns>Returns the previous value for the given key.</returns>
+    V set(const K& key, const ValueType& value) override {
+      ValueType copy(value);
+      return this->set(key, Move(copy));
+    }
+    /// <summary>
+    /// Get the value that corresponds to the specified key.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <returns>Returns the corresponding entry value.</returns>
+    /// <exception cref="SPL::Exceptions::KeyNotFound">Throws when the specified key doesn't exists.</exception>
+    V& get(const K& key) const override {
+      auto* entry = this->find(key);
+      if (entry == nullptr) {
+        throw Exceptions::KeyNotFound<K>(key);
+      }
+      return entry->value;
+    }
+    /// <summary>
+    /// Get a copy of the value that corresponds to the specified key.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <param name="value">Output value.</param>
+    /// <returns>Returns true when the value was found, false otherwise.</returns>
+    bool get(const K& key, ValueType& value) const override {
+      auto* entry = this->find(key);
+      if (entry != nullptr) {
+        value = entry->value;
+        return true;
+      }
+      return false;
+    }
+    /// <summary>
+    /// Determines whether or not the sparse hash map contains the specified key.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <returns>Returns true when the key was found, false otherwise.</returns>
+    bool has(const K& key) const override {
+      return this->find(key) != nullptr;
+    }
+    /// <summary>
+    /// Remove the specified key from the sparse hash map.
+    /// When the load factor is less than or equals to 0.2f the map capacity will reduce by half.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <returns>Returns the removed value.</returns>
+    /// <exception cref="SPL::Exceptions::KeyNotFound">Throws when the specified key doesn't exists.</exception>
+    V remove(const K& key) override {
+      ValueType previous;
+      if (!this->release(key, previous)) {
+        throw Exceptions::KeyNotFound<K>(key);
+      }
+      return previous;
+    }
+    /// <summary>
+    /// Remove the specified key from the sparse hash map.
+    /// When the load factor is less than or equals to 0.2f the map capacity will reduce by half.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <param name="value">Output value.</param>
+    /// <returns>Returns true when the value was removed, false otherwise.</returns>
+    bool remove(const K& key, ValueType& value) override {
+      return this->release(key, value);
+    }
+    /// <summary>
+    /// Clear the sparse hash map.
+    /// The current capacity will remains the same.
+    /// </summary>
+    void clear() override {
+      const auto length = this->capacity / GroupType::Length;
+      for (Size group = 0; group < length; ++group) {
+        this->groups[group].clear();
+      }
+      this->size = 0;
+      this->deleted = 0;
+    }
+  public:
+    /// <summary>
+    /// Alias for the get method.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <returns>Returns the corresponding entry value.</returns>
+    const V& operator [](const K& key) const override {
+      return this->get(key);
+    }
+    /// <summary>
+    /// Get the value that corresponds to the specified key.
+    /// It creates a new entry when the given key doesn't exists.
+    /// When the used slots reach 0.8f of the capacity the map is rehashed and its capacity may double.
+    /// </summary>
+    /// <param name="key">Entry key.</param>
+    /// <returns>Returns the corresponding entry value.</returns>
+    V& operator [](const K& key) override {
+      return this->insert(key)->value;
+    }
+    /// <summary>
+    /// Assign all properties from the given sparse hash map.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    /// <returns>Returns the instance itself.</returns>
+    SparseHashMap& operator = (SparseHashMap other) noexcept {
+      Swap(*this, other);
+      return *this;
+    }
+  };
+}
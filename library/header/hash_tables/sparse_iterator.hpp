@@ -0,0 +1,207 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#include <iterator>
+
+#include "./types.hpp"
+#include "./sparse_group.hpp"
+
+namespace SPL::HashTables {
+  /// <summary>
+  /// Sparse iterator class.
+  /// </summary>
+  /// <typeparam name="K">Key type.</typeparam>
+  /// <typeparam name="V">Value type.</typeparam>
+  template<typename K, typename V>
+  class SparseIterator : public Iterator<typename SparseGroup<K, V>::EntryType> {
+  private:
+    /// <summary>
+    /// Sparse group type.
+    /// </summary>
+    using GroupType = SparseGroup<K, V>;
+    /// <summary>
+    /// Sparse entry type.
+    /// </summary>
+    using EntryType = typename GroupType::EntryType;
+    /// <summary>
+    /// Array of groups.
+    /// </summary>
+    const GroupType* groups;
+    /// <summary>
+    /// Total number of entries.
+    /// </summary>
+    Size size;
+    /// <summary>
+    /// Current count.
+    /// </summary>
+    Size count;
+    /// <summary>
+    /// Current group index.
+    /// </summary>
+    Index group;
+    /// <summary>
+    /// Current position in the group.
+    /// </summary>
+    Index position;
+  public:
+    /// <summary>
+    /// Initialized constructor.
+    /// </summary>
+    /// <param name="groups">Array of groups.</param>
+    /// <param name="size">Total number of entries.</param>
+    SparseIterator(const GroupType* const groups, const Size size) :
+      groups(groups), size(size), count(0), group(0), position(0) {}
+  public:
+    /// <summary>
+    /// Check whether or not the iterator has the next entry.
+    /// </summary>
+    /// <returns>Returns true when the next entry exists, false otherwise.</returns>
+    bool hasNext() const override {
+      return this->count < this->size;
+    }
+    /// <summary>
+    /// Move to the next entry and get the current one.
+    /// </summary>
+    /// <returns>Returns the current entry.</returns>
+    /// <exception cref="SPL::Exceptions::InvalidOperation">Throws when there's no next entry.</exception>
+    const EntryType& next() override {
+      if (this->count >= this->size) {
+        throw Exceptions::InvalidOperation();
+      }
+      while (this->position >= this->groups[this->group].getSize()) {
+        this->position = 0;
+        this->group++;
+      }
+      const EntryType* entries = this->groups[this->group];
+      this->count++;
+      return entries[this->position++];
+    }
+  };
+  /// <summary>
+  /// Non-virtual sparse slot iterator class for range-based loops.
+  /// </summary>
+  /// <typeparam name="K">Key type.</typeparam>
+  /// <typeparam name="V">Value type.</typeparam>
+  template<typename K, typename V>
+  class SparseSlotIterator final {
+  private:
+    /// <summary>
+    /// Sparse group type.
+    /// </summary>
+    using GroupType = SparseGroup<K, V>;
+    /// <summary>
+    /// Sparse entry type.
+    /// </summary>
+    using EntryType = typename GroupType::EntryType;
+  public:
+    /// <summary>
+    /// Iterator category (for the standard algorithms).
+    /// </summary>
+    using iterator_category = std::forward_iterator_tag;
+    /// <summary>
+    /// Iterator value type.
+    /// </summary>
+    using value_type = EntryType;
+    /// <summary>
+    /// Iterator difference type.
+    /// </summary>
+    using difference_type = std::ptrdiff_t;
+    /// <summary>
+    /// Iterator pointer type.
+    /// </summary>
+    using pointer = const EntryType*;
+    /// <summary>
+    /// Iterator reference type.
+    /// </summary>
+    using reference = const EntryType&;
+  private:
+    /// <summary>
+    /// Current group.
+    /// </summary>
+    const GroupType* group;
+    /// <summary>
+    /// Group past the last one.
+    /// </summary>
+    const GroupType* last;
+    /// <summary>
+    /// Current position in the packed entries of the current group.
+    /// </summary>
+    Index position;
+  private:
+    /// <summary>
+    /// Move the current group to the next one with entries left.
+    /// </summary>
+    void skip() {
+      while (this->group != this->last && this->position >= this->group->getSize()) {
+        this->position = 0;
+        this->group++;
+      }
+    }
+  public:
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    SparseSlotIterator() :
+      group(nullptr), last(nullptr), position(0) {}
+    /// <summary>
+    /// Initialized constructor.
+    /// </summary>
+    /// <param name="first">First group.</param>
+    /// <param name="last">Group past the last one.</param>
+    SparseSlotIterator(const GroupType* const first, const GroupType* const last) :
+      group(first), last(last), position(0) {
+      this->skip();
+    }
+  public:
+    /// <summary>
+    /// Get the current entry.
+    /// </summary>
+    /// <returns>Returns the current entry.</returns>
+    const EntryType& operator *() const {
+      return static_cast<const EntryType*>(*this->group)[this->position];
+    }
+    /// <summary>
+    /// Get the current entry.
+    /// </summary>
+    /// <returns>Returns a pointer to the current entry.</returns>
+    const EntryType* operator ->() const {
+      return &static_cast<const EntryType*>(*this->group)[this->position];
+    }
+    /// <summary>
+    /// Move to the next entry.
+    /// </summary>
+    /// <returns>Returns the iterator itself.</returns>
+    SparseSlotIterator& operator ++() {
+      this->position++;
+      this->skip();
+      return *this;
+    }
+    /// <summary>
+    /// Move to the next entry.
+    /// </summary>
+    /// <returns>Returns a copy of the iterator before moving.</returns>
+    SparseSlotIterator operator ++(int) {
+      auto previous = *this;
+      ++*this;
+      return previous;
+    }
+    /// <summary>
+    /// Check whether or not both iterators are at the same entry.
+    /// </summary>
+    /// <param name="other">Other iterator.</param>
+    /// <returns>Returns true when both are at the same entry, false otherwise.</returns>
+    bool operator == (const SparseSlotIterator& other) const {
+      return this->group == other.group && this->position == other.position;
+    }
+    /// <summary>
+    /// Check whether or not the iterators are at different entries.
+    /// </summary>
+    /// <param name="other">Other iterator.</param>
+    /// <returns>Returns true when they're at different entries, false otherwise.</returns>
+    bool operator != (const SparseSlotIterator& other) const {
+      return !(*this == other);
+    }
+  };
+}
@@ -5,3 +5,4 @@
 
 #include "./math/min.hpp"
 #include "./math/max.hpp"
+#include "./math/bits.hpp"
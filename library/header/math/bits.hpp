@@ -0,0 +1,75 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "../core/types.hpp"
+
+namespace SPL::Math {
+  /// <summary>
+  /// Get the number of set bits in the given value.
+  /// </summary>
+  /// <param name="value">Input value.</param>
+  /// <returns>Returns the number of set bits.</returns>
+  inline Size PopCount(const unsigned long long int value) {
+#if defined(_MSC_VER) && defined(_M_X64)
+    return static_cast<Size>(__popcnt64(value));
+#elif defined(_MSC_VER)
+    return static_cast<Size>(__popcnt(static_cast<unsigned int>(value)) + __popcnt(static_cast<unsigned int>(value >> 32)));
+#else
+    return static_cast<Size>(__builtin_popcountll(value));
+#endif
+  }
+  /// <summary>
+  /// Get the number of zero bits before the first set bit (starting from the least significant bit).
+  /// </summary>
+  /// <param name="value">Input value.</param>
+  /// <returns>Returns the number of trailing zero bits or 64 when the value is zero.</returns>
+  inline Size CountTrailingZeros(const unsigned long long int value) {
+    if (value == 0) {
+      return 64;
+    }
+#if defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return static_cast<Size>(index);
+#elif defined(_MSC_VER)
+    unsigned long index;
+    if (_BitScanForward(&index, static_cast<unsigned long>(value))) {
+      return static_cast<Size>(index);
+    }
+    _BitScanForward(&index, static_cast<unsigned long>(value >> 32));
+    return static_cast<Size>(index + 32);
+#else
+    return static_cast<Size>(__builtin_ctzll(value));
+#endif
+  }
+  /// <summary>
+  /// Get the number of zero bits before the first set bit (starting from the most significant bit).
+  /// </summary>
+  /// <param name="value">Input value.</param>
+  /// <returns>Returns the number of leading zero bits or 64 when the value is zero.</returns>
+  inline Size CountLeadingZeros(const unsigned long long int value) {
+    if (value == 0) {
+      return 64;
+    }
+#if defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return static_cast<Size>(63 - index);
+#elif defined(_MSC_VER)
+    unsigned long index;
+    if (_BitScanReverse(&index, static_cast<unsigned long>(value >> 32))) {
+      return static_cast<Size>(31 - index);
+    }
+    _BitScanReverse(&index, static_cast<unsigned long>(value));
+    return static_cast<Size>(63 - index);
+#else
+    return static_cast<Size>(__builtin_clzll(value));
+#endif
+  }
+}
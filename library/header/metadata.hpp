@@ -11,3 +11,4 @@
 #include "./metadata/integer.hpp"
 #include "./metadata/decimal.hpp"
 #include "./metadata/class.hpp"
+#include "./metadata/trivial.hpp"
@@ -0,0 +1,49 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+namespace SPL::Metadata {
+  /// <summary>
+  /// Relocation metadata.
+  /// Specialize it for types that can be moved to another address with a memory copy (without calling the move
+  /// constructor and the destructor), even when they aren't trivially copyable.
+  /// </summary>
+  /// <typeparam name="T">Type.</typeparam>
+  template<typename T>
+  class Relocation {
+  public:
+    /// <summary>
+    /// Determines whether or not the given type was declared as relocatable.
+    /// </summary>
+    constexpr static bool Is = false;
+  };
+  /// <summary>
+  /// Trivial metadata.
+  /// </summary>
+  /// <typeparam name="T">Type.</typeparam>
+  template<typename T>
+  class Trivial {
+  public:
+    /// <summary>
+    /// Determines whether or not the given type can be copied with a memory copy.
+    /// </summary>
+    constexpr static bool Copyable = __is_trivially_copyable(T);
+    /// <summary>
+    /// Determines whether or not the given type can be relocated with a memory copy.
+    /// </summary>
+    constexpr static bool Relocatable = Copyable || Relocation<T>::Is;
+  };
+  /// <summary>
+  /// Determines whether or not the given type is trivially copyable.
+  /// </summary>
+  /// <typeparam name="T">Type.</typeparam>
+  template<typename T>
+  constexpr bool IsTriviallyCopyable = Trivial<T>::Copyable;
+  /// <summary>
+  /// Determines whether or not the given type is trivially relocatable.
+  /// </summary>
+  /// <typeparam name="T">Type.</typeparam>
+  template<typename T>
+  constexpr bool IsTriviallyRelocatable = Trivial<T>::Relocatable;
+}
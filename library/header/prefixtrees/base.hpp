@@ -5,6 +5,7 @@
 
 #include "./types.hpp"
 #include "./node.hpp"
+#include "./node_iterator.hpp"
 
 namespace SPL::PrefixTrees {
   /// <summary>
@@ -125,6 +126,20 @@ namespace SPL::PrefixTrees {
       return this->size;
     }
     /// <summary>
+    /// Get an iterator at the first terminal node in ascending key order.
+    /// </summary>
+    /// <returns>Returns the node iterator.</returns>
+    NodeIterator<K, V...> begin() const {
+      return NodeIterator<K, V...>(this->root);
+    }
+    /// <summary>
+    /// Get an iterator past the last terminal node.
+    /// </summary>
+    /// <returns>Returns the node iterator.</returns>
+    NodeIterator<K, V...> end() const {
+      return NodeIterator<K, V...>();
+    }
+    /// <summary>
     /// Set a terminal prefix node for the specified key.
     /// If it doesn't exists try to create a new one.
     /// </summary>
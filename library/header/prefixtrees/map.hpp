@@ -63,6 +63,20 @@ namespace SPL::PrefixTrees {
       return this->tree.getSize() == 0;
     }
     /// <summary>
+    /// Get an iterator at the first key and value pair in ascending key order for range-based loops.
+    /// </summary>
+    /// <returns>Returns the node iterator.</returns>
+    NodeIterator<K, V> begin() const {
+      return this->tree.begin();
+    }
+    /// <summary>
+    /// Get an iterator past the last key and value pair for range-based loops.
+    /// </summary>
+    /// <returns>Returns the node iterator.</returns>
+    NodeIterator<K, V> end() const {
+      return this->tree.end();
+    }
+    /// <summary>
     /// Set the specified key to map the given value by using move semantics.
     /// </summary>
     /// <param name="key">Prefix key.</param>
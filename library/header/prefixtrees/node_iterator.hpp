@@ -0,0 +1,299 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#pragma once
+
+#include <iterator>
+
+#include "./types.hpp"
+#include "./node.hpp"
+
+namespace SPL::PrefixTrees {
+  /// <summary>
+  /// Non-virtual in-order node iterator class for range-based loops.
+  /// It walks all the terminal nodes in ascending key order and rebuilds the full key of each one.
+  /// </summary>
+  /// <typeparam name="K">Key type.</typeparam>
+  /// <typeparam name="...V">Value type.</typeparam>
+  template<typename K, typename ...V>
+  class NodeIterator final {
+  private:
+    /// <summary>
+    /// Node type.
+    /// </summary>
+    using NodeType = Node<K, V...>;
+    /// <summary>
+    /// Non-constant key character type.
+    /// </summary>
+    using CharType = Metadata::ConstantType<Metadata::PointerType<K>>;
+    // Current key for sets.
+    template<typename ...A>
+    struct Resolver {
+      using Type = const CharType*;
+    };
+    // Current key and value pair for maps.
+    template<typename A>
+    struct Resolver<A> {
+      using Type = Pair<const CharType*, const A&>;
+    };
+  public:
+    /// <summary>
+    /// Iterator category (for the standard algorithms).
+    /// </summary>
+    using iterator_category = std::forward_iterator_tag;
+    /// <summary>
+    /// Iterator value type, the current key (for sets) or the current key and value pair (for maps).
+    /// </summary>
+    using value_type = typename Resolver<V...>::Type;
+    /// <summary>
+    /// Iterator difference type.
+    /// </summary>
+    using difference_type = std::ptrdiff_t;
+    /// <summary>
+    /// Iterator pointer type (there's no member access, the values are built on access).
+    /// </summary>
+    using pointer = void;
+    /// <summary>
+    /// Iterator reference type (the values are built on access).
+    /// </summary>
+    using reference = value_type;
+  private:
+    /// <summary>
+    /// Pending node class.
+    /// </summary>
+    class Frame final {
+    public:
+      /// <summary>
+      /// Pending node.
+      /// </summary>
+      const NodeType* node;
+      /// <summary>
+      /// Key depth of the pending node.
+      /// </summary>
+      Size depth;
+      /// <summary>
+      /// Determines whether or not the sibling nodes were already pushed.
+      /// </summary>
+      bool visited;
+    };
+    /// <summary>
+    /// Stack of pending nodes.
+    /// </summary>
+    Frame* frames;
+    /// <summary>
+    /// Number of pending nodes.
+    /// </summary>
+    Size count;
+    /// <summary>
+    /// Capacity of the pending nodes stack.
+    /// </summary>
+    Size capacity;
+    /// <summary>
+    /// Key of the current node.
+    /// </summary>
+    CharType* key;
+    /// <summary>
+    /// Capacity of the key.
+    /// </summary>
+    Size length;
+    /// <summary>
+    /// Current node.
+    /// </summary>
+    const NodeType* current;
+  private:
+    /// <summary>
+    /// Exchange all properties from the given objects.
+    /// </summary>
+    /// <param name="source">Source object.</param>
+    /// <param name="target">Target object.</param>
+    friend void Swap(NodeIterator& source, NodeIterator& target) noexcept {
+      using SPL::Swap;
+      Swap(source.frames, target.frames);
+      Swap(source.count, target.count);
+      Swap(source.capacity, target.capacity);
+      Swap(source.key, target.key);
+      Swap(source.length, target.length);
+      Swap(source.current, target.current);
+    }
+    /// <summary>
+    /// Move the given elements into a new buffer.
+    /// </summary>
+    /// <typeparam name="T">Element type.</typeparam>
+    /// <param name="elements">Current elements.</param>
+    /// <param name="length">Number of elements to keep.</param>
+    /// <param name="capacity">New capacity.</param>
+    /// <returns>Returns the new buffer.</returns>
+    template<typename T>
+    static T* Resize(T elements[], const Size length, const Size capacity) {
+      auto* buffer = Allocate<T>(capacity);
+      if (elements != nullptr) {
+        MemoryCopy(elements, buffer, length);
+        Deallocate(elements);
+      }
+      return buffer;
+    }
+    /// <summary>
+    /// Push the given node into the pending nodes stack.
+    /// </summary>
+    /// <param name="node">Pending node.</param>
+    /// <param name="depth">Key depth.</param>
+    /// <param name="visited">Determines whether or not the sibling nodes were already pushed.</param>
+    void push(const NodeType* const node, const Size depth, const bool visited) {
+      if (this->count == this->capacity) {
+        this->capacity = Math::Max<Size>(this->capacity << 1, 16);
+        this->frames = Resize(this->frames, this->count, this->capacity);
+      }
+      this->frames[this->count++] = { node, depth, visited };
+    }
+    /// <summary>
+    /// Move to the next terminal node.
+    /// The right nodes hold the lower characters, so they're visited before the left ones.
+    /// </summary>
+    void advance() {
+      this->current = nullptr;
+      while (this->count > 0) {
+        const auto frame = this->frames[--this->count];
+        const auto* node = frame.node;
+        if (!frame.visited) {
+          if (node->getLeftNode() != nullptr) {
+            this->push(node->getLeftNode(), frame.depth, false);
+          }
+          this->push(node, frame.depth, true);
+          if (node->getRightNode() != nullptr) {
+            this->push(node->getRightNode(), frame.depth, false);
+          }
+          continue;
+        }
+        if (frame.depth + 2 > this->length) {
+          const auto length = Math::Max<Size>(this->length << 1, frame.depth + 2);
+          this->key = Resize(this->key, this->length, length);
+          this->length = length;
+        }
+        this->key[frame.depth] = node->getKey();
+        this->key[frame.depth + 1] = CharType();
+        if (node->getDownNode() != nullptr) {
+          this->push(node->getDownNode(), frame.depth + 1, false);
+        }
+        if (node->isTerminal()) {
+          this->current = node;
+          return;
+        }
+      }
+    }
+  public:
+    /// <summary>
+    /// Default constructor (end iterator).
+    /// </summary>
+    NodeIterator() :
+      frames(nullptr), count(0), capacity(0), key(nullptr), length(0), current(nullptr) {}
+    /// <summary>
+    /// Initialized constructor.
+    /// </summary>
+    /// <param name="root">Root node.</param>
+    explicit NodeIterator(const NodeType* const root) : NodeIterator() {
+      if (root != nullptr) {
+        this->push(root, 0, false);
+        this->advance();
+      }
+    }
+    /// <summary>
+    /// Copy constructor.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    NodeIterator(const NodeIterator& other) :
+      frames(nullptr), count(other.count), capacity(other.capacity), key(nullptr), length(other.length), current(other.current) {
+      if (other.frames != nullptr) {
+        this->frames = Allocate<Frame>(other.capacity);
+        MemoryCopy(other.frames, this->frames, other.count);
+      }
+      if (other.key != nullptr) {
+        this->key = Allocate<CharType>(other.length);
+        MemoryCopy(other.key, this->key, other.length);
+      }
+    }
+    /// <summary>
+    /// Move constructor.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    NodeIterator(NodeIterator&& other) noexcept : NodeIterator() {
+      Swap(*this, other);
+    }
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    ~NodeIterator() {
+      Deallocate(this->frames);
+      Deallocate(this->key);
+    }
+  public:
+    /// <summary>
+    /// Get the full key of the current node.
+    /// </summary>
+    /// <returns>Returns the null-terminated key.</returns>
+    const CharType* getKey() const {
+      return this->key;
+    }
+    /// <summary>
+    /// Get the current node.
+    /// </summary>
+    /// <returns>Returns the current node or null when there's no current node.</returns>
+    const NodeType* getNode() const {
+      return this->current;
+    }
+  public:
+    /// <summary>
+    /// Get the current key (for sets) or the current key and value pair (for maps).
+    /// </summary>
+    /// <returns>Returns the current key or pair.</returns>
+    value_type operator *() const {
+      if constexpr (sizeof...(V) == 0) {
+        return this->key;
+      }
+      else {
+        return value_type(this->key, this->current->value);
+      }
+    }
+    /// <summary>
+    /// Move to the next terminal node.
+    /// </summary>
+    /// <returns>Returns the iterator itself.</returns>
+    NodeIterator& operator ++() {
+      this->advance();
+      return *this;
+    }
+    /// <summary>
+    /// Move to the next terminal node.
+    /// </summary>
+    /// <returns>Returns a copy of the iterator before moving.</returns>
+    NodeIterator operator ++(int) {
+      auto previous = *this;
+      this->advance();
+      return previous;
+    }
+    /// <summary>
+    /// Check whether or not both iterators are at the same node.
+    /// </summary>
+    /// <param name="other">Other iterator.</param>
+    /// <returns>Returns true when both are at the same node, false otherwise.</returns>
+    bool operator == (const NodeIterator& other) const {
+      return this->current == other.current;
+    }
+    /// <summary>
+    /// Check whether or not the iterators are at different nodes.
+    /// </summary>
+    /// <param name="other">Other iterator.</param>
+    /// <returns>Returns true when they're at different nodes, false otherwise.</returns>
+    bool operator != (const NodeIterator& other) const {
+      return this->current != other.current;
+    }
+    /// <summary>
+    /// Assign all properties from the given iterator.
+    /// </summary>
+    /// <param name="other">Other instance.</param>
+    /// <returns>Returns the instance itself.</returns>
+    NodeIterator& operator = (NodeIterator other) noexcept {
+      Swap(*this, other);
+      return *this;
+    }
+  };
+}
@@ -62,6 +62,20 @@ namespace SPL::PrefixTrees {
       return this->tree.getSize() == 0;
     }
     /// <summary>
+    /// Get an iterator at the first key in ascending key order for range-based loops.
+    /// </summary>
+    /// <returns>Returns the node iterator.</returns>
+    NodeIterator<T> begin() const {
+      return this->tree.begin();
+    }
+    /// <summary>
+    /// Get an iterator past the last key for range-based loops.
+    /// </summary>
+    /// <returns>Returns the node iterator.</returns>
+    NodeIterator<T> end() const {
+      return this->tree.end();
+    }
+    /// <summary>
     /// Add the specified value in the set by using move semantics.
     /// </summary>
     /// <param name="value">Value.</param>
@@ -8,11 +8,30 @@
 namespace SPL::Strings {
   /// <summary>
   /// Basic string class.
+  /// The characters are stored in a reference-counted buffer shared by all the copies (copy-on-write), so copying
+  /// a string is O(1) and the buffer is cloned only on the first mutation of a shared copy.
+  /// Once a mutable character reference or pointer is handed out, the buffer is no longer shared and copies are deep.
   /// </summary>
   /// <typeparam name="T">Character type.</typeparam>
   template<typename T>
   class BasicString final {
   private:
+    /// <summary>
+    /// Buffer header class.
+    /// Stored right before the characters of the buffer.
+    /// </summary>
+    class Header final {
+    public:
+      /// <summary>
+      /// Number of references.
+      /// </summary>
+      volatile Size references;
+      /// <summary>
+      /// Determines whether or not the buffer can be shared (false once a mutable reference was handed out).
+      /// </summary>
+      bool shareable;
+    };
+    static_assert(alignof(T) <= alignof(Header), "The character type (T) can't be aligned after the buffer header.");
     /// <summary>
     /// Array of characters.
     /// </summary>
@@ -32,6 +51,61 @@ namespace SPL::Strings {
       Swap(source.string, target.string);
       Swap(source.length, target.length);
     }
+    /// <summary>
+    /// Create a new buffer (with one reference) for the given number of characters.
+    /// </summary>
+    /// <param name="length">Number of characters.</param>
+    /// <returns>Returns the zero-initialized characters of the new buffer or null when the length is zero.</returns>
+    static T* Create(const Size length) {
+      if (length == 0) {
+        return nullptr;
+      }
+      auto* header = Allocate<Header>(1 + (sizeof(T) * length + sizeof(Header) - 1) / sizeof(Header));
+      header->references = 1;
+      header->shareable = true;
+      auto* string = reinterpret_cast<T*>(header + 1);
+      for (Index index = 0; index < length; ++index) {
+        string[index] = T();
+      }
+      return string;
+    }
+    /// <summary>
+    /// Get the header of the given buffer.
+    /// </summary>
+    /// <param name="string">Buffer characters.</param>
+    /// <returns>Returns the buffer header.</returns>
+    static Header* GetHeader(const T* const string) {
+      return reinterpret_cast<Header*>(const_cast<T*>(string)) - 1;
+    }
+    /// <summary>
+    /// Release one reference of the given buffer and deallocate it when there are no more references.
+    /// </summary>
+    /// <param name="string">Buffer characters.</param>
+    static void Release(const T* const string) {
+      if (string != nullptr && AtomicDecrement(GetHeader(string)->references) == 0) {
+        Deallocate(GetHeader(string));
+      }
+    }
+    /// <summary>
+    /// Ensure the current buffer isn't shared with other strings, cloning it when necessary.
+    /// </summary>
+    void own() {
+      if (this->string != nullptr && GetHeader(this->string)->references > 1) {
+        auto* string = Copy(this->string, Create(this->length), this->length);
+        Release(this->string);
+        this->string = string;
+      }
+    }
+    /// <summary>
+    /// Ensure the current buffer isn't shared with other strings and mark it as unshareable,
+    /// since the caller may keep a mutable reference into it.
+    /// </summary>
+    void expose() {
+      this->own();
+      if (this->string != nullptr) {
+        GetHeader(this->string)->shareable = false;
+      }
+    }
   public:
     /// <summary>
     /// Default constructor.
@@ -43,14 +117,14 @@ namespace SPL::Strings {
     /// </summary>
     /// <param name="length">Initial length.</param>
     BasicString(const Size length) :
-      string(length > 0 ? new T[length]() : nullptr), length(length) {}
+      string(Create(length)), length(length) {}
     /// <summary>
     /// Initialized constructor.
     /// </summary>
     /// <param name="string">Initial string.</param>
     /// <param name="length">Initial length.</param>
     BasicString(const T string[], const Size length) :
-      string(length > 0 ? Copy(string, new T[length], length) : nullptr), length(length) {}
+      string(length > 0 ? Copy(string, Create(length), length) : nullptr), length(length) {}
     /// <summary>
     /// Initialized constructor.
     /// </summary>
@@ -60,10 +134,20 @@ namespace SPL::Strings {
       BasicString(string, (string[N - 1] == T()) ? N - 1 : N) {}
     /// <summary>
     /// Copy constructor.
+    /// The buffer is shared until one of the strings is changed, unless it's unshareable.
     /// </summary>
     /// <param name="other">Other instance.</param>
     BasicString(const BasicString& other) :
-      BasicString(other.string, other.length) {}
+      string(other.string), length(other.length) {
+      if (this->string != nullptr) {
+        if (GetHeader(this->string)->shareable) {
+          AtomicIncrement(GetHeader(this->string)->references);
+        }
+        else {
+          this->string = Copy(other.string, Create(this->length), this->length);
+        }
+      }
+    }
     /// <summary>
     /// Move constructor.
     /// </summary>
@@ -75,7 +159,7 @@ namespace SPL::Strings {
     /// Destructor.
     /// </summary>
     ~BasicString() {
-      delete[] this->string;
+      Release(this->string);
     }
   public:
     /// <summary>
@@ -112,13 +196,59 @@ namespace SPL::Strings {
     /// <param name="index">Zero-based index.</param>
     /// <returns>Returns the corresponding character.</returns>
     /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
-    T& get(const Index index) const {
+    const T& get(const Index index) const {
       if (index >= this->length) {
         throw Exceptions::IndexOutOfBounds(index);
       }
       return this->string[index];
     }
     /// <summary>
+    /// Get the character that corresponds to the specified index.
+    /// The buffer is cloned first when it's shared with other strings and it's no longer shared after that.
+    /// </summary>
+    /// <param name="index">Zero-based index.</param>
+    /// <returns>Returns the corresponding character.</returns>
+    /// <exception cref="SPL::Exceptions::IndexOutOfBounds">Throws when the specified index is out of bounds.</exception>
+    T& get(const Index index) {
+      if (index >= this->length) {
+        throw Exceptions::IndexOutOfBounds(index);
+      }
+      this->expose();
+      return this->string[index];
+    }
+    /// <summary>
+    /// Get a pointer to the first character.
+    /// </summary>
+    /// <returns>Returns the pointer to the first character.</returns>
+    const T* begin() const {
+      return this->string;
+    }
+    /// <summary>
+    /// Get a pointer past the last character.
+    /// </summary>
+    /// <returns>Returns the pointer past the last character.</returns>
+    const T* end() const {
+      return this->string + this->length;
+    }
+    /// <summary>
+    /// Get a pointer to the first character.
+    /// The buffer is cloned first when it's shared with other strings and it's no longer shared after that.
+    /// </summary>
+    /// <returns>Returns the pointer to the first character.</returns>
+    T* begin() {
+      this->expose();
+      return this->string;
+    }
+    /// <summary>
+    /// Get a pointer past the last character.
+    /// The buffer is cloned first when it's shared with other strings and it's no longer shared after that.
+    /// </summary>
+    /// <returns>Returns the pointer past the last character.</returns>
+    T* end() {
+      this->expose();
+      return this->string + this->length;
+    }
+    /// <summary>
     /// Get the first index occurrence of the specified character in the string.
     /// </summary>
     /// <param name="search">Search character.</param>
@@ -200,8 +330,10 @@ namespace SPL::Strings {
     }
     /// <summary>
     /// Reverse the string (in-place).
+    /// The buffer is cloned first when it's shared with other strings.
     /// </summary>
     void reverse() {
+      this->own();
       using SPL::Swap;
       for (Size offset = 0; offset < this->length / 2; ++offset) {
         Swap(this->string[offset], this->string[this->length - 1 - offset]);
@@ -58,6 +58,7 @@ namespace SPL::Strings {
       string(string) {}
     /// <summary>
     /// Copy constructor.
+    /// The characters are shared until one of the strings is changed, unless a mutable reference was handed out.
     /// </summary>
     /// <param name="other">Other instance.</param>
     WideString(const WideString& other) :
@@ -92,6 +93,35 @@ namespace SPL::Strings {
       return UniqueIterator<wchar_t>(iterator);
     }
     /// <summary>
+    /// Get a pointer to the first character for range-based loops.
+    /// </summary>
+    /// <returns>Returns the pointer to the first character.</returns>
+    const wchar_t* begin() const {
+      return this->string.begin();
+    }
+    /// <summary>
+    /// Get a pointer past the last character for range-based loops.
+    /// </summary>
+    /// <returns>Returns the pointer past the last character.</returns>
+    const wchar_t* end() const {
+      return this->string.end();
+    }
+    /// <summary>
+    /// Get a pointer to the first character for range-based loops.
+    /// The characters are cloned first when they're shared with other strings and they're no longer shared after that.
+    /// </summary>
+    /// <returns>Returns the pointer to the first character.</returns>
+    wchar_t* begin() {
+      return this->string.begin();
+    }
+    /// <summary>
+    /// Get a pointer past the last character for range-based loops.
+    /// </summary>
+    /// <returns>Returns the pointer past the last character.</returns>
+    wchar_t* end() {
+      return this->string.end();
+    }
+    /// <summary>
     /// Merge all the given strings into a new one.
     /// </summary>
     /// <param name="pack">Pack of strings.</param>
@@ -196,6 +226,7 @@ namespace SPL::Strings {
     }
     /// <summary>
     /// Get the character that corresponds to the specified index.
+    /// The characters are cloned first when they're shared with other strings and they're no longer shared after that.
     /// </summary>
     /// <param name="index">Zero-based index.</param>
     /// <returns>Returns the corresponding character.</returns>
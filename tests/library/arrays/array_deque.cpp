@@ -0,0 +1,280 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#include <algorithm>
+#include <iterator>
+
+#include "../mock.hpp"
+#include "CppUnitTest.h"
+#include "interfaces.hpp"
+#include "arrays.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace SPL::Tests;
+
+namespace SPL::Tests {
+  /// <summary>
+  /// Test class.
+  /// </summary>
+  TEST_CLASS(ArrayDequeTests)
+  {
+  public:
+    /// <summary>
+    /// Test the empty constructor.
+    /// </summary>
+    TEST_METHOD(ConstructEmpty) {
+      ArrayDeque<const float> deque;
+      // Check state.
+      Assert::IsTrue(deque.isEmpty());
+      Assert::AreEqual<Size>(0, deque.getLength());
+      Assert::AreEqual<Size>(0, deque.getCapacity());
+    }
+    /// <summary>
+    /// Test the initialized constructor for capacity.
+    /// </summary>
+    TEST_METHOD(ConstructCapacity) {
+      ArrayDeque<const float> deque(10);
+      // Check state.
+      Assert::IsTrue(deque.isEmpty());
+      Assert::AreEqual<Size>(16, deque.getCapacity());
+    }
+    /// <summary>
+    /// Test the initialized constructor for elements.
+    /// </summary>
+    TEST_METHOD(ConstructElements) {
+      ArrayDeque<const float> deque({ 1.5f, 2.5f, 3.5f });
+      // Check state.
+      Assert::AreEqual<Size>(3, deque.getLength());
+      Assert::AreEqual(1.5f, deque[0]);
+      Assert::AreEqual(3.5f, deque[2]);
+    }
+    /// <summary>
+    /// Test the copy constructor.
+    /// </summary>
+    TEST_METHOD(ConstructCopy) {
+      ArrayDeque<int> deque({ 2, 3 });
+      deque.pushFront(1);
+      ArrayDeque<int> other(deque);
+      // Change values.
+      deque[0] = 10;
+      // Check state.
+      Assert::AreEqual<Size>(3, other.getLength());
+      Assert::AreEqual(1, other[0]);
+      Assert::AreEqual(3, other[2]);
+      Assert::AreEqual(10, deque[0]);
+    }
+    /// <summary>
+    /// Test the move constructor.
+    /// </summary>
+    TEST_METHOD(ConstructMove) {
+      Size instances = 0;
+      ArrayDeque<Mock> deque({ Mock(instances), Mock(instances) });
+      ArrayDeque<Mock> other(Move(deque));
+      // Check state.
+      Assert::AreEqual<Size>(2, instances);
+      Assert::IsTrue(deque.isEmpty());
+      Assert::AreEqual<Size>(2, other.getLength());
+    }
+    /// <summary>
+    /// Test the destructor.
+    /// </summary>
+    TEST_METHOD(Destruct) {
+      Size instances = 0;
+      // Create a new instance (wrapped around the buffer end).
+      auto* deque = new ArrayDeque<Mock>(4);
+      deque->pushBack(Mock(instances));
+      deque->pushBack(Mock(instances));
+      deque->pushFront(Mock(instances));
+      Assert::AreEqual<Size>(3, instances);
+      // Delete the instance.
+      delete deque;
+      Assert::AreEqual<Size>(0, instances);
+    }
+    /// <summary>
+    /// Test the push and pop methods at both ends.
+    /// </summary>
+    TEST_METHOD(MethodPushPop) {
+      ArrayDeque<int> deque;
+      // Add values.
+      Assert::AreEqual<Size>(1, deque.pushBack(2));
+      Assert::AreEqual<Size>(2, deque.pushFront(1));
+      Assert::AreEqual<Size>(3, deque.pushBack(3));
+      Assert::AreEqual(1, deque.getFront());
+      Assert::AreEqual(3, deque.getBack());
+      // Remove values.
+      int value = 0;
+      Assert::AreEqual(3, deque.popBack());
+      Assert::AreEqual(1, deque.popFront());
+      Assert::IsTrue(deque.popFront(value));
+      Assert::AreEqual(2, value);
+      Assert::IsFalse(deque.popBack(value));
+      Assert::IsTrue(deque.isEmpty());
+      Assert::ExpectException<SPL::Exceptions::InvalidOperation>([&deque] {
+        deque.popFront();
+      });
+      Assert::ExpectException<SPL::Exceptions::InvalidOperation>([&deque] {
+        deque.getBack();
+      });
+    }
+    /// <summary>
+    /// Test the push methods with elements from the deque itself.
+    /// </summary>
+    TEST_METHOD(MethodPushSelf) {
+      ArrayDeque<int> deque(4);
+      for (int value = 1; value <= 4; ++value) {
+        deque.pushBack(value);
+      }
+      // Add values from the deque itself.
+      deque.pushBack(deque[0]);
+      ArrayDeque<int> other(deque);
+      for (int value = 6; value <= 8; ++value) {
+        other.pushBack(value);
+      }
+      Assert::AreEqual<Size>(8, other.getCapacity());
+      other.pushFront(other[3]);
+      // Check values.
+      const int result[] = { 4, 1, 2, 3, 4, 1, 6, 7, 8 };
+      Assert::AreEqual<Size>(9, other.getLength());
+      for (Index index = 0; index < (sizeof(result) / sizeof(int)); ++index) {
+        Assert::AreEqual(result[index], other[index]);
+      }
+    }
+    /// <summary>
+    /// Test the emplace methods.
+    /// </summary>
+    TEST_METHOD(MethodEmplace) {
+      Size instances = 0;
+      ArrayDeque<Mock> deque;
+      // Construct values.
+      auto& back = deque.emplaceBack(instances);
+      auto& front = deque.emplaceFront(instances);
+      // Check state.
+      Assert::AreEqual<Size>(2, instances);
+      Assert::IsTrue(&front == &deque[0]);
+      Assert::IsTrue(&back == &deque[1]);
+    }
+    /// <summary>
+    /// Test the index of method.
+    /// </summary>
+    TEST_METHOD(MethodIndexOf) {
+      ArrayDeque<int> deque(4);
+      deque.pushBack(3);
+      deque.pushBack(4);
+      deque.pushFront(2);
+      deque.pushFront(1);
+      // Check state.
+      Assert::AreEqual<Size>(0, deque.indexOf(1));
+      Assert::AreEqual<Size>(2, deque.indexOf(3));
+      Assert::AreEqual<Size>(3, deque.indexOf(4));
+      Assert::AreEqual(static_cast<Index>(-1), deque.indexOf(5));
+      Assert::IsTrue(deque.contains(2));
+    }
+    /// <summary>
+    /// Test the clear method.
+    /// </summary>
+    TEST_METHOD(MethodClear) {
+      Size instances = 0;
+      ArrayDeque<Mock> deque({ Mock(instances), Mock(instances) });
+      deque.pushFront(Mock(instances));
+      // Clear values.
+      deque.clear();
+      Assert::AreEqual<Size>(0, instances);
+      Assert::IsTrue(deque.isEmpty());
+      Assert::AreEqual<Size>(4, deque.getCapacity());
+    }
+    /// <summary>
+    /// Test the growth and the shrink of a wrapped buffer.
+    /// </summary>
+    TEST_METHOD(FeatureResize) {
+      ArrayDeque<int> deque(4);
+      for (int value = 0; value < 100; ++value) {
+        if (value % 2 == 0) {
+          deque.pushBack(value);
+        }
+        else {
+          deque.pushFront(value);
+        }
+      }
+      Assert::AreEqual<Size>(128, deque.getCapacity());
+      // Check values.
+      for (Index index = 0; index < 50; ++index) {
+        Assert::AreEqual(static_cast<int>(99 - index * 2), deque[index]);
+        Assert::AreEqual(static_cast<int>(index * 2), deque[50 + index]);
+      }
+      // Remove values.
+      for (int value = 0; value < 98; ++value) {
+        deque.popFront();
+      }
+      Assert::AreEqual<Size>(4, deque.getCapacity());
+      Assert::AreEqual(96, deque[0]);
+      Assert::AreEqual(98, deque[1]);
+    }
+    /// <summary>
+    /// Test the queue usage (FIFO).
+    /// </summary>
+    TEST_METHOD(FeatureQueue) {
+      ArrayDeque<int> deque;
+      int expected = 0;
+      for (int value = 0; value < 1000; ++value) {
+        deque.pushBack(value);
+        if (value % 3 == 0) {
+          Assert::AreEqual(expected++, deque.popFront());
+        }
+      }
+      while (!deque.isEmpty()) {
+        Assert::AreEqual(expected++, deque.popFront());
+      }
+      Assert::AreEqual(1000, expected);
+    }
+    /// <summary>
+    /// Test the iterator.
+    /// </summary>
+    TEST_METHOD(FeatureIterator) {
+      ArrayDeque<int> deque({ 2, 3 });
+      deque.pushFront(1);
+      auto iterator = deque.getIterator();
+      // Check values.
+      int expected = 1;
+      while (iterator->hasNext()) {
+        Assert::AreEqual(expected++, iterator->next());
+      }
+      Assert::AreEqual(4, expected);
+    }
+    /// <summary>
+    /// Test the range-based loop.
+    /// </summary>
+    TEST_METHOD(FeatureRangeFor) {
+      ArrayDeque<int> deque(4);
+      deque.pushBack(3);
+      deque.pushBack(4);
+      deque.pushFront(2);
+      deque.pushFront(1);
+      // Check values across the buffer end.
+      int expected = 1;
+      for (auto& value : deque) {
+        Assert::AreEqual(expected++, value);
+        value *= 10;
+      }
+      Assert::AreEqual(5, expected);
+      // Check the standard algorithms.
+      const auto& constant = deque;
+      Assert::AreEqual<Size>(4, static_cast<Size>(std::distance(constant.begin(), constant.end())));
+      Assert::AreEqual(30, *std::find(constant.begin(), constant.end(), 30));
+      Assert::IsTrue(std::find(deque.begin(), deque.end(), 3) == deque.end());
+      for (const auto& value : ArrayDeque<int>()) {
+        Assert::Fail();
+      }
+    }
+    /// <summary>
+    /// Test the access operator.
+    /// </summary>
+    TEST_METHOD(OperatorAccess) {
+      ArrayDeque<int> deque({ 1, 2 });
+      // Check state.
+      Assert::AreEqual(2, deque[1]);
+      Assert::ExpectException<SPL::Exceptions::IndexOutOfBounds>([&deque] {
+        deque[2];
+      });
+    }
+  };
+}
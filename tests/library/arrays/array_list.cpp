@@ -15,6 +15,62 @@ namespace SPL::Tests {
   /// </summary>
   TEST_CLASS(ArrayListTests)
   {
+  private:
+    /// <summary>
+    /// Test class without a default constructor.
+    /// </summary>
+    class Counted : public Comparable<Counted> {
+    public:
+      /// <summary>
+      /// Number of constructed instances.
+      /// </summary>
+      static inline Size Instances = 0;
+      /// <summary>
+      /// Number of copied instances.
+      /// </summary>
+      static inline Size Copies = 0;
+      /// <summary>
+      /// Instance value.
+      /// </summary>
+      int value;
+      /// <summary>
+      /// Initialized constructor.
+      /// </summary>
+      /// <param name="value">Instance value.</param>
+      explicit Counted(const int value) : value(value) {
+        Instances++;
+      }
+      /// <summary>
+      /// Copy constructor.
+      /// </summary>
+      /// <param name="other">Other instance.</param>
+      Counted(const Counted& other) : Counted(other.value) {
+        Copies++;
+      }
+      /// <summary>
+      /// Destructor.
+      /// </summary>
+      ~Counted() {
+        Instances--;
+      }
+      /// <summary>
+      /// Compare the instance with the given one.
+      /// </summary>
+      /// <param name="other">Other instance.</param>
+      /// <returns>Returns the comparison result.</returns>
+      int compare(const Counted& other) const override {
+        return this->value - other.value;
+      }
+      /// <summary>
+      /// Assign the value from the given instance.
+      /// </summary>
+      /// <param name="other">Other instance.</param>
+      /// <returns>Returns the instance itself.</returns>
+      Counted& operator = (const Counted& other) {
+        this->value = other.value;
+        return *this;
+      }
+    };
   public:
     /// <summary>
     /// Test the empty constructor.
@@ -23,8 +79,8 @@ namespace SPL::Tests {
       ArrayList<const float> list;
       // Check state.
       Assert::IsTrue(list.isEmpty());
-      Assert::AreEqual(0U, list.getLength());
-      Assert::AreEqual(0U, list.getCapacity());
+      Assert::AreEqual<Size>(0, list.getLength());
+      Assert::AreEqual<Size>(0, list.getCapacity());
     }
     /// <summary>
     /// Test the capacity constructor.
@@ -33,8 +89,8 @@ namespace SPL::Tests {
       ArrayList<const float> list(2);
       // Check state.
       Assert::IsTrue(list.isEmpty());
-      Assert::AreEqual(0U, list.getLength());
-      Assert::AreEqual(4U, list.getCapacity()); // <~ The minimum capacity is 4.
+      Assert::AreEqual<Size>(0, list.getLength());
+      Assert::AreEqual<Size>(4, list.getCapacity()); // <~ The minimum capacity is 4.
     }
     /// <summary>
     /// Test the initialized constructor.
@@ -43,8 +99,8 @@ namespace SPL::Tests {
       ArrayList<const float> list({ 1.5f, 2.5f, 3.5f });
       // Check state.
       Assert::IsFalse(list.isEmpty());
-      Assert::AreEqual(3U, list.getLength());
-      Assert::AreEqual(4U, list.getCapacity());
+      Assert::AreEqual<Size>(3, list.getLength());
+      Assert::AreEqual<Size>(4, list.getCapacity());
     }
     /// <summary>
     /// Test the copy constructor.
@@ -76,16 +132,16 @@ namespace SPL::Tests {
       ArrayList<const float> list(values), other(Move(list));
       // Check list state.
       Assert::IsTrue(list.isEmpty());
-      Assert::AreEqual(0U, list.getLength());
-      Assert::AreEqual(0U, list.getCapacity());
+      Assert::AreEqual<Size>(0, list.getLength());
+      Assert::AreEqual<Size>(0, list.getCapacity());
       // Check list values.
       for (const float value : values) {
         Assert::IsFalse(list.contains(value));
       }
       // Check other state.
       Assert::IsFalse(other.isEmpty());
-      Assert::AreEqual(3U, other.getLength());
-      Assert::AreEqual(4U, other.getCapacity());
+      Assert::AreEqual<Size>(3, other.getLength());
+      Assert::AreEqual<Size>(4, other.getCapacity());
       // Check other values.
       for (Index index = 0; index < (sizeof(values) / sizeof(float)); ++index) {
         Assert::AreEqual(values[index], other.get(index));
@@ -98,10 +154,10 @@ namespace SPL::Tests {
       Size instances = 0;
       // Create a new instance.
       List<Mock>* list = new ArrayList<Mock>({ Mock(instances), Mock(instances), Mock(instances) });
-      Assert::AreEqual(3U, instances);
+      Assert::AreEqual<Size>(3, instances);
       // Delete the instance.
       delete list;
-      Assert::AreEqual(0U, instances);
+      Assert::AreEqual<Size>(0, instances);
     }
     /// <summary>
     /// Test the add method.
@@ -119,8 +175,8 @@ namespace SPL::Tests {
       list.add(1, 2.0);
       // Check new state.
       Assert::IsFalse(list.isEmpty());
-      Assert::AreEqual(4U, list.getLength());
-      Assert::AreEqual(4U, list.getCapacity());
+      Assert::AreEqual<Size>(4, list.getLength());
+      Assert::AreEqual<Size>(4, list.getCapacity());
       // Check result values.
       const float result[] = { 1.5f, 2.0f, 2.5f, 3.5f };
       for (Index index = 0; index < (sizeof(result) / sizeof(float)); ++index) {
@@ -128,6 +184,164 @@ namespace SPL::Tests {
       }
     }
     /// <summary>
+    /// Test the emplace method.
+    /// </summary>
+    TEST_METHOD(MethodEmplace) {
+      ArrayList<Counted> list(16);
+      Counted::Copies = 0;
+      // Construct elements at the end.
+      for (int value = 0; value < 10; ++value) {
+        Assert::AreEqual(value, list.emplace(value).value);
+      }
+      Assert::AreEqual<Size>(10, list.getLength());
+      Assert::AreEqual<Size>(0, Counted::Copies);
+      // Construct elements at the given index.
+      Assert::AreEqual(20, list.emplaceAt(0, 20).value);
+      Assert::AreEqual(30, list.emplaceAt(5, 30).value);
+      Assert::AreEqual(40, list.emplaceAt(12, 40).value);
+      Assert::ExpectException<SPL::Exceptions::IndexOutOfBounds>([&list] {
+        list.emplaceAt(14, 50);
+      });
+      // Check values.
+      const int result[] = { 20, 0, 1, 2, 3, 30, 4, 5, 6, 7, 8, 9, 40 };
+      Assert::AreEqual<Size>(13, list.getLength());
+      for (Index index = 0; index < (sizeof(result) / sizeof(int)); ++index) {
+        Assert::AreEqual(result[index], list[index].value);
+      }
+    }
+    /// <summary>
+    /// Test the add and emplace methods with elements from the list itself.
+    /// </summary>
+    TEST_METHOD(MethodAddSelf) {
+      ArrayList<int> list({ 1, 2, 3, 4 });
+      Assert::AreEqual<Size>(4, list.getCapacity());
+      // Add elements from the list itself.
+      list.add(0, list[3]);
+      list.add(list[0]);
+      list.add(1, list[5]);
+      // Check values.
+      const int result[] = { 4, 4, 1, 2, 3, 4, 4 };
+      Assert::AreEqual<Size>(7, list.getLength());
+      for (Index index = 0; index < (sizeof(result) / sizeof(int)); ++index) {
+        Assert::AreEqual(result[index], list[index]);
+      }
+      ArrayList<Counted> other(4);
+      for (int value = 1; value <= 4; ++value) {
+        other.emplace(value);
+      }
+      // Add elements from the list itself.
+      other.add(other[0]);
+      other.emplaceAt(0, other[4]);
+      other.emplaceAt(1, other[3]);
+      // Check values.
+      const int values[] = { 1, 3, 1, 2, 3, 4, 1 };
+      Assert::AreEqual<Size>(7, other.getLength());
+      for (Index index = 0; index < (sizeof(values) / sizeof(int)); ++index) {
+        Assert::AreEqual(values[index], other[index].value);
+      }
+    }
+    /// <summary>
+    /// Test the addAll method.
+    /// </summary>
+    TEST_METHOD(MethodAddAll) {
+      ArrayList<const float> list({ 1.5f, 2.5f, 3.5f });
+      // Add undefined index.
+      Assert::ExpectException<SPL::Exceptions::IndexOutOfBounds>([&list] {
+        list.addAll(4, { 4.5f });
+      });
+      // Add values.
+      Assert::AreEqual<Size>(6, list.addAll(1, { 4.5f, 5.5f, 6.5f }));
+      Assert::AreEqual<Size>(8, list.addAll(6, { 7.5f, 8.5f }));
+      Assert::AreEqual<Size>(8, list.getCapacity());
+      // Check values.
+      const float result[] = { 1.5f, 4.5f, 5.5f, 6.5f, 2.5f, 3.5f, 7.5f, 8.5f };
+      for (Index index = 0; index < (sizeof(result) / sizeof(float)); ++index) {
+        Assert::AreEqual(result[index], list[index]);
+      }
+    }
+    /// <summary>
+    /// Test the addAll method (for non-trivial elements).
+    /// </summary>
+    TEST_METHOD(MethodAddAllComplex) {
+      ArrayList<Counted> list(16);
+      list.emplace(1);
+      list.emplace(2);
+      list.emplace(3);
+      // Add values.
+      const Counted values[] = { Counted(4), Counted(5), Counted(6), Counted(7) };
+      Assert::AreEqual<Size>(7, list.addAll(1, values));
+      Assert::AreEqual<Size>(11, list.addAll(6, values, 4));
+      // Check values.
+      const int result[] = { 1, 4, 5, 6, 7, 2, 4, 5, 6, 7, 3 };
+      for (Index index = 0; index < (sizeof(result) / sizeof(int)); ++index) {
+        Assert::AreEqual(result[index], list[index].value);
+      }
+      list.clear();
+      Assert::AreEqual<Size>(4, Counted::Instances);
+    }
+    /// <summary>
+    /// Test the addAll and append methods with elements from the list itself.
+    /// </summary>
+    TEST_METHOD(MethodAddAllSelf) {
+      ArrayList<int> list({ 1, 2, 3, 4 });
+      Assert::AreEqual<Size>(4, list.getCapacity());
+      // Insert and append elements from the list itself.
+      Assert::AreEqual<Size>(8, list.addAll(1, &list[0], 4));
+      Assert::AreEqual<Size>(10, list.append(&list[6], 2));
+      // Check values.
+      const int result[] = { 1, 1, 2, 3, 4, 2, 3, 4, 3, 4 };
+      for (Index index = 0; index < (sizeof(result) / sizeof(int)); ++index) {
+        Assert::AreEqual(result[index], list[index]);
+      }
+      ArrayList<Counted> other(16);
+      for (int value = 1; value <= 4; ++value) {
+        other.emplace(value);
+      }
+      // Insert elements from the list itself without enlarging.
+      Assert::AreEqual<Size>(7, other.addAll(0, &other[1], 3));
+      // Check values.
+      const int values[] = { 2, 3, 4, 1, 2, 3, 4 };
+      for (Index index = 0; index < (sizeof(values) / sizeof(int)); ++index) {
+        Assert::AreEqual(values[index], other[index].value);
+      }
+    }
+    /// <summary>
+    /// Test the append method.
+    /// </summary>
+    TEST_METHOD(MethodAppend) {
+      ArrayList<const float> list({ 1.5f, 2.5f });
+      ArrayList<const float> other({ 3.5f, 4.5f, 5.5f });
+      // Append values.
+      Assert::AreEqual<Size>(5, list.append(other));
+      Assert::AreEqual<Size>(6, list.append({ 6.5f }));
+      Assert::AreEqual<Size>(12, list.append(list));
+      Assert::AreEqual<Size>(16, list.getCapacity());
+      // Check values.
+      const float result[] = { 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f };
+      for (Index index = 0; index < (sizeof(result) / sizeof(float)); ++index) {
+        Assert::AreEqual(result[index], list[index]);
+      }
+    }
+    /// <summary>
+    /// Test the bulk methods with spans.
+    /// </summary>
+    TEST_METHOD(MethodSpan) {
+      ArrayList<const float> list({ 1.5f, 2.5f, 3.5f });
+      const float values[] = { 4.5f, 5.5f };
+      // Add values.
+      Assert::AreEqual<Size>(5, list.append(ConstArraySpan<float>(values)));
+      Assert::AreEqual<Size>(7, list.addAll(0, list.view(3)));
+      auto other = list.concat(list.view(0, 1));
+      // Check values.
+      const float result[] = { 4.5f, 5.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f };
+      for (Index index = 0; index < (sizeof(result) / sizeof(float)); ++index) {
+        Assert::AreEqual(result[index], list[index]);
+        Assert::AreEqual(result[index], other->get(index));
+      }
+      Assert::AreEqual<Size>(8, other->getLength());
+      Assert::AreEqual(4.5f, other->get(7));
+    }
+    /// <summary>
     /// Test the concat method.
     /// </summary>
     TEST_METHOD(MethodConcat) {
@@ -160,8 +374,8 @@ namespace SPL::Tests {
       Assert::AreEqual(values[2], list.set(2, value));
       // Check new state.
       Assert::IsFalse(list.isEmpty());
-      Assert::AreEqual(3U, list.getLength());
-      Assert::AreEqual(4U, list.getCapacity());
+      Assert::AreEqual<Size>(3, list.getLength());
+      Assert::AreEqual<Size>(4, list.getCapacity());
       // Check values.
       for (Index index = 0; index < (sizeof(values) / sizeof(float)); ++index) {
         Assert::AreEqual(values[index] + 0.5f, list.get(index));
@@ -218,12 +432,12 @@ namespace SPL::Tests {
       Assert::AreEqual<Size>(-1, list.indexOf(2.5f, list.getLength() - 1));
       Assert::AreEqual<Size>(-1, list.indexOf(0.0f));
       // Check values.
-      Assert::AreEqual(0U, list.indexOf(1.5f));
-      Assert::AreEqual(1U, list.indexOf(2.5f));
-      Assert::AreEqual(2U, list.indexOf(3.5f));
-      Assert::AreEqual(3U, list.indexOf(1.5f, 1));
-      Assert::AreEqual(4U, list.indexOf(2.5f, 2));
-      Assert::AreEqual(5U, list.indexOf(3.5f, 3));
+      Assert::AreEqual<Size>(0, list.indexOf(1.5f));
+      Assert::AreEqual<Size>(1, list.indexOf(2.5f));
+      Assert::AreEqual<Size>(2, list.indexOf(3.5f));
+      Assert::AreEqual<Size>(3, list.indexOf(1.5f, 1));
+      Assert::AreEqual<Size>(4, list.indexOf(2.5f, 2));
+      Assert::AreEqual<Size>(5, list.indexOf(3.5f, 3));
     }
     /// <summary>
     /// Test the lastIndexOf method.
@@ -235,12 +449,12 @@ namespace SPL::Tests {
       Assert::AreEqual<Size>(-1, list.lastIndexOf(2.5f, 0));
       Assert::AreEqual<Size>(-1, list.lastIndexOf(0.0f));
       // Check values.
-      Assert::AreEqual(0U, list.lastIndexOf(1.5f, 2));
-      Assert::AreEqual(1U, list.lastIndexOf(2.5f, 3));
-      Assert::AreEqual(2U, list.lastIndexOf(3.5f, 4));
-      Assert::AreEqual(3U, list.lastIndexOf(1.5f));
-      Assert::AreEqual(4U, list.lastIndexOf(2.5f));
-      Assert::AreEqual(5U, list.lastIndexOf(3.5f));
+      Assert::AreEqual<Size>(0, list.lastIndexOf(1.5f, 2));
+      Assert::AreEqual<Size>(1, list.lastIndexOf(2.5f, 3));
+      Assert::AreEqual<Size>(2, list.lastIndexOf(3.5f, 4));
+      Assert::AreEqual<Size>(3, list.lastIndexOf(1.5f));
+      Assert::AreEqual<Size>(4, list.lastIndexOf(2.5f));
+      Assert::AreEqual<Size>(5, list.lastIndexOf(3.5f));
     }
     /// <summary>
     /// Test the contains method.
@@ -266,20 +480,20 @@ namespace SPL::Tests {
       });
       // Remove the second value.
       Assert::AreEqual(2.5f, list.remove(1));
-      Assert::AreEqual(2U, list.getLength());
-      Assert::AreEqual(4U, list.getCapacity());
+      Assert::AreEqual<Size>(2, list.getLength());
+      Assert::AreEqual<Size>(4, list.getCapacity());
       Assert::IsFalse(list.isEmpty());
       Assert::IsFalse(list.contains(2.5f));
       // Remove the third value.
       Assert::AreEqual(3.5f, list.remove(1));
-      Assert::AreEqual(1U, list.getLength());
-      Assert::AreEqual(4U, list.getCapacity());
+      Assert::AreEqual<Size>(1, list.getLength());
+      Assert::AreEqual<Size>(4, list.getCapacity());
       Assert::IsFalse(list.isEmpty());
       Assert::IsFalse(list.contains(3.5f));
       // Remove first value.
       Assert::AreEqual(1.5f, list.remove(0));
-      Assert::AreEqual(0U, list.getLength());
-      Assert::AreEqual(4U, list.getCapacity());
+      Assert::AreEqual<Size>(0, list.getLength());
+      Assert::AreEqual<Size>(4, list.getCapacity());
       Assert::IsTrue(list.isEmpty());
       Assert::IsFalse(list.contains(1.5f));
     }
@@ -295,8 +509,8 @@ namespace SPL::Tests {
       Assert::IsTrue(list.remove(1, value));
       Assert::AreEqual(2.5f, value);
       Assert::IsFalse(list.isEmpty());
-      Assert::AreEqual(2U, list.getLength());
-      Assert::AreEqual(4U, list.getCapacity());
+      Assert::AreEqual<Size>(2, list.getLength());
+      Assert::AreEqual<Size>(4, list.getCapacity());
       Assert::IsTrue(list.contains(1.5f));
       Assert::IsFalse(list.contains(2.5f));
       Assert::IsTrue(list.contains(3.5f));
@@ -304,8 +518,8 @@ namespace SPL::Tests {
       Assert::IsTrue(list.remove(1, value));
       Assert::AreEqual(3.5f, value);
       Assert::IsFalse(list.isEmpty());
-      Assert::AreEqual(1U, list.getLength());
-      Assert::AreEqual(4U, list.getCapacity());
+      Assert::AreEqual<Size>(1, list.getLength());
+      Assert::AreEqual<Size>(4, list.getCapacity());
       Assert::IsTrue(list.contains(1.5f));
       Assert::IsFalse(list.contains(2.5f));
       Assert::IsFalse(list.contains(3.5f));
@@ -313,8 +527,8 @@ namespace SPL::Tests {
       Assert::IsTrue(list.remove(0, value));
       Assert::AreEqual(1.5f, value);
       Assert::IsTrue(list.isEmpty());
-      Assert::AreEqual(0U, list.getLength());
-      Assert::AreEqual(4U, list.getCapacity());
+      Assert::AreEqual<Size>(0, list.getLength());
+      Assert::AreEqual<Size>(4, list.getCapacity());
       Assert::IsFalse(list.contains(1.5f));
       Assert::IsFalse(list.contains(2.5f));
       Assert::IsFalse(list.contains(3.5f));
@@ -331,26 +545,80 @@ namespace SPL::Tests {
       // Remove the second value.
       value = 2.5f;
       Assert::IsTrue(list.remove(value));
-      Assert::AreEqual(2U, list.getLength());
-      Assert::AreEqual(4U, list.getCapacity());
+      Assert::AreEqual<Size>(2, list.getLength());
+      Assert::AreEqual<Size>(4, list.getCapacity());
       Assert::IsFalse(list.isEmpty());
       Assert::IsFalse(list.contains(2.5f));
       // Remove the third value.
       value = 3.5f;
       Assert::IsTrue(list.remove(value));
-      Assert::AreEqual(1U, list.getLength());
-      Assert::AreEqual(4U, list.getCapacity());
+      Assert::AreEqual<Size>(1, list.getLength());
+      Assert::AreEqual<Size>(4, list.getCapacity());
       Assert::IsFalse(list.isEmpty());
       Assert::IsFalse(list.contains(3.5f));
       // Remove the first value.
       value = 1.5f;
       Assert::IsTrue(list.remove(value));
-      Assert::AreEqual(0U, list.getLength());
-      Assert::AreEqual(4U, list.getCapacity());
+      Assert::AreEqual<Size>(0, list.getLength());
+      Assert::AreEqual<Size>(4, list.getCapacity());
       Assert::IsTrue(list.isEmpty());
       Assert::IsFalse(list.contains(1.5f));
     }
     /// <summary>
+    /// Test the count method.
+    /// </summary>
+    TEST_METHOD(MethodCount) {
+      ArrayList<const int> list({ 1, 2, 3, 2, 1, 2, 3, 2, 1, 2, 3, 2, 1, 2, 3, 2, 1, 2, 3, 2 });
+      // Check occurrences.
+      Assert::AreEqual<Size>(5, list.count(1));
+      Assert::AreEqual<Size>(10, list.count(2));
+      Assert::AreEqual<Size>(5, list.count(3));
+      Assert::AreEqual<Size>(0, list.count(4));
+      Assert::AreEqual<Size>(17, list.indexOf(2, 16));
+      Assert::AreEqual<Size>(15, list.lastIndexOf(2, 17));
+    }
+    /// <summary>
+    /// Test the removeRange method.
+    /// </summary>
+    TEST_METHOD(MethodRemoveRange) {
+      ArrayList<const float> list({ 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f, 8.5f, 9.5f });
+      // Remove undefined range.
+      Assert::ExpectException<SPL::Exceptions::IndexOutOfBounds>([&list] {
+        list.removeRange(9);
+      });
+      Assert::ExpectException<SPL::Exceptions::IndexOutOfBounds>([&list] {
+        list.removeRange(3, 2);
+      });
+      // Remove values.
+      Assert::AreEqual<Size>(6, list.removeRange(1, 4));
+      Assert::AreEqual<Size>(16, list.getCapacity());
+      Assert::AreEqual<Size>(3, list.removeRange(3));
+      Assert::AreEqual<Size>(8, list.getCapacity());
+      // Check values.
+      const float result[] = { 1.5f, 5.5f, 6.5f };
+      Assert::AreEqual<Size>(3, list.getLength());
+      for (Index index = 0; index < (sizeof(result) / sizeof(float)); ++index) {
+        Assert::AreEqual(result[index], list[index]);
+      }
+    }
+    /// <summary>
+    /// Test the removeRange method (for non-trivial elements).
+    /// </summary>
+    TEST_METHOD(MethodRemoveRangeComplex) {
+      ArrayList<Counted> list(16);
+      for (int value = 0; value < 10; ++value) {
+        list.emplace(value);
+      }
+      // Remove values.
+      Assert::AreEqual<Size>(5, list.removeRange(2, 7));
+      Assert::AreEqual<Size>(5, Counted::Instances);
+      // Check values.
+      const int result[] = { 0, 1, 7, 8, 9 };
+      for (Index index = 0; index < (sizeof(result) / sizeof(int)); ++index) {
+        Assert::AreEqual(result[index], list[index].value);
+      }
+    }
+    /// <summary>
     /// Test the slice method.
     /// </summary>
     TEST_METHOD(MethodSlice) {
@@ -361,19 +629,53 @@ namespace SPL::Tests {
       });
       // Check first part.
       auto part1 = list.slice(0, 1);
-      Assert::AreEqual(1U, part1->getLength());
+      Assert::AreEqual<Size>(1, part1->getLength());
       Assert::AreEqual(part1->get(0), list[0]);
       // Check second part.
       auto part2 = list.slice(1);
-      Assert::AreEqual(2U, part2->getLength());
+      Assert::AreEqual<Size>(2, part2->getLength());
       Assert::AreEqual(part2->get(0), list[1]);
       Assert::AreEqual(part2->get(1), list[2]);
       // Check third part.
       auto part3 = list.slice(2);
-      Assert::AreEqual(1U, part3->getLength());
+      Assert::AreEqual<Size>(1, part3->getLength());
       Assert::AreEqual(part3->get(0), list[2]);
     }
     /// <summary>
+    /// Test the binary search methods.
+    /// </summary>
+    TEST_METHOD(MethodBinarySearch) {
+      ArrayList<const float> list({ 0.5f, 1.5f, 1.5f, 1.5f, 2.5f, 4.5f });
+      // Check state.
+      Assert::AreEqual<Size>(4, list.binarySearch(2.5f));
+      Assert::AreEqual(static_cast<Index>(-1), list.binarySearch(3.5f));
+      Assert::AreEqual<Size>(1, list.lowerBound(1.5f));
+      Assert::AreEqual<Size>(4, list.upperBound(1.5f));
+      Assert::AreEqual<Size>(6, list.lowerBound(5.5f));
+      const auto range = list.equalRange(1.5f);
+      Assert::AreEqual<Size>(1, range.key);
+      Assert::AreEqual<Size>(4, range.value);
+    }
+    /// <summary>
+    /// Test the view method.
+    /// </summary>
+    TEST_METHOD(MethodView) {
+      ArrayList<int> list({ 1, 2, 3, 4, 5 });
+      const auto& constant = list;
+      // Change values.
+      auto span = list.view(1, 3);
+      span[0] = 20;
+      // Check state.
+      Assert::AreEqual<Size>(2, span.getLength());
+      Assert::AreEqual(20, list[1]);
+      Assert::AreEqual<Size>(5, constant.view().getLength());
+      Assert::AreEqual<Size>(1, constant.view(2).indexOf(4));
+      Assert::IsTrue(list.view(5).isEmpty());
+      Assert::ExpectException<SPL::Exceptions::IndexOutOfBounds>([&list] {
+        list.view(6);
+      });
+    }
+    /// <summary>
     /// Test the sort method.
     /// </summary>
     TEST_METHOD(MethodSort) {
@@ -388,6 +690,66 @@ namespace SPL::Tests {
       }
     }
     /// <summary>
+    /// Test the sort method (radix).
+    /// </summary>
+    TEST_METHOD(MethodSortRadix) {
+      ArrayList<int> list;
+      for (int value = 0; value < 2000; ++value) {
+        list.add(((value * 7919) % 2000) - 1000);
+      }
+      // Sort data.
+      list.sort();
+      // Check values.
+      for (Index index = 0; index < 2000; ++index) {
+        Assert::AreEqual(static_cast<int>(index) - 1000, list[index]);
+      }
+    }
+    /// <summary>
+    /// Test the sort method with a comparator.
+    /// </summary>
+    TEST_METHOD(MethodSortComparator) {
+      ArrayList<const float> list({ 3.5f, 1.5f, 4.5f, 0.5f, 2.5f });
+      // Sort data.
+      list.sort([](const float& source, const float& target) { return Compare(target, source); });
+      // Check values.
+      const float result[] = { 4.5f, 3.5f, 2.5f, 1.5f, 0.5f };
+      for (Index index = 0; index < (sizeof(result) / sizeof(float)); ++index) {
+        Assert::AreEqual(result[index], list[index]);
+      }
+    }
+    /// <summary>
+    /// Test the stable sort method.
+    /// </summary>
+    TEST_METHOD(MethodStableSort) {
+      ArrayList<int> list({ 21, 10, 32, 11, 20, 30, 12 });
+      // Sort data by the tens.
+      list.stableSort([](const int& source, const int& target) { return Compare(source / 10, target / 10); });
+      // Check values.
+      const int result[] = { 10, 11, 12, 21, 20, 32, 30 };
+      for (Index index = 0; index < (sizeof(result) / sizeof(int)); ++index) {
+        Assert::AreEqual(result[index], list[index]);
+      }
+      // Sort data.
+      list.stableSort();
+      Assert::AreEqual(10, list[0]);
+      Assert::AreEqual(32, list[6]);
+    }
+    /// <summary>
+    /// Test the parallel sort method.
+    /// </summary>
+    TEST_METHOD(MethodParallelSort) {
+      ArrayList<int> list;
+      for (int value = 0; value < 100000; ++value) {
+        list.add((value * 7919) % 100000);
+      }
+      // Sort data.
+      list.parallelSort(4);
+      // Check values.
+      for (Index index = 0; index < 100000; ++index) {
+        Assert::AreEqual(static_cast<int>(index), list[index]);
+      }
+    }
+    /// <summary>
     /// Test the reverse method.
     /// </summary>
     TEST_METHOD(MethodReverse) {
@@ -411,14 +773,27 @@ namespace SPL::Tests {
       list.clear();
       // Check new state.
       Assert::IsTrue(list.isEmpty());
-      Assert::AreEqual(0U, list.getLength());
-      Assert::AreEqual(4U, list.getCapacity());
+      Assert::AreEqual<Size>(0, list.getLength());
+      Assert::AreEqual<Size>(4, list.getCapacity());
       // Check values.
       for (const float& value : values) {
         Assert::IsFalse(list.contains(value));
       }
     }
     /// <summary>
+    /// Test the clear method (destroying elements).
+    /// </summary>
+    TEST_METHOD(MethodClearDestroy) {
+      Size instances = 0;
+      ArrayList<Mock> list({ Mock(instances), Mock(instances), Mock(instances) });
+      Assert::AreEqual<Size>(3, instances);
+      // Clear data.
+      list.clear();
+      // Check new state.
+      Assert::AreEqual<Size>(0, instances);
+      Assert::AreEqual<Size>(4, list.getCapacity());
+    }
+    /// <summary>
     /// Test the copy assignment operator.
     /// </summary>
     TEST_METHOD(OperatorCopy) {
@@ -452,16 +827,16 @@ namespace SPL::Tests {
       other = Move(list);
       // Check list state.
       Assert::IsTrue(list.isEmpty());
-      Assert::AreEqual(0U, list.getLength());
-      Assert::AreEqual(0U, list.getCapacity());
+      Assert::AreEqual<Size>(0, list.getLength());
+      Assert::AreEqual<Size>(0, list.getCapacity());
       // Check list values.
       for (const float& value : values) {
         Assert::IsFalse(list.contains(value));
       }
       // Check other state.
       Assert::IsFalse(other.isEmpty());
-      Assert::AreEqual(3U, other.getLength());
-      Assert::AreEqual(4U, other.getCapacity());
+      Assert::AreEqual<Size>(3, other.getLength());
+      Assert::AreEqual<Size>(4, other.getCapacity());
       // Check other values.
       for (Index index = 0; index < (sizeof(values) / sizeof(float)); ++index) {
         Assert::AreEqual(values[index], other.get(index));
@@ -490,14 +865,14 @@ namespace SPL::Tests {
       ArrayList<const float> list({ 1.5f, 2.5f, 3.5f, 4.5f });
       // Check state.
       Assert::IsFalse(list.isEmpty());
-      Assert::AreEqual(4U, list.getLength());
-      Assert::AreEqual(4U, list.getCapacity());
+      Assert::AreEqual<Size>(4, list.getLength());
+      Assert::AreEqual<Size>(4, list.getCapacity());
       // Check enlargement.
       list.add(5.5f);
       // Check new state.
       Assert::IsFalse(list.isEmpty());
-      Assert::AreEqual(5U, list.getLength());
-      Assert::AreEqual(8U, list.getCapacity());
+      Assert::AreEqual<Size>(5, list.getLength());
+      Assert::AreEqual<Size>(8, list.getCapacity());
       // Check values.
       const float result[] = { 1.5f, 2.5f, 3.5f, 4.5f, 5.5f };
       for (Index index = 0; index < (sizeof(result) / sizeof(float)); ++index) {
@@ -511,21 +886,58 @@ namespace SPL::Tests {
       ArrayList<const float> list({ 1.5f, 2.5f, 3.5f, 4.5f, 5.5f });
       // Check state.
       Assert::IsFalse(list.isEmpty());
-      Assert::AreEqual(5U, list.getLength());
-      Assert::AreEqual(8U, list.getCapacity());
+      Assert::AreEqual<Size>(5, list.getLength());
+      Assert::AreEqual<Size>(8, list.getCapacity());
       // Check shrinkage.
       list.remove(0);
       list.remove(1);
       list.remove(2);
       // Check new state.
       Assert::IsFalse(list.isEmpty());
-      Assert::AreEqual(2U, list.getLength());
-      Assert::AreEqual(4U, list.getCapacity());
+      Assert::AreEqual<Size>(2, list.getLength());
+      Assert::AreEqual<Size>(4, list.getCapacity());
       // Check values.
       const float result[] = { 2.5f, 4.5f };
       for (Index index = 0; index < (sizeof(result) / sizeof(float)); ++index) {
         Assert::AreEqual(result[index], list[index]);
       }
     }
+    /// <summary>
+    /// Test the uninitialized capacity feature.
+    /// </summary>
+    TEST_METHOD(FeatureUninitialized) {
+      ArrayList<Counted> list(1000);
+      // Check the reserved capacity.
+      Assert::AreEqual<Size>(1024, list.getCapacity());
+      Assert::AreEqual<Size>(0, Counted::Instances);
+      // Add, enlarge and remove elements.
+      for (int value = 0; value < 2000; ++value) {
+        list.add(Counted(value));
+      }
+      Assert::AreEqual<Size>(2000, Counted::Instances);
+      Assert::AreEqual(10, list.remove(10).value);
+      Assert::AreEqual<Size>(1999, Counted::Instances);
+      Assert::AreEqual(11, list[10].value);
+      // Clear data.
+      list.clear();
+      Assert::AreEqual<Size>(0, Counted::Instances);
+    }
+    /// <summary>
+    /// Test the range-based loop.
+    /// </summary>
+    TEST_METHOD(FeatureRangeFor) {
+      const float values[] = { 1.5f, 2.5f, 3.5f };
+      ArrayList<float> list(values);
+      // Change values.
+      for (auto& value : list) {
+        value *= 2.0f;
+      }
+      // Check values.
+      Index index = 0;
+      for (const auto& value : static_cast<const ArrayList<float>&>(list)) {
+        Assert::AreEqual(values[index++] * 2.0f, value);
+      }
+      Assert::AreEqual<Size>(3, index);
+    }
   };
 }
@@ -0,0 +1,148 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#include "../mock.hpp"
+#include "CppUnitTest.h"
+#include "interfaces.hpp"
+#include "arrays.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace SPL::Tests;
+
+namespace SPL::Tests {
+  /// <summary>
+  /// Test class.
+  /// </summary>
+  TEST_CLASS(ArraySpanTests)
+  {
+  public:
+    /// <summary>
+    /// Test the empty constructor.
+    /// </summary>
+    TEST_METHOD(ConstructEmpty) {
+      ArraySpan<int> span;
+      // Check state.
+      Assert::IsTrue(span.isEmpty());
+      Assert::AreEqual<Size>(0, span.getLength());
+      Assert::IsTrue(span.getData() == nullptr);
+    }
+    /// <summary>
+    /// Test the initialized constructor.
+    /// </summary>
+    TEST_METHOD(ConstructElements) {
+      float values[] = { 1.5f, 2.5f, 3.5f };
+      ArraySpan<float> span(values);
+      ConstArraySpan<float> other(values, 2);
+      // Change values.
+      span[0] = 10.5f;
+      // Check state.
+      Assert::AreEqual<Size>(3, span.getLength());
+      Assert::AreEqual<Size>(2, other.getLength());
+      Assert::AreEqual(10.5f, other[0]);
+      Assert::IsTrue(values == span.getData());
+    }
+    /// <summary>
+    /// Test the view method.
+    /// </summary>
+    TEST_METHOD(MethodView) {
+      const int values[] = { 1, 2, 3, 4, 5 };
+      ConstArraySpan<int> span(values);
+      // Check views.
+      auto middle = span.view(1, 4);
+      Assert::AreEqual<Size>(3, middle.getLength());
+      Assert::AreEqual(2, middle[0]);
+      Assert::AreEqual(4, middle[2]);
+      Assert::AreEqual<Size>(2, span.view(3).getLength());
+      Assert::IsTrue(span.view(5).isEmpty());
+      Assert::ExpectException<SPL::Exceptions::IndexOutOfBounds>([&span] {
+        span.view(6);
+      });
+      Assert::ExpectException<SPL::Exceptions::IndexOutOfBounds>([&span] {
+        span.view(3, 2);
+      });
+    }
+    /// <summary>
+    /// Test the search methods.
+    /// </summary>
+    TEST_METHOD(MethodSearch) {
+      const int values[] = { 1, 3, 3, 5, 7, 3 };
+      ConstArraySpan<int> span(values);
+      // Check state.
+      Assert::AreEqual<Size>(1, span.indexOf(3));
+      Assert::AreEqual<Size>(2, span.indexOf(3, 2));
+      Assert::AreEqual<Size>(5, span.lastIndexOf(3));
+      Assert::AreEqual<Size>(3, span.count(3));
+      Assert::IsTrue(span.contains(7));
+      Assert::IsFalse(span.contains(8));
+      // Check the sorted portion.
+      auto sorted = span.view(0, 5);
+      Assert::AreEqual<Size>(3, sorted.binarySearch(5));
+      Assert::AreEqual<Size>(1, sorted.lowerBound(3));
+      Assert::AreEqual<Size>(3, sorted.upperBound(3));
+      const auto range = sorted.equalRange(3);
+      Assert::AreEqual<Size>(1, range.key);
+      Assert::AreEqual<Size>(3, range.value);
+    }
+    /// <summary>
+    /// Test the compare method.
+    /// </summary>
+    TEST_METHOD(MethodCompare) {
+      int values[] = { 1, 2, 3 };
+      const int others[] = { 1, 2, 4 };
+      ArraySpan<int> span(values);
+      ConstArraySpan<int> other(others);
+      // Check state.
+      Assert::AreEqual(-1, span.compare(other));
+      Assert::AreEqual(1, other.compare(span));
+      Assert::AreEqual(0, span.view(0, 2).compare(other.view(0, 2)));
+      Assert::AreEqual(-1, span.view(0, 2).compare(span));
+      Assert::AreEqual(0, ArraySpan<int>().compare(span.view(3)));
+      Assert::IsTrue(span.view(1) == span.view(1));
+    }
+    /// <summary>
+    /// Test the iterator.
+    /// </summary>
+    TEST_METHOD(FeatureIterator) {
+      const int values[] = { 1, 2, 3 };
+      ConstArraySpan<int> span(values);
+      auto iterator = span.getIterator();
+      // Check values.
+      int expected = 1;
+      while (iterator->hasNext()) {
+        Assert::AreEqual(expected++, iterator->next());
+      }
+      Assert::AreEqual(4, expected);
+      Assert::ExpectException<SPL::Exceptions::InvalidOperation>([&iterator] {
+        iterator->next();
+      });
+    }
+    /// <summary>
+    /// Test the access operator.
+    /// </summary>
+    TEST_METHOD(OperatorAccess) {
+      const int values[] = { 1, 2, 3 };
+      ConstArraySpan<int> span(values);
+      // Check state.
+      Assert::AreEqual(3, span[2]);
+      Assert::ExpectException<SPL::Exceptions::IndexOutOfBounds>([&span] {
+        span[3];
+      });
+    }
+    /// <summary>
+    /// Test the range-based loop.
+    /// </summary>
+    TEST_METHOD(FeatureRangeFor) {
+      const int values[] = { 1, 2, 3 };
+      ConstArraySpan<int> span(values);
+      // Check values.
+      int expected = 1;
+      for (const auto& value : span) {
+        Assert::AreEqual(expected++, value);
+      }
+      Assert::AreEqual(4, expected);
+      for (const auto& value : ConstArraySpan<int>()) {
+        Assert::Fail();
+      }
+    }
+  };
+}
@@ -0,0 +1,158 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#include "CppUnitTest.h"
+#include "arrays.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace SPL::Tests {
+  /// <summary>
+  /// Test class.
+  /// </summary>
+  TEST_CLASS(BitArrayTests)
+  {
+  public:
+    /// <summary>
+    /// Test the empty constructor.
+    /// </summary>
+    TEST_METHOD(ConstructEmpty) {
+      BitArray array;
+      // Check state.
+      Assert::IsTrue(array.isEmpty());
+      Assert::AreEqual<Size>(0, array.getLength());
+      Assert::AreEqual<Size>(0, array.count());
+      Assert::AreEqual<Size>(-1, array.findFirst());
+    }
+    /// <summary>
+    /// Test the initialized constructor for length.
+    /// </summary>
+    TEST_METHOD(ConstructLength) {
+      BitArray array(100, true);
+      // Check state.
+      Assert::AreEqual<Size>(100, array.getLength());
+      Assert::AreEqual<Size>(100, array.count());
+      Assert::IsTrue(array.all());
+      Assert::AreEqual(0xFFFFFFFFFULL, array.getData()[1]);
+    }
+    /// <summary>
+    /// Test the copy constructor.
+    /// </summary>
+    TEST_METHOD(ConstructCopy) {
+      BitArray array(70);
+      array.set(69);
+      BitArray other(array);
+      // Change values.
+      array.reset(69);
+      // Check state.
+      Assert::AreEqual<Size>(70, other.getLength());
+      Assert::IsTrue(other[69]);
+      Assert::IsFalse(array[69]);
+    }
+    /// <summary>
+    /// Test the move constructor.
+    /// </summary>
+    TEST_METHOD(ConstructMove) {
+      BitArray array(70, true);
+      BitArray other(Move(array));
+      // Check state.
+      Assert::IsTrue(array.isEmpty());
+      Assert::AreEqual<Size>(70, other.count());
+    }
+    /// <summary>
+    /// Test the methods set, reset and flip.
+    /// </summary>
+    TEST_METHOD(MethodSet) {
+      BitArray array(130);
+      array.set(0);
+      array.set(64);
+      array.set(129);
+      array.reset(64);
+      array.flip(1);
+      // Check state.
+      Assert::IsTrue(array.get(0));
+      Assert::IsTrue(array.get(1));
+      Assert::IsFalse(array.get(64));
+      Assert::IsTrue(array.get(129));
+      Assert::AreEqual<Size>(3, array.count());
+      Assert::ExpectException<SPL::Exceptions::IndexOutOfBounds>([&array] { array.set(130); });
+      Assert::ExpectException<SPL::Exceptions::IndexOutOfBounds>([&array] { array.get(130); });
+    }
+    /// <summary>
+    /// Test the methods flip and fill for all the bits.
+    /// </summary>
+    TEST_METHOD(MethodFill) {
+      BitArray array(70);
+      array.set(3);
+      array.flip();
+      // Check state.
+      Assert::AreEqual<Size>(69, array.count());
+      Assert::IsFalse(array[3]);
+      array.fill(false);
+      Assert::IsFalse(array.any());
+      array.fill(true);
+      Assert::AreEqual<Size>(70, array.count());
+    }
+    /// <summary>
+    /// Test the methods add and resize.
+    /// </summary>
+    TEST_METHOD(MethodResize) {
+      BitArray array;
+      for (Size index = 0; index < 100; ++index) {
+        array.add(index % 3 == 0);
+      }
+      // Check state.
+      Assert::AreEqual<Size>(100, array.getLength());
+      Assert::AreEqual<Size>(34, array.count());
+      // Shrink the array (the discarded bits are cleared).
+      array.resize(10);
+      Assert::AreEqual<Size>(4, array.count());
+      // Grow the array with set bits.
+      array.resize(200, true);
+      Assert::AreEqual<Size>(194, array.count());
+      Assert::IsFalse(array[8]);
+      Assert::IsTrue(array[10]);
+      Assert::IsTrue(array[199]);
+    }
+    /// <summary>
+    /// Test the methods rank, findFirst and findNext.
+    /// </summary>
+    TEST_METHOD(MethodFind) {
+      BitArray array(300);
+      array.set(5);
+      array.set(63);
+      array.set(64);
+      array.set(250);
+      // Check state.
+      Assert::AreEqual<Size>(0, array.rank(5));
+      Assert::AreEqual<Size>(1, array.rank(6));
+      Assert::AreEqual<Size>(3, array.rank(128));
+      Assert::AreEqual<Size>(4, array.rank(300));
+      Assert::AreEqual<Size>(5, array.findFirst());
+      Assert::AreEqual<Size>(63, array.findNext(5));
+      Assert::AreEqual<Size>(64, array.findNext(63));
+      Assert::AreEqual<Size>(250, array.findNext(64));
+      Assert::AreEqual<Size>(-1, array.findNext(250));
+      Assert::ExpectException<SPL::Exceptions::IndexOutOfBounds>([&array] { array.rank(301); });
+    }
+    /// <summary>
+    /// Test the logical operations.
+    /// </summary>
+    TEST_METHOD(OperatorLogical) {
+      BitArray first(100);
+      BitArray second(100);
+      first.set(1);
+      first.set(70);
+      second.set(70);
+      second.set(99);
+      // Check state.
+      Assert::AreEqual<Size>(1, (BitArray(first) &= second).count());
+      Assert::AreEqual<Size>(3, (BitArray(first) |= second).count());
+      Assert::AreEqual<Size>(2, (BitArray(first) ^= second).count());
+      Assert::AreEqual<Size>(1, BitArray(first).andNot(second).findFirst());
+      Assert::IsFalse(first == second);
+      Assert::IsTrue(first == BitArray(first));
+      Assert::ExpectException<SPL::Exceptions::InvalidArgument>([&first] { first &= BitArray(10); });
+    }
+  };
+}
@@ -0,0 +1,79 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#include "CppUnitTest.h"
+#include "arrays.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace SPL::Tests {
+  /// <summary>
+  /// Test class.
+  /// </summary>
+  TEST_CLASS(BitSetTests)
+  {
+  public:
+    /// <summary>
+    /// Test the default constructor.
+    /// </summary>
+    TEST_METHOD(ConstructDefault) {
+      BitSet<100> empty;
+      BitSet<100> full(true);
+      // Check state.
+      Assert::AreEqual<Size>(100, empty.getLength());
+      Assert::IsFalse(empty.any());
+      Assert::IsTrue(full.all());
+      Assert::AreEqual<Size>(100, full.count());
+      Assert::AreEqual(0xFFFFFFFFFULL, full.getData()[1]);
+    }
+    /// <summary>
+    /// Test the methods set, reset and flip.
+    /// </summary>
+    TEST_METHOD(MethodSet) {
+      BitSet<130> set;
+      set.set(0);
+      set.set(64);
+      set.set(129);
+      set.reset(64);
+      set.flip(1);
+      // Check state.
+      Assert::IsTrue(set[0]);
+      Assert::IsTrue(set[1]);
+      Assert::IsFalse(set[64]);
+      Assert::IsTrue(set[129]);
+      Assert::AreEqual<Size>(3, set.count());
+      Assert::ExpectException<SPL::Exceptions::IndexOutOfBounds>([&set] { set.set(130); });
+    }
+    /// <summary>
+    /// Test the methods rank, findFirst and findNext.
+    /// </summary>
+    TEST_METHOD(MethodFind) {
+      BitSet<200> set;
+      set.set(10);
+      set.set(150);
+      // Check state.
+      Assert::AreEqual<Size>(1, set.rank(11));
+      Assert::AreEqual<Size>(2, set.rank(200));
+      Assert::AreEqual<Size>(10, set.findFirst());
+      Assert::AreEqual<Size>(150, set.findNext(10));
+      Assert::AreEqual<Size>(-1, set.findNext(150));
+    }
+    /// <summary>
+    /// Test the logical operators.
+    /// </summary>
+    TEST_METHOD(OperatorLogical) {
+      BitSet<70> first;
+      BitSet<70> second;
+      first.set(1);
+      first.set(69);
+      second.set(69);
+      // Check state.
+      Assert::AreEqual<Size>(1, (first & second).count());
+      Assert::AreEqual<Size>(2, (first | second).count());
+      Assert::AreEqual<Size>(1, (first ^ second).findFirst());
+      Assert::AreEqual<Size>(68, (~first).count());
+      Assert::AreEqual<Size>(1, BitSet<70>(first).andNot(second).count());
+      Assert::IsTrue((first | second) == first);
+    }
+  };
+}
@@ -0,0 +1,190 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#include "../mock.hpp"
+#include "CppUnitTest.h"
+#include "interfaces.hpp"
+#include "arrays.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace SPL::Tests;
+
+namespace SPL::Tests {
+  /// <summary>
+  /// Test class.
+  /// </summary>
+  TEST_CLASS(ColumnListTests)
+  {
+  public:
+    /// <summary>
+    /// Test the empty constructor.
+    /// </summary>
+    TEST_METHOD(ConstructEmpty) {
+      ColumnList<Tuple<int, float>> list;
+      // Check state.
+      Assert::IsTrue(list.isEmpty());
+      Assert::AreEqual<Size>(0, list.getLength());
+      Assert::IsTrue(list.getColumn<0>().isEmpty());
+    }
+    /// <summary>
+    /// Test the initialized constructor for capacity.
+    /// </summary>
+    TEST_METHOD(ConstructCapacity) {
+      ColumnList<Tuple<int, float>> list(10);
+      // Check state.
+      Assert::IsTrue(list.isEmpty());
+      Assert::AreEqual<Size>(16, list.getCapacity());
+    }
+    /// <summary>
+    /// Test the copy constructor.
+    /// </summary>
+    TEST_METHOD(ConstructCopy) {
+      ColumnList<Tuple<int, float>> list;
+      list.add(1, 1.5f);
+      list.add(2, 2.5f);
+      ColumnList<Tuple<int, float>> other(list);
+      // Change values.
+      list[0].set<0>(10);
+      // Check state.
+      Assert::AreEqual<Size>(2, other.getLength());
+      Assert::AreEqual(1, other.get<0>(0));
+      Assert::AreEqual(2.5f, other.get<1>(1));
+      Assert::AreEqual(10, list.get<0>(0));
+    }
+    /// <summary>
+    /// Test the move constructor.
+    /// </summary>
+    TEST_METHOD(ConstructMove) {
+      Size instances = 0;
+      ColumnList<Tuple<int, Mock>> list;
+      list.add(1, Mock(instances));
+      list.add(2, Mock(instances));
+      ColumnList<Tuple<int, Mock>> other(Move(list));
+      // Check state.
+      Assert::AreEqual<Size>(2, instances);
+      Assert::IsTrue(list.isEmpty());
+      Assert::AreEqual<Size>(2, other.getLength());
+    }
+    /// <summary>
+    /// Test the destructor.
+    /// </summary>
+    TEST_METHOD(Destruct) {
+      Size instances = 0;
+      // Create a new instance.
+      auto list = new ColumnList<Tuple<Mock, int>>();
+      for (int value = 0; value < 10; ++value) {
+        list->add(Mock(instances), value);
+      }
+      Assert::AreEqual<Size>(10, instances);
+      // Destroy the instance.
+      delete list;
+      // Check state.
+      Assert::AreEqual<Size>(0, instances);
+    }
+    /// <summary>
+    /// Test the methods add and get.
+    /// </summary>
+    TEST_METHOD(MethodAdd) {
+      ColumnList<Tuple<int, float, bool>> list;
+      list.add(1, 1.5f, true);
+      list.add(Tuple<int, float, bool>(3, 3.5f, false));
+      list.add(1, Tuple<int, float, bool>(2, 2.5f, true));
+      // Check state.
+      Assert::AreEqual<Size>(3, list.getLength());
+      const auto row = list.get(1);
+      Assert::AreEqual(2, row.get<0>());
+      Assert::AreEqual(2.5f, row.get<1>());
+      Assert::IsTrue(row.get<2>());
+      Assert::AreEqual(3, list.get<0>(2));
+      Assert::ExpectException<SPL::Exceptions::IndexOutOfBounds>([&list] { list.get(3); });
+      Assert::ExpectException<SPL::Exceptions::IndexOutOfBounds>([&list] { list.get<1>(3); });
+      Assert::ExpectException<SPL::Exceptions::IndexOutOfBounds>([&list] {
+        list.add(4, Tuple<int, float, bool>(4, 4.5f, false));
+      });
+    }
+    /// <summary>
+    /// Test the method add with values from the list itself.
+    /// </summary>
+    TEST_METHOD(MethodAddSelf) {
+      ColumnList<Tuple<int, int>> list(4);
+      for (int value = 0; value < 4; ++value) {
+        list.add(value, value * 2);
+      }
+      Assert::AreEqual<Size>(4, list.getCapacity());
+      list.add(list.get<0>(2), 9);
+      // Check state.
+      Assert::AreEqual<Size>(5, list.getLength());
+      Assert::AreEqual(2, list.get<0>(4));
+      Assert::AreEqual(9, list.get<1>(4));
+    }
+    /// <summary>
+    /// Test the method set.
+    /// </summary>
+    TEST_METHOD(MethodSet) {
+      ColumnList<Tuple<int, float>> list;
+      list.add(1, 1.5f);
+      const auto previous = list.set(0, Tuple<int, float>(2, 2.5f));
+      // Check state.
+      Assert::AreEqual(1, previous.get<0>());
+      Assert::AreEqual(2, list.get<0>(0));
+      Assert::AreEqual(2.5f, list.get<1>(0));
+    }
+    /// <summary>
+    /// Test the method remove.
+    /// </summary>
+    TEST_METHOD(MethodRemove) {
+      Size instances = 0;
+      ColumnList<Tuple<int, Mock>> list;
+      for (int value = 0; value < 5; ++value) {
+        list.add(value, Mock(instances));
+      }
+      const auto row = list.remove(1);
+      // Check state.
+      Assert::AreEqual(1, row.get<0>());
+      Assert::AreEqual<Size>(4, list.getLength());
+      Assert::AreEqual(2, list.get<0>(1));
+      list.clear();
+      Assert::AreEqual<Size>(1, instances);
+      Assert::ExpectException<SPL::Exceptions::IndexOutOfBounds>([&list] { list.remove(0); });
+    }
+    /// <summary>
+    /// Test the method getColumn.
+    /// </summary>
+    TEST_METHOD(MethodGetColumn) {
+      ColumnList<Tuple<int, float>> list;
+      for (int value = 0; value < 100; ++value) {
+        list.add(value, value * 0.5f);
+      }
+      auto column = list.getColumn<1>();
+      const auto& constant = list;
+      // Change values.
+      column[10] = -1.0f;
+      // Check state.
+      int sum = 0;
+      const auto keys = constant.getColumn<0>();
+      for (Index index = 0; index < keys.getLength(); ++index) {
+        sum += keys[index];
+      }
+      Assert::AreEqual<Size>(100, column.getLength());
+      Assert::AreEqual(4950, sum);
+      Assert::AreEqual(-1.0f, list.get<1>(10));
+      Assert::IsTrue(column.getData() + 1 == &list.get<1>(1));
+    }
+    /// <summary>
+    /// Test the subscript operator.
+    /// </summary>
+    TEST_METHOD(OperatorSubscript) {
+      ColumnList<Tuple<int, float>> list;
+      list.add(1, 1.5f);
+      list.add(2, 2.5f);
+      // Change values.
+      list[1].set<1>(5.5f);
+      list[0].get<0>() = 10;
+      list[0] = Tuple<int, float>(list[1]);
+      // Check state.
+      Assert::AreEqual(2, list.get<0>(0));
+      Assert::AreEqual(5.5f, list.get<1>(0));
+      Assert::ExpectException<SPL::Exceptions::IndexOutOfBounds>([&list] { list[2]; });
+    }
+  };
+}
@@ -0,0 +1,153 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#include "../mock.hpp"
+#include "CppUnitTest.h"
+#include "interfaces.hpp"
+#include "arrays.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace SPL::Tests;
+
+namespace SPL::Tests {
+  /// <summary>
+  /// Test class.
+  /// </summary>
+  TEST_CLASS(EytzingerArrayTests)
+  {
+  public:
+    /// <summary>
+    /// Test the empty constructor.
+    /// </summary>
+    TEST_METHOD(ConstructEmpty) {
+      EytzingerArray<int> array;
+      // Check state.
+      Assert::IsTrue(array.isEmpty());
+      Assert::AreEqual<Size>(0, array.getLength());
+      Assert::AreEqual(static_cast<Index>(-1), array.lowerBound(1));
+      Assert::IsFalse(array.contains(1));
+    }
+    /// <summary>
+    /// Test the initialized constructor for elements.
+    /// </summary>
+    TEST_METHOD(ConstructElements) {
+      EytzingerArray<const float> array({ 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f });
+      // Check state.
+      Assert::AreEqual<Size>(6, array.getLength());
+      Assert::AreEqual(4.5f, array[0]);
+      Assert::AreEqual(2.5f, array[1]);
+      Assert::AreEqual(6.5f, array[2]);
+    }
+    /// <summary>
+    /// Test the initialized constructor for a list.
+    /// </summary>
+    TEST_METHOD(ConstructList) {
+      ArrayList<int> list({ 5, 1, 3, 2, 4 });
+      list.sort();
+      EytzingerArray<int> array(list);
+      // Check state.
+      Assert::AreEqual<Size>(5, array.getLength());
+      for (int value = 1; value <= 5; ++value) {
+        Assert::AreEqual(value, array[array.indexOf(value)]);
+      }
+    }
+    /// <summary>
+    /// Test the copy constructor.
+    /// </summary>
+    TEST_METHOD(ConstructCopy) {
+      Size instances = 0;
+      Mock values[] = { Mock(instances), Mock(instances) };
+      {
+        EytzingerArray<Mock> array(values, 1);
+        EytzingerArray<Mock> other(array);
+        Assert::AreEqual<Size>(4, instances);
+        // Check state.
+        Assert::AreEqual<Size>(1, other.getLength());
+        Assert::AreEqual<Size>(1, array.getLength());
+      }
+      Assert::AreEqual<Size>(2, instances);
+    }
+    /// <summary>
+    /// Test the move constructor.
+    /// </summary>
+    TEST_METHOD(ConstructMove) {
+      EytzingerArray<int> array({ 1, 2, 3 });
+      EytzingerArray<int> other(Move(array));
+      // Check state.
+      Assert::IsTrue(array.isEmpty());
+      Assert::AreEqual<Size>(3, other.getLength());
+      Assert::IsTrue(other.contains(2));
+    }
+    /// <summary>
+    /// Test the lower and upper bound methods.
+    /// </summary>
+    TEST_METHOD(MethodBounds) {
+      int values[100];
+      for (Size length = 1; length <= 100; ++length) {
+        for (Size offset = 0; offset < length; ++offset) {
+          values[offset] = static_cast<int>(offset / 2) * 2;
+        }
+        EytzingerArray<int> array(values, length);
+        for (int search = -1; search <= static_cast<int>(length) + 1; ++search) {
+          const auto lower = LowerBound(values, length, search);
+          const auto upper = UpperBound(values, length, search);
+          // Check state.
+          const auto first = array.lowerBound(search);
+          const auto last = array.upperBound(search);
+          if (lower == length) {
+            Assert::AreEqual(static_cast<Index>(-1), first);
+          }
+          else {
+            Assert::AreEqual(values[lower], array[first]);
+          }
+          if (upper == length) {
+            Assert::AreEqual(static_cast<Index>(-1), last);
+          }
+          else {
+            Assert::AreEqual(values[upper], array[last]);
+          }
+          Assert::AreEqual(lower != upper, array.contains(search));
+        }
+      }
+    }
+    /// <summary>
+    /// Test the index of method.
+    /// </summary>
+    TEST_METHOD(MethodIndexOf) {
+      EytzingerArray<int> array({ 10, 20, 30, 40, 50, 60, 70 });
+      // Check state.
+      Assert::AreEqual<Size>(0, array.indexOf(40));
+      Assert::AreEqual<Size>(1, array.indexOf(20));
+      Assert::AreEqual<Size>(2, array.indexOf(60));
+      Assert::AreEqual<Size>(3, array.indexOf(10));
+      Assert::AreEqual(static_cast<Index>(-1), array.indexOf(35));
+      Assert::AreEqual(static_cast<Index>(-1), array.indexOf(80));
+    }
+    /// <summary>
+    /// Test the access operator.
+    /// </summary>
+    TEST_METHOD(OperatorAccess) {
+      EytzingerArray<int> array({ 1, 2, 3 });
+      // Check state.
+      Assert::AreEqual(2, array[0]);
+      Assert::ExpectException<SPL::Exceptions::IndexOutOfBounds>([&array] {
+        array[3];
+      });
+    }
+    /// <summary>
+    /// Test the range-based loop.
+    /// </summary>
+    TEST_METHOD(FeatureRangeFor) {
+      EytzingerArray<const float> array({ 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f });
+      // Check values in the layout order.
+      Index index = 0;
+      for (const auto& value : array) {
+        Assert::AreEqual(array[index++], value);
+      }
+      Assert::AreEqual<Size>(6, index);
+      for (const auto& value : EytzingerArray<const float>()) {
+        Assert::Fail();
+      }
+    }
+  };
+}
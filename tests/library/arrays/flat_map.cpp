@@ -0,0 +1,177 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#include "../mock.hpp"
+#include "CppUnitTest.h"
+#include "interfaces.hpp"
+#include "arrays.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace SPL::Tests;
+
+namespace SPL::Tests {
+  /// <summary>
+  /// Test class.
+  /// </summary>
+  TEST_CLASS(FlatMapTests)
+  {
+  public:
+    /// <summary>
+    /// Test the empty constructor.
+    /// </summary>
+    TEST_METHOD(ConstructEmpty) {
+      FlatMap<int, float> map;
+      // Check state.
+      Assert::IsTrue(map.isEmpty());
+      Assert::AreEqual<Size>(0, map.getSize());
+      Assert::AreEqual<Size>(0, map.getCapacity());
+      Assert::IsFalse(map.has(1));
+    }
+    /// <summary>
+    /// Test the initialized constructor for capacity.
+    /// </summary>
+    TEST_METHOD(ConstructCapacity) {
+      FlatMap<int, float> map(10);
+      // Check state.
+      Assert::IsTrue(map.isEmpty());
+      Assert::AreEqual<Size>(16, map.getCapacity());
+    }
+    /// <summary>
+    /// Test the initialized constructor for unsorted pairs.
+    /// </summary>
+    TEST_METHOD(ConstructPairs) {
+      FlatMap<int, float> map({ { 3, 3.5f }, { 1, 1.5f }, { 2, 2.5f }, { 1, 10.5f }, { 3, 30.5f } });
+      // Check state.
+      Assert::AreEqual<Size>(3, map.getSize());
+      const auto keys = map.getKeys();
+      for (Index index = 0; index < keys.getLength(); ++index) {
+        Assert::AreEqual(static_cast<int>(index) + 1, keys[index]);
+      }
+      Assert::AreEqual(10.5f, map.get(1));
+      Assert::AreEqual(2.5f, map.get(2));
+      Assert::AreEqual(30.5f, map.get(3));
+    }
+    /// <summary>
+    /// Test the copy constructor.
+    /// </summary>
+    TEST_METHOD(ConstructCopy) {
+      FlatMap<int, float> map({ { 1, 1.5f }, { 2, 2.5f } }), other(map);
+      // Change values.
+      map.set(1, 10.5f);
+      // Check state.
+      Assert::AreEqual<Size>(2, other.getSize());
+      Assert::AreEqual(1.5f, other.get(1));
+      Assert::AreEqual(10.5f, map.get(1));
+    }
+    /// <summary>
+    /// Test the move constructor.
+    /// </summary>
+    TEST_METHOD(ConstructMove) {
+      Size instances = 0;
+      FlatMap<int, Mock> map;
+      map.set(1, Mock(instances));
+      map.set(2, Mock(instances));
+      FlatMap<int, Mock> other(Move(map));
+      // Check state.
+      Assert::AreEqual<Size>(2, instances);
+      Assert::IsTrue(map.isEmpty());
+      Assert::AreEqual<Size>(2, other.getSize());
+    }
+    /// <summary>
+    /// Test the destructor.
+    /// </summary>
+    TEST_METHOD(Destruct) {
+      Size instances = 0;
+      // Create a new instance.
+      auto map = new FlatMap<int, Mock>();
+      for (int key = 0; key < 10; ++key) {
+        map->set(key, Mock(instances));
+      }
+      Assert::AreEqual<Size>(10, instances);
+      // Destroy the instance.
+      delete map;
+      // Check state.
+      Assert::AreEqual<Size>(0, instances);
+    }
+    /// <summary>
+    /// Test the methods set and get.
+    /// </summary>
+    TEST_METHOD(MethodSet) {
+      FlatMap<int, int> map;
+      for (int key = 0; key < 100; ++key) {
+        map.set((key * 37) % 100, key);
+      }
+      // Check state.
+      Assert::AreEqual<Size>(100, map.getSize());
+      Assert::AreEqual(2, map.set(74, -1));
+      Assert::AreEqual(-1, map.get(74));
+      int value = 0;
+      Assert::IsTrue(map.get(37, value));
+      Assert::AreEqual(1, value);
+      Assert::IsFalse(map.get(100, value));
+      Assert::ExpectException<SPL::Exceptions::KeyNotFound<int>>([&map] { map.get(100); });
+      const auto keys = map.getKeys();
+      for (Index index = 0; index < keys.getLength(); ++index) {
+        Assert::AreEqual(static_cast<int>(index), keys[index]);
+      }
+    }
+    /// <summary>
+    /// Test the method remove.
+    /// </summary>
+    TEST_METHOD(MethodRemove) {
+      FlatMap<int, int> map;
+      for (int key = 0; key < 64; ++key) {
+        map.set(key, key * 2);
+      }
+      // Check state.
+      Assert::AreEqual(20, map.remove(10));
+      int value = 0;
+      Assert::IsTrue(map.remove(20, value));
+      Assert::AreEqual(40, value);
+      Assert::IsFalse(map.remove(20, value));
+      Assert::ExpectException<SPL::Exceptions::KeyNotFound<int>>([&map] { map.remove(10); });
+      Assert::AreEqual<Size>(62, map.getSize());
+      Assert::IsFalse(map.has(10));
+      Assert::AreEqual<Size>(64, map.getCapacity());
+      while (map.getSize() > 16) {
+        map.remove(map.getKeys()[0]);
+      }
+      Assert::AreEqual<Size>(32, map.getCapacity());
+      map.clear();
+      Assert::IsTrue(map.isEmpty());
+    }
+    /// <summary>
+    /// Test the method range.
+    /// </summary>
+    TEST_METHOD(MethodRange) {
+      FlatMap<int, int> map({ { 50, 5 }, { 10, 1 }, { 40, 4 }, { 20, 2 }, { 30, 3 } });
+      const auto range = map.range(15, 40);
+      const auto values = map.getValues().view(range.key, range.value);
+      // Check state.
+      Assert::AreEqual<Index>(1, range.key);
+      Assert::AreEqual<Index>(3, range.value);
+      Assert::AreEqual(2, values[0]);
+      Assert::AreEqual(3, values[1]);
+      Assert::AreEqual<Index>(3, map.upperBound(30));
+      Assert::AreEqual<Index>(5, map.lowerBound(60));
+      const auto empty = map.range(40, 10);
+      Assert::AreEqual(empty.key, empty.value);
+    }
+    /// <summary>
+    /// Test the subscript operator.
+    /// </summary>
+    TEST_METHOD(OperatorSubscript) {
+      FlatMap<int, int> map;
+      const auto& constant = map;
+      // Change values.
+      map[2] = 20;
+      map[1] = 10;
+      map[2] += 5;
+      // Check state.
+      Assert::AreEqual<Size>(2, map.getSize());
+      Assert::AreEqual(10, constant[1]);
+      Assert::AreEqual(25, constant[2]);
+      Assert::ExpectException<SPL::Exceptions::KeyNotFound<int>>([&constant] { constant[3]; });
+    }
+  };
+}
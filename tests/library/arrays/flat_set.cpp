@@ -0,0 +1,151 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#include "../mock.hpp"
+#include "CppUnitTest.h"
+#include "interfaces.hpp"
+#include "arrays.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace SPL::Tests;
+
+namespace SPL::Tests {
+  /// <summary>
+  /// Test class.
+  /// </summary>
+  TEST_CLASS(FlatSetTests)
+  {
+  public:
+    /// <summary>
+    /// Test the empty constructor.
+    /// </summary>
+    TEST_METHOD(ConstructEmpty) {
+      FlatSet<int> set;
+      // Check state.
+      Assert::IsTrue(set.isEmpty());
+      Assert::AreEqual<Size>(0, set.getSize());
+      Assert::IsFalse(set.has(1));
+    }
+    /// <summary>
+    /// Test the initialized constructor for capacity.
+    /// </summary>
+    TEST_METHOD(ConstructCapacity) {
+      FlatSet<int> set(10);
+      // Check state.
+      Assert::IsTrue(set.isEmpty());
+      Assert::AreEqual<Size>(16, set.getCapacity());
+    }
+    /// <summary>
+    /// Test the initialized constructor for unsorted values.
+    /// </summary>
+    TEST_METHOD(ConstructValues) {
+      FlatSet<int> set({ 5, 3, 5, 1, 4, 1, 2, 5 });
+      // Check state.
+      Assert::AreEqual<Size>(5, set.getSize());
+      const auto values = set.getValues();
+      for (Index index = 0; index < values.getLength(); ++index) {
+        Assert::AreEqual(static_cast<int>(index) + 1, values[index]);
+      }
+    }
+    /// <summary>
+    /// Test the copy constructor.
+    /// </summary>
+    TEST_METHOD(ConstructCopy) {
+      FlatSet<int> set({ 1, 2 }), other(set);
+      // Change values.
+      set.add(3);
+      // Check state.
+      Assert::AreEqual<Size>(2, other.getSize());
+      Assert::IsFalse(other.has(3));
+      Assert::IsTrue(set.has(3));
+    }
+    /// <summary>
+    /// Test the move constructor.
+    /// </summary>
+    TEST_METHOD(ConstructMove) {
+      FlatSet<int> set({ 1, 2 });
+      FlatSet<int> other(Move(set));
+      // Check state.
+      Assert::IsTrue(set.isEmpty());
+      Assert::AreEqual<Size>(2, other.getSize());
+    }
+    /// <summary>
+    /// Test the methods add and has.
+    /// </summary>
+    TEST_METHOD(MethodAdd) {
+      FlatSet<int> set;
+      for (int value = 0; value < 100; ++value) {
+        set.add((value * 37) % 100);
+        set.add((value * 37) % 100);
+      }
+      // Check state.
+      Assert::AreEqual<Size>(100, set.getSize());
+      Assert::AreEqual<Size>(128, set.getCapacity());
+      Assert::IsTrue(set.has(99));
+      Assert::IsFalse(set.has(100));
+      const auto values = set.getValues();
+      for (Index index = 0; index < values.getLength(); ++index) {
+        Assert::AreEqual(static_cast<int>(index), values[index]);
+      }
+    }
+    /// <summary>
+    /// Test the method getIterator.
+    /// </summary>
+    TEST_METHOD(MethodGetIterator) {
+      FlatSet<int> set({ 30, 10, 20 });
+      auto iterator = set.getIterator();
+      // Check values.
+      for (int expected = 10; expected <= 30; expected += 10) {
+        Assert::IsTrue(iterator->hasNext());
+        Assert::AreEqual(expected, iterator->next());
+      }
+      Assert::IsFalse(iterator->hasNext());
+    }
+    /// <summary>
+    /// Test the method remove.
+    /// </summary>
+    TEST_METHOD(MethodRemove) {
+      FlatSet<int> set;
+      for (int value = 0; value < 64; ++value) {
+        set.add(value);
+      }
+      // Check state.
+      Assert::IsTrue(set.remove(10));
+      Assert::IsFalse(set.remove(10));
+      Assert::IsFalse(set.has(10));
+      Assert::AreEqual<Size>(63, set.getSize());
+      while (set.getSize() > 16) {
+        set.remove(set.getValues()[0]);
+      }
+      Assert::AreEqual<Size>(32, set.getCapacity());
+      set.clear();
+      Assert::IsTrue(set.isEmpty());
+    }
+    /// <summary>
+    /// Test the method range.
+    /// </summary>
+    TEST_METHOD(MethodRange) {
+      FlatSet<int> set({ 50, 10, 40, 20, 30 });
+      const auto range = set.range(20, 45);
+      // Check state.
+      Assert::AreEqual<Index>(1, range.key);
+      Assert::AreEqual<Index>(4, range.value);
+      Assert::AreEqual(40, set.getValues()[range.value - 1]);
+      Assert::AreEqual<Index>(2, set.upperBound(20));
+      Assert::AreEqual<Index>(0, set.lowerBound(5));
+    }
+    /// <summary>
+    /// Test the range-based loop.
+    /// </summary>
+    TEST_METHOD(FeatureRangeFor) {
+      FlatSet<int> set({ 30, 10, 20 });
+      // Check values.
+      int expected = 10;
+      for (const auto& value : set) {
+        Assert::AreEqual(expected, value);
+        expected += 10;
+      }
+      Assert::AreEqual(40, expected);
+    }
+  };
+}
@@ -0,0 +1,147 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#include "../mock.hpp"
+#include "CppUnitTest.h"
+#include "interfaces.hpp"
+#include "arrays.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace SPL::Tests;
+
+namespace SPL::Tests {
+  /// <summary>
+  /// Test class.
+  /// </summary>
+  TEST_CLASS(IndexedPriorityQueueTests)
+  {
+  public:
+    /// <summary>
+    /// Test the initialized constructor for keys.
+    /// </summary>
+    TEST_METHOD(ConstructKeys) {
+      IndexedPriorityQueue<const float> queue(10);
+      // Check state.
+      Assert::IsTrue(queue.isEmpty());
+      Assert::AreEqual<Size>(10, queue.getCapacity());
+      Assert::IsFalse(queue.contains(0));
+      Assert::IsFalse(queue.contains(10));
+      Assert::ExpectException<SPL::Exceptions::InvalidOperation>([&queue] { queue.top(); });
+      Assert::ExpectException<SPL::Exceptions::InvalidArgument>([] {
+        IndexedPriorityQueue<int> queue(static_cast<CompactIndex>(-1));
+      });
+    }
+    /// <summary>
+    /// Test the copy constructor.
+    /// </summary>
+    TEST_METHOD(ConstructCopy) {
+      IndexedPriorityQueue<int> queue(4);
+      queue.push(0, 30);
+      queue.push(3, 10);
+      IndexedPriorityQueue<int> other(queue);
+      // Change values.
+      queue.update(0, 5);
+      // Check state.
+      Assert::AreEqual<Size>(2, other.getLength());
+      Assert::AreEqual<Size>(3, other.top());
+      Assert::AreEqual(30, other.get(0));
+      Assert::AreEqual<Size>(0, queue.top());
+    }
+    /// <summary>
+    /// Test the move constructor.
+    /// </summary>
+    TEST_METHOD(ConstructMove) {
+      Size instances = 0;
+      IndexedPriorityQueue<Mock> queue(4);
+      queue.push(1, Mock(instances));
+      IndexedPriorityQueue<Mock> other(Move(queue));
+      // Check state.
+      Assert::AreEqual<Size>(1, instances);
+      Assert::IsTrue(queue.isEmpty());
+      Assert::IsTrue(other.contains(1));
+    }
+    /// <summary>
+    /// Test the destructor.
+    /// </summary>
+    TEST_METHOD(Destruct) {
+      Size instances = 0;
+      // Create a new instance.
+      auto queue = new IndexedPriorityQueue<Mock>(4);
+      queue->push(0, Mock(instances));
+      queue->push(2, Mock(instances));
+      Assert::AreEqual<Size>(2, instances);
+      // Destroy the instance.
+      delete queue;
+      // Check state.
+      Assert::AreEqual<Size>(0, instances);
+    }
+    /// <summary>
+    /// Test the methods push, top and pop.
+    /// </summary>
+    TEST_METHOD(MethodPush) {
+      IndexedPriorityQueue<int> queue(100);
+      for (Index key = 0; key < 100; ++key) {
+        queue.push(key, static_cast<int>((key * 37) % 100));
+      }
+      // Check state.
+      Assert::AreEqual<Size>(100, queue.getLength());
+      for (int expected = 0; expected < 100; ++expected) {
+        Assert::AreEqual(expected, queue.get(queue.top()));
+        Assert::AreEqual(static_cast<int>((queue.pop() * 37) % 100), expected);
+      }
+      Assert::ExpectException<SPL::Exceptions::InvalidOperation>([&queue] { queue.pop(); });
+      Assert::ExpectException<SPL::Exceptions::IndexOutOfBounds>([&queue] { queue.push(100, 0); });
+    }
+    /// <summary>
+    /// Test the method push for an existing key.
+    /// </summary>
+    TEST_METHOD(MethodPushExisting) {
+      IndexedPriorityQueue<int> queue(4);
+      queue.push(2, 10);
+      // Check state.
+      Assert::ExpectException<SPL::Exceptions::InvalidOperation>([&queue] { queue.push(2, 20); });
+    }
+    /// <summary>
+    /// Test the method update.
+    /// </summary>
+    TEST_METHOD(MethodUpdate) {
+      IndexedPriorityQueue<int> queue(8);
+      for (Index key = 0; key < 8; ++key) {
+        queue.push(key, static_cast<int>(key) * 10);
+      }
+      // Decrease the key.
+      queue.update(6, -1);
+      Assert::AreEqual<Size>(6, queue.top());
+      // Increase the key.
+      queue.update(6, 100);
+      Assert::AreEqual<Size>(0, queue.top());
+      queue.update(0, 35);
+      // Check state.
+      const Index expected[] = { 1, 2, 3, 0, 4, 5, 7, 6 };
+      for (const auto key : expected) {
+        Assert::AreEqual(key, queue.pop());
+      }
+      Assert::ExpectException<SPL::Exceptions::InvalidOperation>([&queue] { queue.update(1, 0); });
+    }
+    /// <summary>
+    /// Test the method remove.
+    /// </summary>
+    TEST_METHOD(MethodRemove) {
+      Size instances = 0;
+      IndexedPriorityQueue<Mock> queue(4);
+      queue.push(0, Mock(instances));
+      queue.push(1, Mock(instances));
+      queue.push(2, Mock(instances));
+      // Check state.
+      Assert::IsTrue(queue.remove(1));
+      Assert::IsFalse(queue.remove(1));
+      Assert::IsFalse(queue.remove(3));
+      Assert::AreEqual<Size>(2, instances);
+      Assert::AreEqual<Size>(2, queue.getLength());
+      Assert::IsFalse(queue.contains(1));
+      queue.clear();
+      Assert::AreEqual<Size>(0, instances);
+      Assert::IsTrue(queue.isEmpty());
+    }
+  };
+}
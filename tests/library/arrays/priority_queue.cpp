@@ -0,0 +1,167 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#include "../mock.hpp"
+#include "CppUnitTest.h"
+#include "interfaces.hpp"
+#include "arrays.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace SPL::Tests;
+
+namespace SPL::Tests {
+  /// <summary>
+  /// Test class.
+  /// </summary>
+  TEST_CLASS(PriorityQueueTests)
+  {
+  private:
+    /// <summary>
+    /// Reverse comparator class.
+    /// </summary>
+    class Greater final {
+    public:
+      /// <summary>
+      /// Compare the given source with the given target in reverse order.
+      /// </summary>
+      /// <param name="source">Source value.</param>
+      /// <param name="target">Target value.</param>
+      /// <returns>Returns the comparison result.</returns>
+      int operator()(const int& source, const int& target) const {
+        return Compare(target, source);
+      }
+    };
+  public:
+    /// <summary>
+    /// Test the empty constructor.
+    /// </summary>
+    TEST_METHOD(ConstructEmpty) {
+      PriorityQueue<const float> queue;
+      // Check state.
+      Assert::IsTrue(queue.isEmpty());
+      Assert::AreEqual<Size>(0, queue.getLength());
+      Assert::ExpectException<SPL::Exceptions::InvalidOperation>([&queue] { queue.top(); });
+      Assert::ExpectException<SPL::Exceptions::InvalidOperation>([&queue] { queue.pop(); });
+    }
+    /// <summary>
+    /// Test the initialized constructor for elements.
+    /// </summary>
+    TEST_METHOD(ConstructElements) {
+      PriorityQueue<const float> queue({ 3.5f, 1.5f, 2.5f });
+      // Check state.
+      Assert::AreEqual<Size>(3, queue.getLength());
+      Assert::AreEqual(1.5f, queue.top());
+    }
+    /// <summary>
+    /// Test the initialized constructor for a list.
+    /// </summary>
+    TEST_METHOD(ConstructList) {
+      ArrayList<int> list({ 9, 4, 7, 1, 8, 2, 6, 3, 5, 0 });
+      PriorityQueue<int> queue(list);
+      // Check state.
+      Assert::AreEqual<Size>(10, queue.getLength());
+      for (int expected = 0; expected < 10; ++expected) {
+        Assert::AreEqual(expected, queue.pop());
+      }
+    }
+    /// <summary>
+    /// Test the copy constructor.
+    /// </summary>
+    TEST_METHOD(ConstructCopy) {
+      PriorityQueue<int> queue({ 3, 1, 2 });
+      PriorityQueue<int> other(queue);
+      // Change values.
+      queue.pop();
+      // Check state.
+      Assert::AreEqual<Size>(3, other.getLength());
+      Assert::AreEqual(1, other.top());
+      Assert::AreEqual(2, queue.top());
+    }
+    /// <summary>
+    /// Test the move constructor.
+    /// </summary>
+    TEST_METHOD(ConstructMove) {
+      Size instances = 0;
+      PriorityQueue<Mock> queue;
+      queue.emplace(instances);
+      queue.emplace(instances);
+      PriorityQueue<Mock> other(Move(queue));
+      // Check state.
+      Assert::AreEqual<Size>(2, instances);
+      Assert::IsTrue(queue.isEmpty());
+      Assert::AreEqual<Size>(2, other.getLength());
+    }
+    /// <summary>
+    /// Test the methods push, top and pop.
+    /// </summary>
+    TEST_METHOD(MethodPush) {
+      PriorityQueue<int> queue;
+      for (int value = 0; value < 100; ++value) {
+        queue.push((value * 37) % 100);
+      }
+      // Check state.
+      Assert::AreEqual<Size>(100, queue.getLength());
+      for (int expected = 0; expected < 100; ++expected) {
+        Assert::AreEqual(expected, queue.top());
+        Assert::AreEqual(expected, queue.pop());
+      }
+      int value = -1;
+      Assert::IsFalse(queue.pop(value));
+      Assert::AreEqual(-1, value);
+    }
+    /// <summary>
+    /// Test the method push with the top element of the queue itself.
+    /// </summary>
+    TEST_METHOD(MethodPushSelf) {
+      PriorityQueue<int> queue;
+      for (int value = 10; value < 14; ++value) {
+        queue.push(value);
+      }
+      Assert::AreEqual(queue.getLength(), queue.getCapacity());
+      // Push the top element.
+      queue.push(queue.top());
+      // Check state.
+      const int result[] = { 10, 10, 11, 12, 13 };
+      for (const int expected : result) {
+        Assert::AreEqual(expected, queue.pop());
+      }
+      Assert::IsTrue(queue.isEmpty());
+    }
+    /// <summary>
+    /// Test the method pushPop.
+    /// </summary>
+    TEST_METHOD(MethodPushPop) {
+      PriorityQueue<int> queue({ 5, 3, 8 });
+      // Check state.
+      Assert::AreEqual(1, queue.pushPop(1));
+      Assert::AreEqual<Size>(3, queue.getLength());
+      Assert::AreEqual(3, queue.pushPop(6));
+      Assert::AreEqual(5, queue.top());
+      Assert::AreEqual<Size>(3, queue.getLength());
+    }
+    /// <summary>
+    /// Test the comparator type.
+    /// </summary>
+    TEST_METHOD(FeatureComparator) {
+      PriorityQueue<int, Greater> queue({ 3, 9, 1, 5 });
+      // Check state.
+      Assert::AreEqual(9, queue.pop());
+      Assert::AreEqual(5, queue.pop());
+      Assert::AreEqual(3, queue.pop());
+      Assert::AreEqual(1, queue.pop());
+    }
+    /// <summary>
+    /// Test the method clear.
+    /// </summary>
+    TEST_METHOD(MethodClear) {
+      Size instances = 0;
+      PriorityQueue<Mock> queue;
+      queue.emplace(instances);
+      queue.emplace(instances);
+      queue.clear();
+      // Check state.
+      Assert::AreEqual<Size>(0, instances);
+      Assert::IsTrue(queue.isEmpty());
+    }
+  };
+}
@@ -0,0 +1,238 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#include <algorithm>
+#include <iterator>
+
+#include "../mock.hpp"
+#include "CppUnitTest.h"
+#include "interfaces.hpp"
+#include "arrays.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace SPL::Tests;
+
+namespace SPL::Tests {
+  /// <summary>
+  /// Test class.
+  /// </summary>
+  TEST_CLASS(SegmentedArrayListTests)
+  {
+  public:
+    /// <summary>
+    /// Test the empty constructor.
+    /// </summary>
+    TEST_METHOD(ConstructEmpty) {
+      SegmentedArrayList<const float, 4> list;
+      // Check state.
+      Assert::IsTrue(list.isEmpty());
+      Assert::AreEqual<Size>(0, list.getLength());
+      Assert::AreEqual<Size>(0, list.getCapacity());
+      Assert::AreEqual<Size>(0, list.getChunkCount());
+    }
+    /// <summary>
+    /// Test the initialized constructor for elements.
+    /// </summary>
+    TEST_METHOD(ConstructElements) {
+      SegmentedArrayList<const float, 4> list({ 1.5f, 2.5f, 3.5f, 4.5f, 5.5f });
+      // Check state.
+      Assert::AreEqual<Size>(5, list.getLength());
+      Assert::AreEqual<Size>(8, list.getCapacity());
+      Assert::AreEqual<Size>(2, list.getChunkCount());
+      Assert::AreEqual(1.5f, list[0]);
+      Assert::AreEqual(5.5f, list[4]);
+    }
+    /// <summary>
+    /// Test the copy constructor.
+    /// </summary>
+    TEST_METHOD(ConstructCopy) {
+      SegmentedArrayList<int, 4> list({ 1, 2, 3, 4, 5 });
+      SegmentedArrayList<int, 4> other(list);
+      // Change values.
+      list[0] = 10;
+      // Check state.
+      Assert::AreEqual<Size>(5, other.getLength());
+      Assert::AreEqual(1, other[0]);
+      Assert::AreEqual(5, other[4]);
+      Assert::AreEqual(10, list[0]);
+    }
+    /// <summary>
+    /// Test the move constructor.
+    /// </summary>
+    TEST_METHOD(ConstructMove) {
+      Size instances = 0;
+      SegmentedArrayList<Mock, 4> list({ Mock(instances), Mock(instances) });
+      SegmentedArrayList<Mock, 4> other(Move(list));
+      // Check state.
+      Assert::AreEqual<Size>(2, instances);
+      Assert::IsTrue(list.isEmpty());
+      Assert::AreEqual<Size>(2, other.getLength());
+    }
+    /// <summary>
+    /// Test the destructor.
+    /// </summary>
+    TEST_METHOD(Destruct) {
+      Size instances = 0;
+      // Create a new instance (spanning many chunks).
+      auto list = new SegmentedArrayList<Mock, 4>();
+      for (Size count = 0; count < 10; ++count) {
+        list->emplace(instances);
+      }
+      Assert::AreEqual<Size>(10, instances);
+      // Destroy the instance.
+      delete list;
+      // Check state.
+      Assert::AreEqual<Size>(0, instances);
+    }
+    /// <summary>
+    /// Test the stable addresses of the elements.
+    /// </summary>
+    TEST_METHOD(FeatureStableAddresses) {
+      SegmentedArrayList<int, 4> list({ 1, 2, 3, 4 });
+      const auto* first = &list[0];
+      const auto* fourth = &list[3];
+      // Grow the list and the chunk index.
+      for (int value = 5; value <= 100; ++value) {
+        list.add(value);
+      }
+      // Check state.
+      Assert::AreEqual<Size>(100, list.getLength());
+      Assert::AreEqual<Size>(25, list.getChunkCount());
+      Assert::IsTrue(first == &list[0]);
+      Assert::IsTrue(fourth == &list[3]);
+      Assert::AreEqual(1, *first);
+      Assert::AreEqual(4, *fourth);
+    }
+    /// <summary>
+    /// Test the method emplace.
+    /// </summary>
+    TEST_METHOD(MethodEmplace) {
+      Size instances = 0;
+      SegmentedArrayList<Mock, 4> list;
+      auto& first = list.emplace(instances);
+      list.emplace(instances);
+      // Check state.
+      Assert::AreEqual<Size>(2, instances);
+      Assert::AreEqual<Size>(2, list.getLength());
+      Assert::IsTrue(&first == &list[0]);
+    }
+    /// <summary>
+    /// Test the method removeLast.
+    /// </summary>
+    TEST_METHOD(MethodRemoveLast) {
+      Size instances = 0;
+      SegmentedArrayList<Mock, 4> list;
+      for (Size count = 0; count < 9; ++count) {
+        list.emplace(instances);
+      }
+      Assert::AreEqual<Size>(12, list.getCapacity());
+      // Remove the elements of the last chunk (it's kept as the spare chunk).
+      list.removeLast();
+      Assert::AreEqual<Size>(8, list.getLength());
+      Assert::AreEqual<Size>(12, list.getCapacity());
+      // Remove the elements of the second chunk (the third chunk is released).
+      for (Size count = 0; count < 4; ++count) {
+        list.removeLast();
+      }
+      // Check state.
+      Assert::AreEqual<Size>(4, instances);
+      Assert::AreEqual<Size>(4, list.getLength());
+      Assert::AreEqual<Size>(8, list.getCapacity());
+      Assert::AreEqual<Size>(1, list.getChunkCount());
+    }
+    /// <summary>
+    /// Test the method removeLast for an empty list.
+    /// </summary>
+    TEST_METHOD(MethodRemoveLastEmpty) {
+      SegmentedArrayList<int, 4> list;
+      // Check state.
+      Assert::ExpectException<SPL::Exceptions::InvalidOperation>([&list] { list.removeLast(); });
+    }
+    /// <summary>
+    /// Test the method getChunk.
+    /// </summary>
+    TEST_METHOD(MethodGetChunk) {
+      SegmentedArrayList<int, 4> list({ 1, 2, 3, 4, 5, 6 });
+      const auto first = list.getChunk(0);
+      const auto last = list.getChunk(1);
+      // Check state.
+      Assert::AreEqual<Size>(4, first.getLength());
+      Assert::AreEqual<Size>(2, last.getLength());
+      Assert::AreEqual(1, first[0]);
+      Assert::AreEqual(6, last[1]);
+      Assert::ExpectException<SPL::Exceptions::IndexOutOfBounds>([&list] { list.getChunk(2); });
+    }
+    /// <summary>
+    /// Test the method indexOf.
+    /// </summary>
+    TEST_METHOD(MethodIndexOf) {
+      SegmentedArrayList<int, 4> list({ 1, 2, 3, 4, 5, 6, 3 });
+      // Check state.
+      Assert::AreEqual<Size>(2, list.indexOf(3));
+      Assert::AreEqual<Size>(6, list.indexOf(3, 3));
+      Assert::AreEqual<Size>(5, list.indexOf(6, 5));
+      Assert::AreEqual<Size>(-1, list.indexOf(7));
+      Assert::IsTrue(list.contains(5));
+      Assert::IsFalse(list.contains(0));
+    }
+    /// <summary>
+    /// Test the method clear.
+    /// </summary>
+    TEST_METHOD(MethodClear) {
+      Size instances = 0;
+      SegmentedArrayList<Mock, 4> list;
+      for (Size count = 0; count < 10; ++count) {
+        list.emplace(instances);
+      }
+      list.clear();
+      // Check state.
+      Assert::AreEqual<Size>(0, instances);
+      Assert::IsTrue(list.isEmpty());
+      Assert::AreEqual<Size>(4, list.getCapacity());
+    }
+    /// <summary>
+    /// Test the iterator.
+    /// </summary>
+    TEST_METHOD(MethodIterator) {
+      SegmentedArrayList<int, 4> list({ 1, 2, 3, 4, 5 });
+      auto iterator = list.getIterator();
+      // Check values.
+      int expected = 1;
+      while (iterator->hasNext()) {
+        Assert::AreEqual(expected++, iterator->next());
+      }
+      Assert::AreEqual(6, expected);
+    }
+    /// <summary>
+    /// Test the range-based loop.
+    /// </summary>
+    TEST_METHOD(FeatureRangeFor) {
+      SegmentedArrayList<int, 4> list({ 1, 2, 3, 4, 5, 6, 7, 8 });
+      // Check values across the chunks.
+      int expected = 1;
+      for (auto& value : list) {
+        Assert::AreEqual(expected++, value);
+        value *= 10;
+      }
+      Assert::AreEqual(9, expected);
+      // Check the standard algorithms.
+      const auto& constant = list;
+      Assert::AreEqual<Size>(8, static_cast<Size>(std::distance(constant.begin(), constant.end())));
+      Assert::AreEqual(50, *std::find(constant.begin(), constant.end(), 50));
+      Assert::IsTrue(std::find(list.begin(), list.end(), 5) == list.end());
+      for (const auto& value : SegmentedArrayList<int, 4>()) {
+        Assert::Fail();
+      }
+    }
+    /// <summary>
+    /// Test the subscript operator.
+    /// </summary>
+    TEST_METHOD(OperatorSubscript) {
+      SegmentedArrayList<int, 4> list({ 1, 2, 3, 4, 5 });
+      list[4] = 10;
+      // Check state.
+      Assert::AreEqual(10, list[4]);
+      Assert::ExpectException<SPL::Exceptions::IndexOutOfBounds>([&list] { list[5]; });
+    }
+  };
+}
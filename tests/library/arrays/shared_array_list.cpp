@@ -0,0 +1,188 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#include "../mock.hpp"
+#include "CppUnitTest.h"
+#include "interfaces.hpp"
+#include "arrays.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace SPL::Tests;
+
+namespace SPL::Tests {
+  /// <summary>
+  /// Test class.
+  /// </summary>
+  TEST_CLASS(SharedArrayListTests)
+  {
+  public:
+    /// <summary>
+    /// Test the empty constructor.
+    /// </summary>
+    TEST_METHOD(ConstructEmpty) {
+      SharedArrayList<int> list;
+      // Check state.
+      Assert::IsTrue(list.isEmpty());
+      Assert::IsFalse(list.isShared());
+      Assert::AreEqual<Size>(0, list.getLength());
+      Assert::AreEqual<Size>(0, list.getCapacity());
+      Assert::ExpectException<SPL::Exceptions::IndexOutOfBounds>([&list] { list[0]; });
+    }
+    /// <summary>
+    /// Test the initialized constructor for elements.
+    /// </summary>
+    TEST_METHOD(ConstructElements) {
+      SharedArrayList<int> list({ 1, 2, 3 });
+      // Check state.
+      Assert::AreEqual<Size>(3, list.getLength());
+      Assert::AreEqual(2, list.get(1));
+    }
+    /// <summary>
+    /// Test the copy constructor.
+    /// </summary>
+    TEST_METHOD(ConstructCopy) {
+      SharedArrayList<int> list({ 1, 2, 3 }), other(list);
+      // Check state.
+      Assert::IsTrue(list.isShared());
+      Assert::IsTrue(list.view().getData() == other.view().getData());
+      // Change values.
+      list[0] = 10;
+      // Check values.
+      Assert::IsFalse(list.isShared());
+      Assert::IsFalse(other.isShared());
+      Assert::AreEqual(10, list.get(0));
+      Assert::AreEqual(1, other.get(0));
+    }
+    /// <summary>
+    /// Test the move constructor.
+    /// </summary>
+    TEST_METHOD(ConstructMove) {
+      Size instances = 0;
+      SharedArrayList<Mock> list;
+      list.add(Mock(instances));
+      SharedArrayList<Mock> other(Move(list));
+      // Check state.
+      Assert::AreEqual<Size>(1, instances);
+      Assert::IsTrue(list.isEmpty());
+      Assert::AreEqual<Size>(1, other.getLength());
+    }
+    /// <summary>
+    /// Test the destructor.
+    /// </summary>
+    TEST_METHOD(Destruct) {
+      Size instances = 0;
+      // Create the instances.
+      auto list = new SharedArrayList<Mock>();
+      list->add(Mock(instances));
+      list->add(Mock(instances));
+      auto other = new SharedArrayList<Mock>(*list);
+      Assert::AreEqual<Size>(2, instances);
+      // Destroy the instances.
+      delete list;
+      Assert::AreEqual<Size>(2, instances);
+      delete other;
+      // Check state.
+      Assert::AreEqual<Size>(0, instances);
+    }
+    /// <summary>
+    /// Test the methods add, set and remove.
+    /// </summary>
+    TEST_METHOD(MethodChange) {
+      SharedArrayList<int> list({ 1, 2, 3 });
+      const SharedArrayList<int> first(list);
+      // Change values.
+      list.add(4);
+      const SharedArrayList<int> second(list);
+      Assert::AreEqual(2, list.set(1, 20));
+      const SharedArrayList<int> third(list);
+      Assert::AreEqual(1, list.remove(0));
+      // Check values.
+      Assert::AreEqual<Size>(3, first.getLength());
+      Assert::AreEqual<Size>(4, second.getLength());
+      Assert::AreEqual(2, second[1]);
+      Assert::AreEqual(20, third[1]);
+      Assert::AreEqual<Size>(3, list.getLength());
+      Assert::AreEqual(20, list[0]);
+      Assert::IsFalse(list.isShared());
+      Assert::ExpectException<SPL::Exceptions::IndexOutOfBounds>([&list] { list.remove(3); });
+    }
+    /// <summary>
+    /// Test the methods sort and reverse.
+    /// </summary>
+    TEST_METHOD(MethodSort) {
+      SharedArrayList<int> list({ 3, 1, 2 });
+      const SharedArrayList<int> other(list);
+      // Change values.
+      list.sort();
+      // Check values.
+      Assert::AreEqual(1, list[0]);
+      Assert::AreEqual(3, other[0]);
+      list.reverse();
+      Assert::AreEqual(3, list[0]);
+    }
+    /// <summary>
+    /// Test the method clear.
+    /// </summary>
+    TEST_METHOD(MethodClear) {
+      SharedArrayList<int> list({ 1, 2, 3 }), other(list);
+      // Change values.
+      list.clear();
+      // Check state.
+      Assert::IsTrue(list.isEmpty());
+      Assert::IsFalse(other.isShared());
+      Assert::AreEqual<Size>(3, other.getLength());
+    }
+    /// <summary>
+    /// Test the element references handed out by the get method and the subscript operator.
+    /// </summary>
+    TEST_METHOD(FeatureUnshareable) {
+      SharedArrayList<int> list({ 1, 2, 3 }), other(list);
+      const auto& constant = list;
+      // Change values through the get method.
+      static_cast<const SharedArrayList<int>&>(other).get(0) = 99;
+      List<int>& reference = other;
+      reference.get(1) = 77;
+      // Check values.
+      Assert::IsFalse(list.isShared());
+      Assert::AreEqual(1, constant[0]);
+      Assert::AreEqual(2, constant[1]);
+      Assert::AreEqual(99, other.get(0));
+      Assert::AreEqual(77, other.get(1));
+      // Copy the list after taking a reference.
+      int& element = other[2];
+      const SharedArrayList<int> copy(other);
+      element = 55;
+      // Check values.
+      Assert::IsFalse(other.isShared());
+      Assert::AreEqual(3, copy[2]);
+      Assert::AreEqual(55, other[2]);
+    }
+    /// <summary>
+    /// Test the copy assignment operator.
+    /// </summary>
+    TEST_METHOD(OperatorCopy) {
+      SharedArrayList<int> list({ 1, 2, 3 }), other;
+      // Change values.
+      other = list;
+      // Check state.
+      Assert::IsTrue(other.isShared());
+      Assert::AreEqual(3, other[2]);
+    }
+    /// <summary>
+    /// Test the range-based loop.
+    /// </summary>
+    TEST_METHOD(FeatureRangeFor) {
+      SharedArrayList<int> list({ 1, 2, 3 }), other(list);
+      // Check values.
+      int expected = 1;
+      for (const auto& value : list) {
+        Assert::AreEqual(expected++, value);
+      }
+      Assert::AreEqual(4, expected);
+      Assert::IsTrue(list.isShared());
+      for (const auto& value : SharedArrayList<int>()) {
+        Assert::Fail();
+      }
+    }
+  };
+}
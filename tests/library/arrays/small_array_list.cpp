@@ -0,0 +1,120 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#include "../mock.hpp"
+#include "CppUnitTest.h"
+#include "interfaces.hpp"
+#include "arrays.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace SPL::Tests;
+
+namespace SPL::Tests {
+  /// <summary>
+  /// Test class.
+  /// </summary>
+  TEST_CLASS(SmallArrayListTests)
+  {
+  private:
+    /// <summary>
+    /// Determines whether or not the given element is stored inside the given list.
+    /// </summary>
+    /// <param name="list">List instance.</param>
+    /// <param name="element">Element reference.</param>
+    /// <returns>Returns true when the element is inline, false otherwise.</returns>
+    template<typename L, typename T>
+    static bool IsInline(const L& list, const T& element) {
+      const auto* begin = reinterpret_cast<const unsigned char*>(&list);
+      const auto* current = reinterpret_cast<const unsigned char*>(&element);
+      return current >= begin && current < begin + sizeof(L);
+    }
+  public:
+    /// <summary>
+    /// Test the empty constructor.
+    /// </summary>
+    TEST_METHOD(ConstructEmpty) {
+      SmallArrayList<const float, 4> list;
+      // Check state.
+      Assert::IsTrue(list.isEmpty());
+      Assert::AreEqual<Size>(0, list.getLength());
+      Assert::AreEqual<Size>(4, list.getCapacity());
+    }
+    /// <summary>
+    /// Test the copy constructor.
+    /// </summary>
+    TEST_METHOD(ConstructCopy) {
+      SmallArrayList<const float, 4> list({ 1.5f, 2.5f, 3.5f }), other(list);
+      // Change values.
+      list.set(0, 10.5f);
+      // Check values.
+      Assert::AreEqual<Size>(3, other.getLength());
+      Assert::AreEqual(1.5f, other[0]);
+      Assert::AreEqual(10.5f, list[0]);
+      Assert::IsTrue(IsInline(other, other[0]));
+    }
+    /// <summary>
+    /// Test the move constructor.
+    /// </summary>
+    TEST_METHOD(ConstructMove) {
+      Size instances = 0;
+      SmallArrayList<Mock, 4> list({ Mock(instances), Mock(instances) });
+      SmallArrayList<Mock, 4> other(Move(list));
+      // Check state.
+      Assert::AreEqual<Size>(2, instances);
+      Assert::IsTrue(list.isEmpty());
+      Assert::AreEqual<Size>(2, other.getLength());
+      Assert::IsTrue(IsInline(other, other[0]));
+    }
+    /// <summary>
+    /// Test the destructor.
+    /// </summary>
+    TEST_METHOD(Destruct) {
+      Size instances = 0;
+      // Create new instances.
+      auto* small = new SmallArrayList<Mock, 4>({ Mock(instances), Mock(instances) });
+      auto* large = new SmallArrayList<Mock, 4>({ Mock(instances), Mock(instances), Mock(instances), Mock(instances), Mock(instances) });
+      Assert::AreEqual<Size>(7, instances);
+      // Delete the instances.
+      delete small;
+      delete large;
+      Assert::AreEqual<Size>(0, instances);
+    }
+    /// <summary>
+    /// Test the spill to the heap feature.
+    /// </summary>
+    TEST_METHOD(FeatureSpill) {
+      SmallArrayList<const float, 4> list({ 1.5f, 2.5f, 3.5f, 4.5f });
+      Assert::IsTrue(IsInline(list, list[0]));
+      // Spill elements.
+      list.add(5.5f);
+      Assert::IsFalse(IsInline(list, list[0]));
+      Assert::AreEqual<Size>(8, list.getCapacity());
+      // Move the elements back inline.
+      list.remove(4);
+      list.remove(3);
+      list.remove(2);
+      Assert::AreEqual<Size>(4, list.getCapacity());
+      Assert::IsTrue(IsInline(list, list[0]));
+      // Check values.
+      Assert::AreEqual(1.5f, list[0]);
+      Assert::AreEqual(2.5f, list[1]);
+    }
+    /// <summary>
+    /// Test the swap feature.
+    /// </summary>
+    TEST_METHOD(FeatureSwap) {
+      Size instances = 0;
+      SmallArrayList<Mock, 2> small({ Mock(instances) });
+      SmallArrayList<Mock, 2> large({ Mock(instances), Mock(instances), Mock(instances) });
+      const auto* heap = &large[0];
+      // Swap lists.
+      Swap(small, large);
+      // Check state.
+      Assert::AreEqual<Size>(4, instances);
+      Assert::AreEqual<Size>(3, small.getLength());
+      Assert::AreEqual<Size>(1, large.getLength());
+      Assert::IsTrue(heap == &small[0]);
+      Assert::IsTrue(IsInline(large, large[0]));
+    }
+  };
+}
@@ -0,0 +1,66 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#include "CppUnitTest.h"
+#include "core.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace SPL::Core::Tests {
+  /// <summary>
+  /// Test class.
+  /// </summary>
+  TEST_CLASS(BinarySearchTests)
+  {
+  private:
+    /// <summary>
+    /// Compare the given values in descending order.
+    /// </summary>
+    /// <param name="source">Source value.</param>
+    /// <param name="target">Target value.</param>
+    /// <returns>Returns the comparison result.</returns>
+    static int Descending(const int& source, const int& target) {
+      return Compare(target, source);
+    }
+  public:
+    /// <summary>
+    /// Test the bound functions for every length and value.
+    /// </summary>
+    TEST_METHOD(FunctionBounds) {
+      int values[64];
+      for (Size length = 0; length <= 64; ++length) {
+        for (Size offset = 0; offset < length; ++offset) {
+          values[offset] = static_cast<int>(offset / 2) * 2;
+        }
+        for (int search = -1; search <= static_cast<int>(length) + 1; ++search) {
+          Index lower = 0, upper = 0;
+          while (lower < length && values[lower] < search) {
+            lower++;
+          }
+          upper = lower;
+          while (upper < length && values[upper] == search) {
+            upper++;
+          }
+          // Check state.
+          Assert::AreEqual(lower, LowerBound(values, length, search));
+          Assert::AreEqual(upper, UpperBound(values, length, search));
+          Assert::AreEqual(lower < upper ? lower : static_cast<Index>(-1), BinarySearch(values, length, search));
+        }
+      }
+    }
+    /// <summary>
+    /// Test the search functions with custom comparators.
+    /// </summary>
+    TEST_METHOD(FunctionComparator) {
+      const int values[] = { 9, 7, 7, 5, 3, 1 };
+      // Check state.
+      Assert::AreEqual<Size>(1, LowerBound<int, &Descending>(values, 6, 7));
+      Assert::AreEqual<Size>(3, UpperBound<int, &Descending>(values, 6, 7));
+      Assert::AreEqual<Size>(4, BinarySearch<int, &Descending>(values, 6, 3));
+      Assert::AreEqual(static_cast<Index>(-1), BinarySearch<int, &Descending>(values, 6, 4));
+      Assert::AreEqual<Size>(6, LowerBound(values, 6, 0, [](const int& source, const int& target) {
+        return Compare(target, source);
+      }));
+    }
+  };
+}
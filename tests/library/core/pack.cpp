@@ -19,7 +19,7 @@ namespace SPL::Core::Tests {
     TEST_METHOD(ConstructEmpty) {
       Pack<int> pack;
       // Check state.
-      Assert::AreEqual(0U, pack.getLength());
+      Assert::AreEqual<Size>(0, pack.getLength());
     }
     /// <summary>
     /// Test the initialized constructor.
@@ -27,7 +27,7 @@ namespace SPL::Core::Tests {
     TEST_METHOD(ConstructInitialized) {
       Pack<int> pack(0, 1, 2);
       // Check state.
-      Assert::AreEqual(3U, pack.getLength());
+      Assert::AreEqual<Size>(3, pack.getLength());
     }
     /// <summary>
     /// Test the copy constructor.
@@ -51,10 +51,10 @@ namespace SPL::Core::Tests {
       Pack<int> other(Move(*pack));
       // Check pack state.
       Assert::IsTrue(pack->isEmpty());
-      Assert::AreEqual(0U, pack->getLength());
+      Assert::AreEqual<Size>(0, pack->getLength());
       // Check other state.
       Assert::IsFalse(other.isEmpty());
-      Assert::AreEqual(3U, other.getLength());
+      Assert::AreEqual<Size>(3, other.getLength());
       // Check other values.
       for (Index index = 0; index < pack->getLength(); ++index) {
         Assert::AreEqual<int>(index, other.get(index));
@@ -97,10 +97,10 @@ namespace SPL::Core::Tests {
       other = Move(*pack);
       // Check pack state.
       Assert::IsTrue(pack->isEmpty());
-      Assert::AreEqual(0U, pack->getLength());
+      Assert::AreEqual<Size>(0, pack->getLength());
       // Check other state.
       Assert::IsFalse(other.isEmpty());
-      Assert::AreEqual(3U, other.getLength());
+      Assert::AreEqual<Size>(3, other.getLength());
       // Check other values.
       for (Index index = 0; index < other.getLength(); ++index) {
         Assert::AreEqual<int>(index, other.get(index));
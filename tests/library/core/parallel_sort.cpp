@@ -0,0 +1,95 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#include "CppUnitTest.h"
+#include "core.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace SPL::Core::Tests {
+  /// <summary>
+  /// Test class.
+  /// </summary>
+  TEST_CLASS(ParallelSortTests)
+  {
+  private:
+    /// <summary>
+    /// Number of values in each test.
+    /// </summary>
+    constexpr static Size Length = 200000;
+    /// <summary>
+    /// Compare the given values in descending order.
+    /// </summary>
+    /// <param name="source">First value.</param>
+    /// <param name="target">Second value.</param>
+    /// <returns>Returns the comparison result.</returns>
+    static int Descending(const int& source, const int& target) {
+      return target - source;
+    }
+    /// <summary>
+    /// Generate a pseudo-random value based on the given seed.
+    /// </summary>
+    /// <param name="seed">Seed reference.</param>
+    /// <returns>Returns the generated value.</returns>
+    static unsigned int Random(unsigned long long& seed) {
+      seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+      return static_cast<unsigned int>(seed >> 33);
+    }
+  public:
+    /// <summary>
+    /// Test the parallel sort function with random values.
+    /// </summary>
+    TEST_METHOD(FunctionRandom) {
+      unsigned long long seed = 1;
+      auto* values = new unsigned int[Length];
+      unsigned long long sum = 0;
+      for (Size offset = 0; offset < Length; ++offset) {
+        sum += values[offset] = Random(seed);
+      }
+      // Sort data.
+      ParallelSort(values, 0, Length - 1, 4);
+      // Check values.
+      for (Size offset = 1; offset < Length; ++offset) {
+        Assert::IsTrue(values[offset - 1] <= values[offset]);
+        sum -= values[offset];
+      }
+      Assert::AreEqual(static_cast<unsigned long long>(values[0]), sum);
+      delete[] values;
+    }
+    /// <summary>
+    /// Test the parallel sort function with many equal values.
+    /// </summary>
+    TEST_METHOD(FunctionEqual) {
+      unsigned long long seed = 2;
+      auto* values = new int[Length];
+      for (Size offset = 0; offset < Length; ++offset) {
+        values[offset] = static_cast<int>(Random(seed) % 3);
+      }
+      // Sort data.
+      ParallelSort<int, &Descending>(values, 0, Length - 1, 8);
+      // Check values.
+      for (Size offset = 1; offset < Length; ++offset) {
+        Assert::IsTrue(values[offset - 1] >= values[offset]);
+      }
+      delete[] values;
+    }
+    /// <summary>
+    /// Test the parallel sort function with a sub-range and the default number of threads.
+    /// </summary>
+    TEST_METHOD(FunctionRange) {
+      auto* values = new int[Length];
+      for (Size offset = 0; offset < Length; ++offset) {
+        values[offset] = static_cast<int>(Length - offset);
+      }
+      // Sort data.
+      ParallelSort(values, 1, Length - 2);
+      // Check values.
+      Assert::AreEqual(static_cast<int>(Length), values[0]);
+      Assert::AreEqual(1, values[Length - 1]);
+      for (Size offset = 1; offset < Length - 1; ++offset) {
+        Assert::AreEqual(static_cast<int>(offset + 1), values[offset]);
+      }
+      delete[] values;
+    }
+  };
+}
@@ -0,0 +1,152 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#include "CppUnitTest.h"
+#include "core.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace SPL::Core::Tests {
+  /// <summary>
+  /// Test class.
+  /// </summary>
+  TEST_CLASS(RadixSortTests)
+  {
+  private:
+    /// <summary>
+    /// Record class.
+    /// </summary>
+    struct Record {
+      /// <summary>
+      /// Record key.
+      /// </summary>
+      short key;
+      /// <summary>
+      /// Record order.
+      /// </summary>
+      Size order;
+    };
+    /// <summary>
+    /// Get the key of the given record.
+    /// </summary>
+    /// <param name="record">Input record.</param>
+    /// <returns>Returns the record key.</returns>
+    static short GetKey(const Record& record) {
+      return record.key;
+    }
+    /// <summary>
+    /// Generate a pseudo-random value based on the given seed.
+    /// </summary>
+    /// <param name="seed">Seed reference.</param>
+    /// <returns>Returns the generated value.</returns>
+    static unsigned long long Random(unsigned long long& seed) {
+      seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+      return seed >> 11;
+    }
+    /// <summary>
+    /// Check whether or not the given values are sorted.
+    /// </summary>
+    /// <typeparam name="T">Value type.</typeparam>
+    /// <param name="array">Array of values.</param>
+    /// <param name="length">Number of values.</param>
+    template<typename T>
+    static void CheckSorted(const T array[], const Size length) {
+      for (Size offset = 1; offset < length; ++offset) {
+        Assert::IsFalse(array[offset] < array[offset - 1]);
+      }
+    }
+  public:
+    /// <summary>
+    /// Test the radix sort function for unsigned integers.
+    /// </summary>
+    TEST_METHOD(FunctionUnsigned) {
+      unsigned long long seed = 1;
+      unsigned int values[1000];
+      for (Size offset = 0; offset < 1000; ++offset) {
+        values[offset] = static_cast<unsigned int>(Random(seed));
+      }
+      // Sort data.
+      RadixSort(values, 1000);
+      CheckSorted(values, 1000);
+    }
+    /// <summary>
+    /// Test the radix sort function for signed integers.
+    /// </summary>
+    TEST_METHOD(FunctionSigned) {
+      unsigned long long seed = 2;
+      int values[1000];
+      long long larges[1000];
+      for (Size offset = 0; offset < 1000; ++offset) {
+        values[offset] = static_cast<int>(Random(seed)) % 500;
+        larges[offset] = static_cast<long long>(Random(seed)) * (offset % 2 == 0 ? -1 : 1);
+      }
+      values[0] = -2147483647 - 1;
+      values[1] = 2147483647;
+      // Sort data.
+      RadixSort(values, 1000);
+      RadixSort(larges, 1000);
+      CheckSorted(values, 1000);
+      CheckSorted(larges, 1000);
+      Assert::AreEqual(-2147483647 - 1, values[0]);
+      Assert::AreEqual(2147483647, values[999]);
+      Assert::IsTrue(larges[0] < 0);
+    }
+    /// <summary>
+    /// Test the radix sort function for decimals.
+    /// </summary>
+    TEST_METHOD(FunctionDecimal) {
+      float values[] = { 2.5f, -0.5f, 1e30f, -1e30f, 0.0f, -3.25f, 1.0f / 0.0f, -1.0f / 0.0f, 0.25f };
+      double larges[] = { 2.5, -0.5, 1e300, -1e300, 0.0, -3.25, 0.25 };
+      // Sort data.
+      RadixSort(values, sizeof(values) / sizeof(float));
+      RadixSort(larges, sizeof(larges) / sizeof(double));
+      // Check values.
+      const float result[] = { -1.0f / 0.0f, -1e30f, -3.25f, -0.5f, 0.0f, 0.25f, 2.5f, 1e30f, 1.0f / 0.0f };
+      for (Index index = 0; index < (sizeof(result) / sizeof(float)); ++index) {
+        Assert::AreEqual(result[index], values[index]);
+      }
+      const double others[] = { -1e300, -3.25, -0.5, 0.0, 0.25, 2.5, 1e300 };
+      for (Index index = 0; index < (sizeof(others) / sizeof(double)); ++index) {
+        Assert::AreEqual(others[index], larges[index]);
+      }
+    }
+    /// <summary>
+    /// Test the radix sort function with a key extractor.
+    /// </summary>
+    TEST_METHOD(FunctionExtractor) {
+      unsigned long long seed = 3;
+      Record records[1000];
+      for (Size offset = 0; offset < 1000; ++offset) {
+        records[offset] = { static_cast<short>(static_cast<int>(Random(seed) % 64) - 32), offset };
+      }
+      // Sort data.
+      RadixSort<&GetKey>(records, 1000);
+      // Check stability.
+      for (Size offset = 1; offset < 1000; ++offset) {
+        Assert::IsTrue(records[offset - 1].key <= records[offset].key);
+        if (records[offset - 1].key == records[offset].key) {
+          Assert::IsTrue(records[offset - 1].order < records[offset].order);
+        }
+      }
+    }
+    /// <summary>
+    /// Test the radix sort function with a scratch buffer.
+    /// </summary>
+    TEST_METHOD(FunctionBuffer) {
+      unsigned char values[] = { 9, 3, 255, 0, 3, 128 };
+      unsigned char buffer[6];
+      // Sort data.
+      RadixSort(values, buffer, 6);
+      // Check values.
+      const unsigned char result[] = { 0, 3, 3, 9, 128, 255 };
+      for (Index index = 0; index < 6; ++index) {
+        Assert::AreEqual(result[index], values[index]);
+      }
+      // Sort the same digits.
+      short same[] = { 7, 7, 7 };
+      short scratch[3];
+      RadixSort(same, scratch, 3);
+      Assert::AreEqual(static_cast<short>(7), same[2]);
+    }
+  };
+}
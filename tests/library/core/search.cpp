@@ -0,0 +1,73 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#include "CppUnitTest.h"
+#include "core.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace SPL::Core::Tests {
+  /// <summary>
+  /// Test class.
+  /// </summary>
+  TEST_CLASS(SearchTests)
+  {
+  private:
+    /// <summary>
+    /// Check all the search functions for every length and position of the given element type.
+    /// </summary>
+    /// <typeparam name="T">Element type.</typeparam>
+    template<typename T>
+    static void CheckAll() {
+      T elements[100];
+      for (Size length = 0; length <= 100; ++length) {
+        for (Size offset = 0; offset < length; ++offset) {
+          elements[offset] = static_cast<T>(1);
+        }
+        // Check the missing element.
+        Assert::AreEqual(static_cast<Index>(-1), Find(elements, length, static_cast<T>(2)));
+        Assert::AreEqual(static_cast<Index>(-1), FindLast(elements, length, static_cast<T>(2)));
+        Assert::AreEqual<Size>(0, Count(elements, length, static_cast<T>(2)));
+        // Check every position.
+        for (Index index = 0; index < length; ++index) {
+          elements[index] = static_cast<T>(2);
+          Assert::AreEqual(index, Find(elements, length, static_cast<T>(2)));
+          Assert::AreEqual(index, FindLast(elements, length, static_cast<T>(2)));
+          Assert::AreEqual<Size>(1, Count(elements, length, static_cast<T>(2)));
+          Assert::AreEqual(length - 1, Count(elements, length, static_cast<T>(1)));
+          elements[index] = static_cast<T>(1);
+        }
+      }
+    }
+  public:
+    /// <summary>
+    /// Test the search functions for integer types.
+    /// </summary>
+    TEST_METHOD(FunctionInteger) {
+      CheckAll<char>();
+      CheckAll<short>();
+      CheckAll<int>();
+      CheckAll<unsigned long long>();
+    }
+    /// <summary>
+    /// Test the search functions for decimal types.
+    /// </summary>
+    TEST_METHOD(FunctionDecimal) {
+      CheckAll<float>();
+      CheckAll<double>();
+    }
+    /// <summary>
+    /// Test the search functions for the first and the last occurrences.
+    /// </summary>
+    TEST_METHOD(FunctionOccurrences) {
+      int elements[70] = {};
+      elements[3] = elements[40] = elements[66] = 7;
+      // Check occurrences.
+      Assert::AreEqual<Size>(3, Find(elements, 70, 7));
+      Assert::AreEqual<Size>(66, FindLast(elements, 70, 7));
+      Assert::AreEqual<Size>(40, FindLast(elements, 66, 7));
+      Assert::AreEqual<Size>(3, Count(elements, 70, 7));
+      Assert::AreEqual<Size>(67, Count(elements, 70, 0));
+    }
+  };
+}
@@ -0,0 +1,219 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#include <algorithm>
+
+#include "CppUnitTest.h"
+#include "core.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace SPL::Core::Tests {
+  /// <summary>
+  /// Test class.
+  /// </summary>
+  TEST_CLASS(SortTests)
+  {
+  private:
+    /// <summary>
+    /// Non-trivial test class.
+    /// </summary>
+    class Boxed : public Comparable<Boxed> {
+    public:
+      /// <summary>
+      /// Number of live instances.
+      /// </summary>
+      static inline Size Instances = 0;
+      /// <summary>
+      /// Boxed value.
+      /// </summary>
+      int* value;
+      /// <summary>
+      /// Initialized constructor.
+      /// </summary>
+      /// <param name="value">Initial value.</param>
+      explicit Boxed(const int value = 0) : value(new int(value)) {
+        Instances++;
+      }
+      /// <summary>
+      /// Copy constructor.
+      /// </summary>
+      /// <param name="other">Other instance.</param>
+      Boxed(const Boxed& other) : Boxed(*other.value) {}
+      /// <summary>
+      /// Destructor.
+      /// </summary>
+      ~Boxed() {
+        delete this->value;
+        Instances--;
+      }
+      /// <summary>
+      /// Compare the instance with the given one.
+      /// </summary>
+      /// <param name="other">Other instance.</param>
+      /// <returns>Returns the comparison result.</returns>
+      int compare(const Boxed& other) const override {
+        return Compare(*this->value, *other.value);
+      }
+      /// <summary>
+      /// Assign the value from the given instance.
+      /// </summary>
+      /// <param name="other">Other instance.</param>
+      /// <returns>Returns the instance itself.</returns>
+      Boxed& operator = (const Boxed& other) {
+        *this->value = *other.value;
+        return *this;
+      }
+    };
+    /// <summary>
+    /// Number of values in each test.
+    /// </summary>
+    constexpr static Size Length = 5000;
+    /// <summary>
+    /// Get the next pseudo-random number.
+    /// </summary>
+    /// <param name="seed">Current seed.</param>
+    /// <returns>Returns the next number.</returns>
+    static unsigned int Random(unsigned int& seed) {
+      seed = seed * 1103515245U + 12345U;
+      return seed >> 8;
+    }
+    /// <summary>
+    /// Compare the given values in descending order.
+    /// </summary>
+    /// <param name="source">Source value.</param>
+    /// <param name="target">Target value.</param>
+    /// <returns>Returns the comparison result.</returns>
+    static int Descending(const int& source, const int& target) {
+      return Compare(target, source);
+    }
+    /// <summary>
+    /// Sort the given values and check them against a copy sorted by the standard library.
+    /// </summary>
+    /// <typeparam name="T">Value type.</typeparam>
+    /// <param name="values">Input values.</param>
+    template<typename T>
+    static void Check(T values[]) {
+      static T expected[Length];
+      std::copy(values, values + Length, expected);
+      std::sort(expected, expected + Length);
+      Sort(values, 0, Length - 1);
+      for (Size offset = 0; offset < Length; ++offset) {
+        Assert::AreEqual(expected[offset], values[offset]);
+      }
+    }
+  public:
+    /// <summary>
+    /// Test the sort function for random values.
+    /// </summary>
+    TEST_METHOD(FunctionRandom) {
+      unsigned int seed = 7;
+      static int values[Length];
+      for (Size offset = 0; offset < Length; ++offset) {
+        values[offset] = static_cast<int>(Random(seed) % 1000000);
+      }
+      Check(values);
+      static double decimals[Length];
+      for (Size offset = 0; offset < Length; ++offset) {
+        decimals[offset] = static_cast<double>(Random(seed) % 1000);
+      }
+      Check(decimals);
+    }
+    /// <summary>
+    /// Test the sort function for input patterns.
+    /// </summary>
+    TEST_METHOD(FunctionPatterns) {
+      static int values[Length];
+      // Sorted.
+      for (Size offset = 0; offset < Length; ++offset) {
+        values[offset] = static_cast<int>(offset);
+      }
+      Check(values);
+      // Reversed.
+      for (Size offset = 0; offset < Length; ++offset) {
+        values[offset] = static_cast<int>(Length - offset);
+      }
+      Check(values);
+      // All equal.
+      for (Size offset = 0; offset < Length; ++offset) {
+        values[offset] = 5;
+      }
+      Check(values);
+      // Organ pipe.
+      for (Size offset = 0; offset < Length; ++offset) {
+        values[offset] = static_cast<int>(offset < Length / 2 ? offset : Length - offset);
+      }
+      Check(values);
+      // Few unique values.
+      for (Size offset = 0; offset < Length; ++offset) {
+        values[offset] = static_cast<int>((offset * 7919) % 4);
+      }
+      Check(values);
+      // Sawtooth.
+      for (Size offset = 0; offset < Length; ++offset) {
+        values[offset] = static_cast<int>(offset % 100);
+      }
+      Check(values);
+    }
+    /// <summary>
+    /// Test the sort function with a custom comparator.
+    /// </summary>
+    TEST_METHOD(FunctionComparator) {
+      unsigned int seed = 13;
+      static int values[Length];
+      for (Size offset = 0; offset < Length; ++offset) {
+        values[offset] = static_cast<int>(Random(seed) % 1000);
+      }
+      Sort<int, &Descending>(values, 0, Length - 1);
+      for (Size offset = 1; offset < Length; ++offset) {
+        Assert::IsTrue(values[offset - 1] >= values[offset]);
+      }
+    }
+    /// <summary>
+    /// Test the sort function with a comparator instance.
+    /// </summary>
+    TEST_METHOD(FunctionLambda) {
+      unsigned int seed = 19;
+      static int values[Length];
+      for (Size offset = 0; offset < Length; ++offset) {
+        values[offset] = static_cast<int>(Random(seed) % 1000);
+      }
+      const int modulo = 10;
+      Sort(values, 0, Length - 1, [modulo](const int& source, const int& target) {
+        return Compare(source % modulo, target % modulo);
+      });
+      for (Size offset = 1; offset < Length; ++offset) {
+        Assert::IsTrue(values[offset - 1] % modulo <= values[offset] % modulo);
+      }
+    }
+    /// <summary>
+    /// Test the sort function for a range.
+    /// </summary>
+    TEST_METHOD(FunctionRange) {
+      int values[] = { 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 };
+      Sort(values, 2, 7);
+      // Check values.
+      const int result[] = { 9, 8, 2, 3, 4, 5, 6, 7, 1, 0 };
+      for (Index index = 0; index < 10; ++index) {
+        Assert::AreEqual(result[index], values[index]);
+      }
+    }
+    /// <summary>
+    /// Test the sort function for non-trivial values.
+    /// </summary>
+    TEST_METHOD(FunctionObjects) {
+      unsigned int seed = 17;
+      auto* values = new Boxed[Length];
+      for (Size offset = 0; offset < Length; ++offset) {
+        *values[offset].value = static_cast<int>(Random(seed) % 100);
+      }
+      Sort(values, 0, Length - 1);
+      Assert::AreEqual(Length, Boxed::Instances);
+      for (Size offset = 1; offset < Length; ++offset) {
+        Assert::IsTrue(*values[offset - 1].value <= *values[offset].value);
+      }
+      delete[] values;
+      Assert::AreEqual<Size>(0, Boxed::Instances);
+    }
+  };
+}
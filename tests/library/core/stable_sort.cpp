@@ -0,0 +1,160 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#include "CppUnitTest.h"
+#include "core.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace SPL::Core::Tests {
+  /// <summary>
+  /// Test class.
+  /// </summary>
+  TEST_CLASS(StableSortTests)
+  {
+  private:
+    /// <summary>
+    /// Record class.
+    /// </summary>
+    class Record : public Comparable<Record> {
+    public:
+      /// <summary>
+      /// Record key.
+      /// </summary>
+      int key;
+      /// <summary>
+      /// Record order.
+      /// </summary>
+      Size order;
+      /// <summary>
+      /// Compare the instance with the given one (by key only).
+      /// </summary>
+      /// <param name="other">Other instance.</param>
+      /// <returns>Returns the comparison result.</returns>
+      int compare(const Record& other) const override {
+        return Compare(this->key, other.key);
+      }
+    };
+    /// <summary>
+    /// Number of values in each test.
+    /// </summary>
+    constexpr static Size Length = 5000;
+    /// <summary>
+    /// Get the next pseudo-random number.
+    /// </summary>
+    /// <param name="seed">Current seed.</param>
+    /// <returns>Returns the next number.</returns>
+    static unsigned int Random(unsigned int& seed) {
+      seed = seed * 1103515245U + 12345U;
+      return seed >> 8;
+    }
+    /// <summary>
+    /// Set the order of all the given records.
+    /// </summary>
+    /// <param name="records">Input records.</param>
+    static void Prepare(Record records[]) {
+      for (Size offset = 0; offset < Length; ++offset) {
+        records[offset].order = offset;
+      }
+    }
+    /// <summary>
+    /// Sort the given records and check the order of their keys and the order of equal keys.
+    /// </summary>
+    /// <param name="records">Input records.</param>
+    static void Check(Record records[]) {
+      Prepare(records);
+      StableSort(records, 0, Length - 1);
+      for (Size offset = 1; offset < Length; ++offset) {
+        Assert::IsTrue(records[offset - 1].key <= records[offset].key);
+        if (records[offset - 1].key == records[offset].key) {
+          Assert::IsTrue(records[offset - 1].order < records[offset].order);
+        }
+      }
+    }
+  public:
+    /// <summary>
+    /// Test the stable sort function for random values.
+    /// </summary>
+    TEST_METHOD(FunctionRandom) {
+      unsigned int seed = 7;
+      static Record records[Length];
+      for (Size offset = 0; offset < Length; ++offset) {
+        records[offset].key = static_cast<int>(Random(seed) % 100);
+      }
+      Check(records);
+      for (Size offset = 0; offset < Length; ++offset) {
+        records[offset].key = static_cast<int>(Random(seed));
+      }
+      Check(records);
+    }
+    /// <summary>
+    /// Test the stable sort function for input patterns.
+    /// </summary>
+    TEST_METHOD(FunctionPatterns) {
+      static Record records[Length];
+      // Sorted.
+      for (Size offset = 0; offset < Length; ++offset) {
+        records[offset].key = static_cast<int>(offset / 3);
+      }
+      Check(records);
+      // Reversed.
+      for (Size offset = 0; offset < Length; ++offset) {
+        records[offset].key = static_cast<int>((Length - offset) / 3);
+      }
+      Check(records);
+      // All equal.
+      for (Size offset = 0; offset < Length; ++offset) {
+        records[offset].key = 5;
+      }
+      Check(records);
+      // Organ pipe.
+      for (Size offset = 0; offset < Length; ++offset) {
+        records[offset].key = static_cast<int>(offset < Length / 2 ? offset : Length - offset);
+      }
+      Check(records);
+      // Sawtooth.
+      for (Size offset = 0; offset < Length; ++offset) {
+        records[offset].key = static_cast<int>(offset % 700);
+      }
+      Check(records);
+      // Descending runs.
+      for (Size offset = 0; offset < Length; ++offset) {
+        records[offset].key = static_cast<int>(1000 - offset % 1000);
+      }
+      Check(records);
+    }
+    /// <summary>
+    /// Test the stable sort function with a comparator instance.
+    /// </summary>
+    TEST_METHOD(FunctionLambda) {
+      unsigned int seed = 13;
+      static Record records[Length];
+      for (Size offset = 0; offset < Length; ++offset) {
+        records[offset].key = static_cast<int>(Random(seed) % 1000);
+      }
+      Prepare(records);
+      // Sort by the secondary field.
+      StableSort(records, 0, Length - 1, [](const Record& source, const Record& target) {
+        return Compare(source.key % 10, target.key % 10);
+      });
+      for (Size offset = 1; offset < Length; ++offset) {
+        Assert::IsTrue(records[offset - 1].key % 10 <= records[offset].key % 10);
+        if (records[offset - 1].key % 10 == records[offset].key % 10) {
+          Assert::IsTrue(records[offset - 1].order < records[offset].order);
+        }
+      }
+    }
+    /// <summary>
+    /// Test the stable sort function for a range.
+    /// </summary>
+    TEST_METHOD(FunctionRange) {
+      int values[] = { 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 };
+      StableSort(values, 2, 7);
+      // Check values.
+      const int result[] = { 9, 8, 2, 3, 4, 5, 6, 7, 1, 0 };
+      for (Index index = 0; index < 10; ++index) {
+        Assert::AreEqual(result[index], values[index]);
+      }
+    }
+  };
+}
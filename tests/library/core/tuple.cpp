@@ -19,7 +19,7 @@ namespace SPL::Core::Tests {
     TEST_METHOD(ConstructEmpty) {
       Tuple<int> tuple;
       // Check state.
-      Assert::AreEqual(1U, tuple.getLength());
+      Assert::AreEqual<Size>(1, tuple.getLength());
     }
     /// <summary>
     /// Test the initialized constructor.
@@ -27,7 +27,7 @@ namespace SPL::Core::Tests {
     TEST_METHOD(ConstructInitialized) {
       Tuple tuple(10, 1.0f, true);
       // Check state.
-      Assert::AreEqual(3U, tuple.getLength());
+      Assert::AreEqual<Size>(3, tuple.getLength());
     }
     /// <summary>
     /// Test the copy constructor.
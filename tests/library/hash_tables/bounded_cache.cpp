@@ -0,0 +1,228 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#include "../mock.hpp"
+#include "CppUnitTest.h"
+#include "interfaces.hpp"
+#include "hash_tables.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace SPL::Tests;
+
+namespace SPL::Tests {
+  /// <summary>
+  /// Test class.
+  /// </summary>
+  TEST_CLASS(BoundedCacheTests)
+  {
+  private:
+    /// <summary>
+    /// Last evicted key.
+    /// </summary>
+    static inline int evicted = 0;
+    /// <summary>
+    /// Eviction callback.
+    /// </summary>
+    /// <param name="key">Evicted key.</param>
+    /// <param name="value">Evicted value.</param>
+    static void OnEvict(const int& key, float& value) {
+      evicted = key;
+    }
+  public:
+    /// <summary>
+    /// Test the capacity constructor.
+    /// </summary>
+    TEST_METHOD(ConstructCapacity) {
+      BoundedCache<int, float> cache(3);
+      // Check state.
+      Assert::IsTrue(cache.isEmpty());
+      Assert::AreEqual<Size>(0, cache.getSize());
+      Assert::AreEqual<Size>(3, cache.getCapacity());
+      Assert::AreEqual<Size>(0, cache.getHits());
+      Assert::AreEqual<Size>(0, cache.getMisses());
+      Assert::AreEqual<Size>(0, cache.getEvictions());
+    }
+    /// <summary>
+    /// Test the copy constructor.
+    /// </summary>
+    TEST_METHOD(ConstructCopy) {
+      BoundedCache<int, float> cache(3);
+      cache.put(1, 1.5f);
+      cache.put(2, 2.5f);
+      BoundedCache<int, float> other(cache);
+      // Check copy state.
+      Assert::AreEqual(cache.getSize(), other.getSize());
+      Assert::AreEqual(cache.getCapacity(), other.getCapacity());
+      // Change values.
+      cache.put(1, 10.5f);
+      // Check other values.
+      Assert::AreEqual(1.5f, other.get(1));
+      Assert::AreEqual(2.5f, other.get(2));
+    }
+    /// <summary>
+    /// Test the destructor.
+    /// </summary>
+    TEST_METHOD(Destruct) {
+      Size instances = 0;
+      // Create a new instance.
+      auto* cache = new BoundedCache<int, Mock>(2);
+      cache->put(1, Mock(instances));
+      cache->put(2, Mock(instances));
+      cache->put(3, Mock(instances));
+      Assert::AreEqual<Size>(2, instances);
+      // Delete the instance.
+      delete cache;
+      Assert::AreEqual<Size>(0, instances);
+    }
+    /// <summary>
+    /// Test the put method.
+    /// </summary>
+    TEST_METHOD(MethodPut) {
+      BoundedCache<int, float> cache(3);
+      // Put new values.
+      cache.put(1, 1.5f);
+      cache.put(2, 2.5f);
+      // Replace an existing value.
+      const float value = 3.5f;
+      cache.put(2, value);
+      // Check new state.
+      Assert::IsFalse(cache.isEmpty());
+      Assert::AreEqual<Size>(2, cache.getSize());
+      Assert::AreEqual(1.5f, cache.get(1));
+      Assert::AreEqual(3.5f, cache.get(2));
+      Assert::AreEqual<Size>(0, cache.getEvictions());
+    }
+    /// <summary>
+    /// Test the get method (by return).
+    /// </summary>
+    TEST_METHOD(MethodGetByReturn) {
+      BoundedCache<int, float> cache(3);
+      cache.put(1, 1.5f);
+      // Check undefined value.
+      Assert::ExpectException<SPL::Exceptions::KeyNotFound<int>>([&cache] {
+        cache.get(2);
+      });
+      // Check value.
+      Assert::AreEqual(1.5f, cache.get(1));
+      // Check counters.
+      Assert::AreEqual<Size>(1, cache.getHits());
+      Assert::AreEqual<Size>(1, cache.getMisses());
+    }
+    /// <summary>
+    /// Test the get method (by reference).
+    /// </summary>
+    TEST_METHOD(MethodGetByReference) {
+      BoundedCache<int, float> cache(3);
+      cache.put(1, 1.5f);
+      float value;
+      // Check undefined value.
+      Assert::IsFalse(cache.get(2, value));
+      // Check value.
+      Assert::IsTrue(cache.get(1, value));
+      Assert::AreEqual(1.5f, value);
+      // Check counters.
+      Assert::AreEqual<Size>(1, cache.getHits());
+      Assert::AreEqual<Size>(1, cache.getMisses());
+    }
+    /// <summary>
+    /// Test the has method.
+    /// </summary>
+    TEST_METHOD(MethodHas) {
+      BoundedCache<int, float> cache(3);
+      cache.put(1, 1.5f);
+      // Check keys.
+      Assert::IsTrue(cache.has(1));
+      Assert::IsFalse(cache.has(2));
+      // Check counters.
+      Assert::AreEqual<Size>(0, cache.getHits());
+      Assert::AreEqual<Size>(0, cache.getMisses());
+    }
+    /// <summary>
+    /// Test the remove method.
+    /// </summary>
+    TEST_METHOD(MethodRemove) {
+      BoundedCache<int, float> cache(3);
+      cache.put(1, 1.5f);
+      cache.put(2, 2.5f);
+      // Check undefined value.
+      Assert::IsFalse(cache.remove(3));
+      // Remove the first value.
+      Assert::IsTrue(cache.remove(1));
+      Assert::AreEqual<Size>(1, cache.getSize());
+      Assert::IsFalse(cache.has(1));
+      Assert::IsTrue(cache.has(2));
+      Assert::AreEqual<Size>(0, cache.getEvictions());
+    }
+    /// <summary>
+    /// Test the clear method.
+    /// </summary>
+    TEST_METHOD(MethodClear) {
+      BoundedCache<int, float> cache(3);
+      cache.put(1, 1.5f);
+      cache.put(2, 2.5f);
+      // Clear data.
+      cache.clear();
+      // Check new state.
+      Assert::IsTrue(cache.isEmpty());
+      Assert::AreEqual<Size>(0, cache.getSize());
+      Assert::AreEqual<Size>(3, cache.getCapacity());
+      Assert::IsFalse(cache.has(1));
+      Assert::IsFalse(cache.has(2));
+    }
+    /// <summary>
+    /// Test the eviction feature.
+    /// </summary>
+    TEST_METHOD(FeatureEviction) {
+      BoundedCache<int, float> cache(3);
+      cache.put(1, 1.5f);
+      cache.put(2, 2.5f);
+      cache.put(3, 3.5f);
+      // Reference the first and the third values.
+      cache.get(1);
+      cache.get(3);
+      // Put a new value.
+      cache.put(4, 4.5f);
+      // Check new state.
+      Assert::AreEqual<Size>(3, cache.getSize());
+      Assert::AreEqual<Size>(1, cache.getEvictions());
+      Assert::IsTrue(cache.has(1));
+      Assert::IsFalse(cache.has(2)); // <~ The only one without a second chance.
+      Assert::IsTrue(cache.has(3));
+      Assert::IsTrue(cache.has(4));
+    }
+    /// <summary>
+    /// Test the eviction callback feature.
+    /// </summary>
+    TEST_METHOD(FeatureCallback) {
+      BoundedCache<int, float> cache(2, &OnEvict);
+      evicted = 0;
+      // Put values until the first eviction.
+      cache.put(1, 1.5f);
+      cache.put(2, 2.5f);
+      Assert::AreEqual(0, evicted);
+      cache.put(3, 3.5f);
+      // Check the evicted key.
+      Assert::AreNotEqual(0, evicted);
+      Assert::AreNotEqual(3, evicted);
+      Assert::IsFalse(cache.has(evicted));
+      Assert::IsTrue(cache.has(3));
+      Assert::AreEqual<Size>(1, cache.getEvictions());
+    }
+    /// <summary>
+    /// Test the bounded size feature.
+    /// </summary>
+    TEST_METHOD(FeatureBounded) {
+      BoundedCache<int, int> cache(16);
+      // Put a lot more values than the capacity.
+      for (int key = 0; key < 1000; ++key) {
+        cache.put(key, key * 2);
+        Assert::IsTrue(cache.getSize() <= 16U);
+      }
+      // Check new state.
+      Assert::AreEqual<Size>(16, cache.getSize());
+      Assert::AreEqual<Size>(984, cache.getEvictions());
+      Assert::IsTrue(cache.has(999));
+      Assert::AreEqual(1998, cache.get(999));
+    }
+  };
+}
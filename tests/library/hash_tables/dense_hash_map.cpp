@@ -0,0 +1,348 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#include "../mock.hpp"
+#include "CppUnitTest.h"
+#include "interfaces.hpp"
+#include "hash_tables.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace SPL::Tests;
+
+namespace SPL::Tests {
+  /// <summary>
+  /// Test class.
+  /// </summary>
+  TEST_CLASS(DenseHashMapTests)
+  {
+  public:
+    /// <summary>
+    /// Test the empty constructor.
+    /// </summary>
+    TEST_METHOD(ConstructEmpty) {
+      DenseHashMap<unsigned long long, float> map;
+      // Check state.
+      Assert::IsTrue(map.isEmpty());
+      Assert::AreEqual<Size>(0, map.getSize());
+      Assert::AreEqual<Size>(0, map.getCapacity());
+      Assert::AreEqual(1.0f, map.getLoadFactor());
+    }
+    /// <summary>
+    /// Test the capacity constructor.
+    /// </summary>
+    TEST_METHOD(ConstructCapacity) {
+      DenseHashMap<unsigned long long, float> map(5);
+      // Check state.
+      Assert::IsTrue(map.isEmpty());
+      Assert::AreEqual<Size>(0, map.getSize());
+      Assert::AreEqual<Size>(8, map.getCapacity());
+      Assert::AreEqual(0.0f, map.getLoadFactor());
+    }
+    /// <summary>
+    /// Test the initialized constructor.
+    /// </summary>
+    TEST_METHOD(ConstructPairs) {
+      DenseHashMap<unsigned long long, float> map({ { 10, 1.5f }, { 20, 2.5f }, { 30, 3.5f } });
+      // Check state.
+      Assert::IsFalse(map.isEmpty());
+      Assert::AreEqual<Size>(3, map.getSize());
+      Assert::AreEqual<Size>(8, map.getCapacity());
+    }
+    /// <summary>
+    /// Test the copy constructor.
+    /// </summary>
+    TEST_METHOD(ConstructCopy) {
+      const Pair<unsigned long long, float> pairs[] = { { 10, 1.5f }, { 20, 2.5f }, { 30, 3.5f } };
+      DenseHashMap<unsigned long long, float> map(pairs), other(map);
+      // Check copy state.
+      Assert::AreEqual(map.getSize(), other.getSize());
+      Assert::AreEqual(map.getCapacity(), other.getCapacity());
+      // Check copy values.
+      for (const Pair<unsigned long long, float>& pair : pairs) {
+        Assert::AreEqual(map.get(pair.key), other.get(pair.key));
+      }
+      // Change values.
+      map.set(10, 10.5f);
+      // Check other values.
+      Assert::AreNotEqual(map.get(10), other.get(10));
+      Assert::AreEqual(map.get(20), other.get(20));
+    }
+    /// <summary>
+    /// Test the move constructor.
+    /// </summary>
+    TEST_METHOD(ConstructMove) {
+      const Pair<unsigned long long, float> pairs[] = { { 10, 1.5f }, { 20, 2.5f }, { 30, 3.5f } };
+      DenseHashMap<unsigned long long, float> map(pairs), other(Move(map));
+      // Check map state.
+      Assert::IsTrue(map.isEmpty());
+      Assert::AreEqual<Size>(0, map.getCapacity());
+      Assert::IsFalse(map.has(10));
+      // Check other values.
+      Assert::AreEqual<Size>(3, other.getSize());
+      for (const Pair<unsigned long long, float>& pair : pairs) {
+        Assert::AreEqual(pair.value, other.get(pair.key));
+      }
+    }
+    /// <summary>
+    /// Test the destructor.
+    /// </summary>
+    TEST_METHOD(Destruct) {
+      Size instances = 0;
+      // Create a new instance.
+      SPL::Map<int, Mock>* map = new DenseHashMap<int, Mock>({
+          { 1, Mock(instances) },
+          { 2, Mock(instances) },
+          { 3, Mock(instances) }
+        });
+      Assert::AreEqual<Size>(3, instances);
+      // Delete the instance.
+      delete map;
+      // Check state.
+      Assert::AreEqual<Size>(0, instances);
+    }
+    /// <summary>
+    /// Test the set method.
+    /// </summary>
+    TEST_METHOD(MethodSet) {
+      const Pair<unsigned long long, float> pairs[] = { { 10, 1.5f }, { 20, 2.5f }, { 30, 3.5f } };
+      DenseHashMap<unsigned long long, float> map(pairs);
+      // Map new values.
+      for (const Pair<unsigned long long, float>& pair : pairs) {
+        Assert::AreEqual(pair.value, map.set(pair.key, pair.value + 0.5f));
+      }
+      Assert::AreEqual(0.0f, map.set(0, 5.0f));
+      // Check new state.
+      Assert::AreEqual<Size>(4, map.getSize());
+      // Check new values.
+      const Pair<unsigned long long, float> result[] = { { 10, 2.0f }, { 20, 3.0f }, { 30, 4.0f }, { 0, 5.0f } };
+      for (const Pair<unsigned long long, float>& pair : result) {
+        Assert::AreEqual(pair.value, map.get(pair.key));
+      }
+      // Check reserved keys.
+      Assert::ExpectException<SPL::Exceptions::InvalidArgument>([&map] {
+        map.set(static_cast<unsigned long long>(-1), 1.0f);
+      });
+      Assert::ExpectException<SPL::Exceptions::InvalidArgument>([&map] {
+        map.set(static_cast<unsigned long long>(-2), 1.0f);
+      });
+    }
+    /// <summary>
+    /// Test the get method (by return).
+    /// </summary>
+    TEST_METHOD(MethodGetByReturn) {
+      const Pair<unsigned long long, float> pairs[] = { { 10, 1.5f }, { 20, 2.5f }, { 30, 3.5f } };
+      DenseHashMap<unsigned long long, float> map(pairs);
+      // Check undefined value.
+      Assert::ExpectException<SPL::Exceptions::KeyNotFound<unsigned long long>>([&map] {
+        Assert::AreEqual(0.0f, map.get(40));
+      });
+      Assert::ExpectException<SPL::Exceptions::KeyNotFound<unsigned long long>>([&map] {
+        Assert::AreEqual(0.0f, map.get(static_cast<unsigned long long>(-1)));
+      });
+      // Check values.
+      for (const Pair<unsigned long long, float>& pair : pairs) {
+        Assert::AreEqual(pair.value, map.get(pair.key));
+      }
+    }
+    /// <summary>
+    /// Test the get method (by reference).
+    /// </summary>
+    TEST_METHOD(MethodGetByReference) {
+      const Pair<unsigned long long, float> pairs[] = { { 10, 1.5f }, { 20, 2.5f }, { 30, 3.5f } };
+      DenseHashMap<unsigned long long, float> map(pairs);
+      float value;
+      // Check undefined value.
+      Assert::IsFalse(map.get(40, value));
+      Assert::IsFalse(map.get(static_cast<unsigned long long>(-2), value));
+      // Check values.
+      for (const Pair<unsigned long long, float>& pair : pairs) {
+        Assert::IsTrue(map.get(pair.key, value));
+        Assert::AreEqual(pair.value, value);
+      }
+    }
+    /// <summary>
+    /// Test the get method (by iterator).
+    /// </summary>
+    TEST_METHOD(MethodGetByIterator) {
+      DenseHashMap<int, int> map;
+      for (int key = 0; key < 500; ++key) {
+        map.set(key, key * 2);
+      }
+      // Check all values in the slot order.
+      auto iterator = map.getIterator();
+      Size count = 0;
+      while (iterator->hasNext()) {
+        const auto& current = iterator->next();
+        Assert::AreEqual(current.key * 2, current.value);
+        count++;
+      }
+      Assert::AreEqual<Size>(500, count);
+    }
+    /// <summary>
+    /// Test the has method.
+    /// </summary>
+    TEST_METHOD(MethodHas) {
+      const Pair<unsigned long long, float> pairs[] = { { 10, 1.5f }, { 20, 2.5f }, { 30, 3.5f } };
+      DenseHashMap<unsigned long long, float> map(pairs);
+      // Check undefined value.
+      Assert::IsFalse(map.has(40));
+      Assert::IsFalse(map.has(static_cast<unsigned long long>(-1)));
+      // Check values.
+      for (const Pair<unsigned long long, float>& pair : pairs) {
+        Assert::IsTrue(map.has(pair.key));
+      }
+    }
+    /// <summary>
+    /// Test the remove method (with return).
+    /// </summary>
+    TEST_METHOD(MethodRemoveWithReturn) {
+      DenseHashMap<unsigned long long, float> map({ { 10, 1.5f }, { 20, 2.5f }, { 30, 3.5f } });
+      // Check undefined value.
+      Assert::ExpectException<SPL::Exceptions::KeyNotFound<unsigned long long>>([&map] {
+        Assert::AreEqual(0.0f, map.remove(40));
+      });
+      // Remove the values.
+      Assert::AreEqual(2.5f, map.remove(20));
+      Assert::AreEqual<Size>(2, map.getSize());
+      Assert::IsFalse(map.has(20));
+      Assert::IsTrue(map.has(10));
+      Assert::IsTrue(map.has(30));
+      Assert::AreEqual(3.5f, map.remove(30));
+      Assert::AreEqual(1.5f, map.remove(10));
+      Assert::IsTrue(map.isEmpty());
+    }
+    /// <summary>
+    /// Test the remove method (with reference).
+    /// </summary>
+    TEST_METHOD(MethodRemoveWithReference) {
+      DenseHashMap<unsigned long long, float> map({ { 10, 1.5f }, { 20, 2.5f }, { 30, 3.5f } });
+      float value;
+      // Check undefined value.
+      Assert::IsFalse(map.remove(40, value));
+      // Remove the values.
+      Assert::IsTrue(map.remove(20, value));
+      Assert::AreEqual(2.5f, value);
+      Assert::AreEqual<Size>(2, map.getSize());
+      Assert::IsFalse(map.has(20));
+      Assert::IsTrue(map.remove(30, value));
+      Assert::AreEqual(3.5f, value);
+      Assert::IsTrue(map.remove(10, value));
+      Assert::AreEqual(1.5f, value);
+      Assert::IsTrue(map.isEmpty());
+    }
+    /// <summary>
+    /// Test the clear method.
+    /// </summary>
+    TEST_METHOD(MethodClear) {
+      const Pair<unsigned long long, float> pairs[] = { { 10, 1.5f }, { 20, 2.5f }, { 30, 3.5f } };
+      DenseHashMap<unsigned long long, float> map(pairs);
+      // Clear data.
+      map.clear();
+      // Check new state.
+      Assert::IsTrue(map.isEmpty());
+      Assert::AreEqual<Size>(0, map.getSize());
+      Assert::AreEqual<Size>(8, map.getCapacity());
+      for (const Pair<unsigned long long, float>& pair : pairs) {
+        Assert::IsFalse(map.has(pair.key));
+      }
+    }
+    /// <summary>
+    /// Test the access operator.
+    /// </summary>
+    TEST_METHOD(OperatorAccess) {
+      DenseHashMap<int, float> map;
+      // Create new values.
+      map[-5] = 1.5f;
+      map[5] = 2.5f;
+      // Check values.
+      Assert::AreEqual<Size>(2, map.getSize());
+      Assert::AreEqual(1.5f, map[-5]);
+      Assert::AreEqual(2.5f, map[5]);
+      Assert::ExpectException<SPL::Exceptions::InvalidArgument>([&map] {
+        map[-1] = 1.0f;
+      });
+    }
+    /// <summary>
+    /// Test the custom reserved keys feature.
+    /// </summary>
+    TEST_METHOD(FeatureReservedKeys) {
+      DenseHashMap<int, int, 0, 1> map;
+      // Set negative keys (allowed now).
+      map.set(-1, 10);
+      map.set(-2, 20);
+      Assert::AreEqual(10, map.get(-1));
+      Assert::AreEqual(20, map.get(-2));
+      // Check the new reserved keys.
+      Assert::ExpectException<SPL::Exceptions::InvalidArgument>([&map] {
+        map.set(0, 1);
+      });
+      Assert::ExpectException<SPL::Exceptions::InvalidArgument>([&map] {
+        map.set(1, 1);
+      });
+    }
+    /// <summary>
+    /// Test the enlarge and shrink capacity features.
+    /// </summary>
+    TEST_METHOD(FeatureResize) {
+      DenseHashMap<unsigned long long, unsigned long long> map;
+      // Map a lot of values.
+      for (unsigned long long key = 0; key < 10000; ++key) {
+        map.set(key << 20, key);
+      }
+      Assert::AreEqual<Size>(10000, map.getSize());
+      Assert::AreEqual<Size>(16384, map.getCapacity());
+      for (unsigned long long key = 0; key < 10000; ++key) {
+        Assert::AreEqual(key, map.get(key << 20));
+      }
+      // Remove almost all values.
+      for (unsigned long long key = 10; key < 10000; ++key) {
+        Assert::AreEqual(key, map.remove(key << 20));
+      }
+      Assert::AreEqual<Size>(10, map.getSize());
+      Assert::AreEqual<Size>(32, map.getCapacity());
+      for (unsigned long long key = 0; key < 10; ++key) {
+        Assert::AreEqual(key, map.get(key << 20));
+      }
+    }
+    /// <summary>
+    /// Test the deleted entries feature.
+    /// </summary>
+    TEST_METHOD(FeatureDeleted) {
+      DenseHashMap<int, int> map;
+      // Set and remove many different keys keeping the same size.
+      for (int key = 0; key < 5000; ++key) {
+        map.set(key, key);
+        if (key >= 20) {
+          Assert::AreEqual(key - 20, map.remove(key - 20));
+        }
+      }
+      // Check new state.
+      Assert::AreEqual<Size>(20, map.getSize());
+      Assert::IsTrue(map.getCapacity() <= 64U);
+      for (int key = 4980; key < 5000; ++key) {
+        Assert::AreEqual(key, map.get(key));
+      }
+    }
+    /// <summary>
+    /// Test the range-based loop.
+    /// </summary>
+    TEST_METHOD(FeatureRangeFor) {
+      DenseHashMap<int, int> map;
+      for (int key = 0; key < 500; ++key) {
+        map.set(key, key * 2);
+      }
+      map.remove(10);
+      // Check all values in the slot order.
+      Size count = 0;
+      for (const auto& entry : map) {
+        Assert::AreEqual(entry.key * 2, entry.value);
+        Assert::AreNotEqual(10, entry.key);
+        count++;
+      }
+      Assert::AreEqual<Size>(499, count);
+      for (const auto& entry : DenseHashMap<int, int>()) {
+        Assert::Fail();
+      }
+    }
+  };
+}
@@ -1,6 +1,9 @@
 /// Copyright (c) 2020 Silas B. Domingos
 /// This source code is licensed under the MIT License as described in the file LICENSE.
 ///
+#include <algorithm>
+#include <iterator>
+
 #include "../mock.hpp"
 #include "CppUnitTest.h"
 #include "interfaces.hpp"
@@ -23,8 +26,8 @@ namespace SPL::Tests {
       HashMap<const char*, float> map;
       // Check state.
       Assert::IsTrue(map.isEmpty());
-      Assert::AreEqual(0U, map.getSize());
-      Assert::AreEqual(0U, map.getCapacity());
+      Assert::AreEqual<Size>(0, map.getSize());
+      Assert::AreEqual<Size>(0, map.getCapacity());
       Assert::AreEqual(1.0f, map.getLoadFactor());
     }
     /// <summary>
@@ -34,8 +37,8 @@ namespace SPL::Tests {
       HashMap<const char*, float> map(8);
       // Check state.
       Assert::IsTrue(map.isEmpty());
-      Assert::AreEqual(0U, map.getSize());
-      Assert::AreEqual(8U, map.getCapacity());
+      Assert::AreEqual<Size>(0, map.getSize());
+      Assert::AreEqual<Size>(8, map.getCapacity());
       Assert::AreEqual(0.0f, map.getLoadFactor());
     }
     /// <summary>
@@ -45,8 +48,8 @@ namespace SPL::Tests {
       HashMap<const char*, float> map({ { "abc", 1.5f }, { "def", 2.5f }, { "ghi", 3.5f } });
       // Check state.
       Assert::IsFalse(map.isEmpty());
-      Assert::AreEqual(3U, map.getSize());
-      Assert::AreEqual(4U, map.getCapacity());
+      Assert::AreEqual<Size>(3, map.getSize());
+      Assert::AreEqual<Size>(4, map.getCapacity());
       Assert::AreEqual(0.75f, map.getLoadFactor());
     }
     /// <summary>
@@ -80,8 +83,8 @@ namespace SPL::Tests {
       HashMap<const char*, float> map(pairs), other(Move(map));
       // Check map state.
       Assert::IsTrue(map.isEmpty());
-      Assert::AreEqual(0U, map.getSize());
-      Assert::AreEqual(0U, map.getCapacity());
+      Assert::AreEqual<Size>(0, map.getSize());
+      Assert::AreEqual<Size>(0, map.getCapacity());
       Assert::AreEqual(1.0f, map.getLoadFactor());
       // Check map values.
       for (const Pair<const char*, float>& pair : pairs) {
@@ -89,8 +92,8 @@ namespace SPL::Tests {
       }
       // Check other state.
       Assert::IsFalse(other.isEmpty());
-      Assert::AreEqual(3U, other.getSize());
-      Assert::AreEqual(4U, other.getCapacity());
+      Assert::AreEqual<Size>(3, other.getSize());
+      Assert::AreEqual<Size>(4, other.getCapacity());
       Assert::AreEqual(0.75f, other.getLoadFactor());
       // Check other values.
       for (const Pair<const char*, float>& pair : pairs) {
@@ -108,11 +111,11 @@ namespace SPL::Tests {
           { "def", Mock(instances) },
           { "ghi", Mock(instances) }
         });
-      Assert::AreEqual(3U, instances);
+      Assert::AreEqual<Size>(3, instances);
       // Delete the instance.
       delete map;
       // Check state.
-      Assert::AreEqual(0U, instances);
+      Assert::AreEqual<Size>(0, instances);
     }
     /// <summary>
     /// Test the set method.
@@ -122,8 +125,8 @@ namespace SPL::Tests {
       HashMap<const char*, float> map(pairs);
       // Check state.
       Assert::IsFalse(map.isEmpty());
-      Assert::AreEqual(3U, map.getSize());
-      Assert::AreEqual(4U, map.getCapacity());
+      Assert::AreEqual<Size>(3, map.getSize());
+      Assert::AreEqual<Size>(4, map.getCapacity());
       Assert::AreEqual(0.75f, map.getLoadFactor());
       // Map new values.
       for (const Pair<const char*, float>& pair : pairs) {
@@ -132,8 +135,8 @@ namespace SPL::Tests {
       Assert::AreEqual(0.0f, map.set("jkl", 5.0f));
       // Check new state.
       Assert::IsFalse(map.isEmpty());
-      Assert::AreEqual(4U, map.getSize());
-      Assert::AreEqual(8U, map.getCapacity());
+      Assert::AreEqual<Size>(4, map.getSize());
+      Assert::AreEqual<Size>(8, map.getCapacity());
       Assert::AreEqual(0.5f, map.getLoadFactor());
       // Check new values.
       const Pair<const char*, float> result[] = { { "abc", 2.0f }, { "def", 3.0f }, { "ghi", 4.0f}, { "jkl", 5.0f} };
@@ -149,8 +152,8 @@ namespace SPL::Tests {
       HashMap<const char*, float> map(pairs);
       // Check state.
       Assert::IsFalse(map.isEmpty());
-      Assert::AreEqual(3U, map.getSize());
-      Assert::AreEqual(4U, map.getCapacity());
+      Assert::AreEqual<Size>(3, map.getSize());
+      Assert::AreEqual<Size>(4, map.getCapacity());
       Assert::AreEqual(0.75f, map.getLoadFactor());
       // Check undefined value.
       Assert::ExpectException<SPL::Exceptions::KeyNotFound<const char*>>([&map] {
@@ -173,8 +176,8 @@ namespace SPL::Tests {
       float value;
       // Check state.
       Assert::IsFalse(map.isEmpty());
-      Assert::AreEqual(3U, map.getSize());
-      Assert::AreEqual(4U, map.getCapacity());
+      Assert::AreEqual<Size>(3, map.getSize());
+      Assert::AreEqual<Size>(4, map.getCapacity());
       Assert::AreEqual(0.75f, map.getLoadFactor());
       // Check undefined value.
       Assert::IsFalse(map.get(nullptr, value));
@@ -208,8 +211,8 @@ namespace SPL::Tests {
       HashMap<const char*, float> map(pairs);
       // Check state.
       Assert::IsFalse(map.isEmpty());
-      Assert::AreEqual(3U, map.getSize());
-      Assert::AreEqual(4U, map.getCapacity());
+      Assert::AreEqual<Size>(3, map.getSize());
+      Assert::AreEqual<Size>(4, map.getCapacity());
       Assert::AreEqual(0.75f, map.getLoadFactor());
       // Check undefined value.
       Assert::IsFalse(map.has(nullptr));
@@ -226,8 +229,8 @@ namespace SPL::Tests {
       HashMap<const char*, float> map({ { "abc", 1.5f }, { "def", 2.5f }, { "ghi", 3.5f } });
       // Check state.
       Assert::IsFalse(map.isEmpty());
-      Assert::AreEqual(3U, map.getSize());
-      Assert::AreEqual(4U, map.getCapacity());
+      Assert::AreEqual<Size>(3, map.getSize());
+      Assert::AreEqual<Size>(4, map.getCapacity());
       Assert::AreEqual(0.75f, map.getLoadFactor());
       // Check undefined value.
       Assert::ExpectException<SPL::Exceptions::KeyNotFound<const char*>>([&map] {
@@ -238,22 +241,22 @@ namespace SPL::Tests {
       });
       // Remove the second value.
       Assert::AreEqual(2.5f, map.remove("def"));
-      Assert::AreEqual(2U, map.getSize());
-      Assert::AreEqual(4U, map.getCapacity());
+      Assert::AreEqual<Size>(2, map.getSize());
+      Assert::AreEqual<Size>(4, map.getCapacity());
       Assert::AreEqual(0.5f, map.getLoadFactor());
       Assert::IsFalse(map.isEmpty());
       Assert::IsFalse(map.has("def"));
       // Remove the third value.
       Assert::AreEqual(3.5f, map.remove("ghi"));
-      Assert::AreEqual(1U, map.getSize());
-      Assert::AreEqual(4U, map.getCapacity());
+      Assert::AreEqual<Size>(1, map.getSize());
+      Assert::AreEqual<Size>(4, map.getCapacity());
       Assert::AreEqual(0.25f, map.getLoadFactor());
       Assert::IsFalse(map.isEmpty());
       Assert::IsFalse(map.has("ghi"));
       // Remove first value.
       Assert::AreEqual(1.5f, map.remove("abc"));
-      Assert::AreEqual(0U, map.getSize());
-      Assert::AreEqual(4U, map.getCapacity());
+      Assert::AreEqual<Size>(0, map.getSize());
+      Assert::AreEqual<Size>(4, map.getCapacity());
       Assert::AreEqual(0.0f, map.getLoadFactor());
       Assert::IsTrue(map.isEmpty());
       Assert::IsFalse(map.has("abc"));
@@ -266,8 +269,8 @@ namespace SPL::Tests {
       float value;
       // Check state.
       Assert::IsFalse(map.isEmpty());
-      Assert::AreEqual(3U, map.getSize());
-      Assert::AreEqual(4U, map.getCapacity());
+      Assert::AreEqual<Size>(3, map.getSize());
+      Assert::AreEqual<Size>(4, map.getCapacity());
       Assert::AreEqual(0.75f, map.getLoadFactor());
       // Check undefined value.
       Assert::IsFalse(map.remove(nullptr, value));
@@ -275,24 +278,24 @@ namespace SPL::Tests {
       // Remove the second value.
       Assert::IsTrue(map.remove("def", value));
       Assert::AreEqual(2.5f, value);
-      Assert::AreEqual(2U, map.getSize());
-      Assert::AreEqual(4U, map.getCapacity());
+      Assert::AreEqual<Size>(2, map.getSize());
+      Assert::AreEqual<Size>(4, map.getCapacity());
       Assert::AreEqual(0.5f, map.getLoadFactor());
       Assert::IsFalse(map.isEmpty());
       Assert::IsFalse(map.has("def"));
       // Remove the third value.
       Assert::IsTrue(map.remove("ghi", value));
       Assert::AreEqual(3.5f, value);
-      Assert::AreEqual(1U, map.getSize());
-      Assert::AreEqual(4U, map.getCapacity());
+      Assert::AreEqual<Size>(1, map.getSize());
+      Assert::AreEqual<Size>(4, map.getCapacity());
       Assert::AreEqual(0.25f, map.getLoadFactor());
       Assert::IsFalse(map.isEmpty());
       Assert::IsFalse(map.has("ghi"));
       // Remove the first value.
       Assert::IsTrue(map.remove("abc", value));
       Assert::AreEqual(1.5f, value);
-      Assert::AreEqual(0U, map.getSize());
-      Assert::AreEqual(4U, map.getCapacity());
+      Assert::AreEqual<Size>(0, map.getSize());
+      Assert::AreEqual<Size>(4, map.getCapacity());
       Assert::AreEqual(0.0f, map.getLoadFactor());
       Assert::IsTrue(map.isEmpty());
       Assert::IsFalse(map.has("abc"));
@@ -305,15 +308,15 @@ namespace SPL::Tests {
       HashMap<const char*, float> map(pairs);
       // Check state.
       Assert::IsFalse(map.isEmpty());
-      Assert::AreEqual(3U, map.getSize());
-      Assert::AreEqual(4U, map.getCapacity());
+      Assert::AreEqual<Size>(3, map.getSize());
+      Assert::AreEqual<Size>(4, map.getCapacity());
       Assert::AreEqual(0.75f, map.getLoadFactor());
       // Clear data.
       map.clear();
       // Check new state.
       Assert::IsTrue(map.isEmpty());
-      Assert::AreEqual(0U, map.getSize());
-      Assert::AreEqual(4U, map.getCapacity());
+      Assert::AreEqual<Size>(0, map.getSize());
+      Assert::AreEqual<Size>(4, map.getCapacity());
       Assert::AreEqual(0.0f, map.getLoadFactor());
       // Check values.
       for (const Pair<const char*, float>& pair : pairs) {
@@ -355,8 +358,8 @@ namespace SPL::Tests {
       other = Move(map);
       // Check map state.
       Assert::IsTrue(map.isEmpty());
-      Assert::AreEqual(0U, map.getSize());
-      Assert::AreEqual(0U, map.getCapacity());
+      Assert::AreEqual<Size>(0, map.getSize());
+      Assert::AreEqual<Size>(0, map.getCapacity());
       Assert::AreEqual(1.0f, map.getLoadFactor());
       // Check map values.
       for (const Pair<const char*, float>& pair : pairs) {
@@ -364,8 +367,8 @@ namespace SPL::Tests {
       }
       // Check other state.
       Assert::IsFalse(other.isEmpty());
-      Assert::AreEqual(3U, other.getSize());
-      Assert::AreEqual(4U, other.getCapacity());
+      Assert::AreEqual<Size>(3, other.getSize());
+      Assert::AreEqual<Size>(4, other.getCapacity());
       Assert::AreEqual(0.75f, other.getLoadFactor());
       // Check other values.
       for (const Pair<const char*, float>& pair : pairs) {
@@ -405,15 +408,15 @@ namespace SPL::Tests {
         });
       // Check state.
       Assert::IsFalse(map.isEmpty());
-      Assert::AreEqual(6U, map.getSize());
-      Assert::AreEqual(8U, map.getCapacity());
+      Assert::AreEqual<Size>(6, map.getSize());
+      Assert::AreEqual<Size>(8, map.getCapacity());
       Assert::AreEqual(0.75f, map.getLoadFactor());
       // Check enlargement.
       map.set("stu", 7.5f);
       // Check new state.
       Assert::IsFalse(map.isEmpty());
-      Assert::AreEqual(7U, map.getSize());
-      Assert::AreEqual(16U, map.getCapacity());
+      Assert::AreEqual<Size>(7, map.getSize());
+      Assert::AreEqual<Size>(16, map.getCapacity());
       Assert::AreEqual(0.4375f, map.getLoadFactor());
       // Check values.
       const Pair<const char*, float> result[] = {
@@ -444,8 +447,8 @@ namespace SPL::Tests {
         });
       // Check state.
       Assert::IsFalse(map.isEmpty());
-      Assert::AreEqual(7U, map.getSize());
-      Assert::AreEqual(16U, map.getCapacity());
+      Assert::AreEqual<Size>(7, map.getSize());
+      Assert::AreEqual<Size>(16, map.getCapacity());
       Assert::AreEqual(0.4375f, map.getLoadFactor());
       // Check shrinkage.
       map.remove("def");
@@ -453,8 +456,8 @@ namespace SPL::Tests {
       map.remove("pqr");
       // Check new state.
       Assert::IsFalse(map.isEmpty());
-      Assert::AreEqual(4U, map.getSize());
-      Assert::AreEqual(8U, map.getCapacity());
+      Assert::AreEqual<Size>(4, map.getSize());
+      Assert::AreEqual<Size>(8, map.getCapacity());
       Assert::AreEqual(0.5f, map.getLoadFactor());
       // Check values.
       const Pair<const char*, float> result[] = {
@@ -475,8 +478,8 @@ namespace SPL::Tests {
       HashMap<const int, float> map(pairs);
       // Check state.
       Assert::IsFalse(map.isEmpty());
-      Assert::AreEqual(3U, map.getSize());
-      Assert::AreEqual(4U, map.getCapacity());
+      Assert::AreEqual<Size>(3, map.getSize());
+      Assert::AreEqual<Size>(4, map.getCapacity());
       Assert::AreEqual(0.75f, map.getLoadFactor());
       // Check values.
       for (const Pair<const int, float>& pair : pairs) {
@@ -492,13 +495,37 @@ namespace SPL::Tests {
       map[39] = 3.9f;
       // Check state.
       Assert::IsFalse(map.isEmpty());
-      Assert::AreEqual(3U, map.getSize());
-      Assert::AreEqual(4U, map.getCapacity());
+      Assert::AreEqual<Size>(3, map.getSize());
+      Assert::AreEqual<Size>(4, map.getCapacity());
       Assert::AreEqual(0.75f, map.getLoadFactor());
       // Check values.
       Assert::AreEqual(1.5f, map[15]);
       Assert::AreEqual(3.1f, map[31]);
       Assert::AreEqual(3.9f, map[39]);
     }
+    /// <summary>
+    /// Test the range-based loop.
+    /// </summary>
+    TEST_METHOD(FeatureRangeFor) {
+      const Pair<const char*, float> pairs[] = { { "abc", 1.5f }, { "def", 2.5f }, { "ghi", 3.5f } };
+      HashMap<const char*, float> map(pairs);
+      map.remove("def");
+      // Check values in the hash order.
+      const Pair<const char*, float> result[] = { { "ghi", 3.5f }, { "abc", 1.5f } };
+      Index index = 0;
+      for (const auto& entry : map) {
+        Assert::AreEqual(result[index].key, entry.getKey());
+        Assert::AreEqual(result[index].value, entry.value);
+        index++;
+      }
+      Assert::AreEqual<Size>(2, index);
+      // Check the standard algorithms.
+      Assert::AreEqual<Size>(2, static_cast<Size>(std::distance(map.begin(), map.end())));
+      const auto found = std::find_if(map.begin(), map.end(), [](const auto& entry) { return entry.value == 1.5f; });
+      Assert::AreEqual("abc", found->getKey());
+      for (const auto& entry : HashMap<const char*, float>()) {
+        Assert::Fail();
+      }
+    }
   };
 }
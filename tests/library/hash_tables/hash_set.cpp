@@ -23,8 +23,8 @@ namespace SPL::Tests {
       HashSet<const float> set;
       // Check state.
       Assert::IsTrue(set.isEmpty());
-      Assert::AreEqual(0U, set.getSize());
-      Assert::AreEqual(0U, set.getCapacity());
+      Assert::AreEqual<Size>(0, set.getSize());
+      Assert::AreEqual<Size>(0, set.getCapacity());
       Assert::AreEqual(1.0f, set.getLoadFactor());
     }
     /// <summary>
@@ -34,8 +34,8 @@ namespace SPL::Tests {
       HashSet<const float> set(8);
       // Check state.
       Assert::IsTrue(set.isEmpty());
-      Assert::AreEqual(0U, set.getSize());
-      Assert::AreEqual(8U, set.getCapacity());
+      Assert::AreEqual<Size>(0, set.getSize());
+      Assert::AreEqual<Size>(8, set.getCapacity());
       Assert::AreEqual(0.0f, set.getLoadFactor());
     }
     /// <summary>
@@ -45,8 +45,8 @@ namespace SPL::Tests {
       HashSet<const float> set({ 1.5f, 2.5f, 3.5f, 1.5f, 2.5f, 3.5f });
       // Check state.
       Assert::IsFalse(set.isEmpty());
-      Assert::AreEqual(3U, set.getSize());
-      Assert::AreEqual(8U, set.getCapacity());
+      Assert::AreEqual<Size>(3, set.getSize());
+      Assert::AreEqual<Size>(8, set.getCapacity());
       Assert::AreEqual(0.375f, set.getLoadFactor());
     }
     /// <summary>
@@ -80,8 +80,8 @@ namespace SPL::Tests {
       HashSet<const float> set(values), other(Move(set));
       // Check set state.
       Assert::IsTrue(set.isEmpty());
-      Assert::AreEqual(0U, set.getSize());
-      Assert::AreEqual(0U, set.getCapacity());
+      Assert::AreEqual<Size>(0, set.getSize());
+      Assert::AreEqual<Size>(0, set.getCapacity());
       Assert::AreEqual(1.0f, set.getLoadFactor());
       // Check set values.
       for (const float value : values) {
@@ -89,8 +89,8 @@ namespace SPL::Tests {
       }
       // Check other state.
       Assert::IsFalse(other.isEmpty());
-      Assert::AreEqual(3U, other.getSize());
-      Assert::AreEqual(4U, other.getCapacity());
+      Assert::AreEqual<Size>(3, other.getSize());
+      Assert::AreEqual<Size>(4, other.getCapacity());
       Assert::AreEqual(0.75f, other.getLoadFactor());
       // Check other values.
       for (const float value : values) {
@@ -108,11 +108,11 @@ namespace SPL::Tests {
           Mock(instances),
           Mock(instances)
         });
-      Assert::AreEqual(3U, instances);
+      Assert::AreEqual<Size>(3, instances);
       // Delete the instance.
       delete set;
       // Check state.
-      Assert::AreEqual(0U, instances);
+      Assert::AreEqual<Size>(0, instances);
     }
     /// <summary>
     /// Test the add method.
@@ -122,8 +122,8 @@ namespace SPL::Tests {
       HashSet<const float> set(values);
       // Check state.
       Assert::IsFalse(set.isEmpty());
-      Assert::AreEqual(3U, set.getSize());
-      Assert::AreEqual(4U, set.getCapacity());
+      Assert::AreEqual<Size>(3, set.getSize());
+      Assert::AreEqual<Size>(4, set.getCapacity());
       Assert::AreEqual(0.75f, set.getLoadFactor());
       // Set new values.
       for (const float value : values) {
@@ -132,8 +132,8 @@ namespace SPL::Tests {
       set.add(4.5f);
       // Check new state.
       Assert::IsFalse(set.isEmpty());
-      Assert::AreEqual(4U, set.getSize());
-      Assert::AreEqual(8U, set.getCapacity());
+      Assert::AreEqual<Size>(4, set.getSize());
+      Assert::AreEqual<Size>(8, set.getCapacity());
       Assert::AreEqual(0.5f, set.getLoadFactor());
       // Check new values.
       const float result[] = { 1.5f, 2.5f, 3.5f, 4.5f };
@@ -163,8 +163,8 @@ namespace SPL::Tests {
       HashSet<const float> set(values);
       // Check state.
       Assert::IsFalse(set.isEmpty());
-      Assert::AreEqual(3U, set.getSize());
-      Assert::AreEqual(4U, set.getCapacity());
+      Assert::AreEqual<Size>(3, set.getSize());
+      Assert::AreEqual<Size>(4, set.getCapacity());
       Assert::AreEqual(0.75f, set.getLoadFactor());
       // Check undefined value.
       Assert::IsFalse(set.has(0));
@@ -180,29 +180,29 @@ namespace SPL::Tests {
       HashSet<const float> set({ 1.5f, 2.5f, 3.5f });
       // Check state.
       Assert::IsFalse(set.isEmpty());
-      Assert::AreEqual(3U, set.getSize());
-      Assert::AreEqual(4U, set.getCapacity());
+      Assert::AreEqual<Size>(3, set.getSize());
+      Assert::AreEqual<Size>(4, set.getCapacity());
       Assert::AreEqual(0.75f, set.getLoadFactor());
       // Check undefined values.
       Assert::IsFalse(set.remove(0.0f));
       // Remove the second value.
       Assert::IsTrue(set.remove(2.5f));
-      Assert::AreEqual(2U, set.getSize());
-      Assert::AreEqual(4U, set.getCapacity());
+      Assert::AreEqual<Size>(2, set.getSize());
+      Assert::AreEqual<Size>(4, set.getCapacity());
       Assert::AreEqual(0.5f, set.getLoadFactor());
       Assert::IsFalse(set.isEmpty());
       Assert::IsFalse(set.has(2.5f));
       // Remove the third value.
       Assert::IsTrue(set.remove(3.5f));
-      Assert::AreEqual(1U, set.getSize());
-      Assert::AreEqual(4U, set.getCapacity());
+      Assert::AreEqual<Size>(1, set.getSize());
+      Assert::AreEqual<Size>(4, set.getCapacity());
       Assert::AreEqual(0.25f, set.getLoadFactor());
       Assert::IsFalse(set.isEmpty());
       Assert::IsFalse(set.has(3.5f));
       // Remove the first value.
       Assert::IsTrue(set.remove(1.5f));
-      Assert::AreEqual(0U, set.getSize());
-      Assert::AreEqual(4U, set.getCapacity());
+      Assert::AreEqual<Size>(0, set.getSize());
+      Assert::AreEqual<Size>(4, set.getCapacity());
       Assert::AreEqual(0.0f, set.getLoadFactor());
       Assert::IsTrue(set.isEmpty());
       Assert::IsFalse(set.has(1.5f));
@@ -215,15 +215,15 @@ namespace SPL::Tests {
       HashSet<const float> set(values);
       // Check state.
       Assert::IsFalse(set.isEmpty());
-      Assert::AreEqual(3U, set.getSize());
-      Assert::AreEqual(4U, set.getCapacity());
+      Assert::AreEqual<Size>(3, set.getSize());
+      Assert::AreEqual<Size>(4, set.getCapacity());
       Assert::AreEqual(0.75f, set.getLoadFactor());
       // Clear data.
       set.clear();
       // Check new state.
       Assert::IsTrue(set.isEmpty());
-      Assert::AreEqual(0U, set.getSize());
-      Assert::AreEqual(4U, set.getCapacity());
+      Assert::AreEqual<Size>(0, set.getSize());
+      Assert::AreEqual<Size>(4, set.getCapacity());
       Assert::AreEqual(0.0f, set.getLoadFactor());
       // Check values.
       for (const float value : values) {
@@ -265,8 +265,8 @@ namespace SPL::Tests {
       other = Move(set);
       // Check set state.
       Assert::IsTrue(set.isEmpty());
-      Assert::AreEqual(0U, set.getSize());
-      Assert::AreEqual(0U, set.getCapacity());
+      Assert::AreEqual<Size>(0, set.getSize());
+      Assert::AreEqual<Size>(0, set.getCapacity());
       Assert::AreEqual(1.0f, set.getLoadFactor());
       // Check values.
       for (const float value : values) {
@@ -274,8 +274,8 @@ namespace SPL::Tests {
       }
       // Check other state.
       Assert::IsFalse(other.isEmpty());
-      Assert::AreEqual(3U, other.getSize());
-      Assert::AreEqual(4U, other.getCapacity());
+      Assert::AreEqual<Size>(3, other.getSize());
+      Assert::AreEqual<Size>(4, other.getCapacity());
       Assert::AreEqual(0.75f, other.getLoadFactor());
       // Check other values.
       for (const float value : values) {
@@ -289,15 +289,15 @@ namespace SPL::Tests {
       HashSet<const float> set({ 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f });
       // Check state.
       Assert::IsFalse(set.isEmpty());
-      Assert::AreEqual(6U, set.getSize());
-      Assert::AreEqual(8U, set.getCapacity());
+      Assert::AreEqual<Size>(6, set.getSize());
+      Assert::AreEqual<Size>(8, set.getCapacity());
       Assert::AreEqual(0.75f, set.getLoadFactor());
       // Check enlargement.
       set.add(7.5f);
       // Check new state.
       Assert::IsFalse(set.isEmpty());
-      Assert::AreEqual(7U, set.getSize());
-      Assert::AreEqual(16U, set.getCapacity());
+      Assert::AreEqual<Size>(7, set.getSize());
+      Assert::AreEqual<Size>(16, set.getCapacity());
       Assert::AreEqual(0.4375f, set.getLoadFactor());
       // Check values.
       const float result[] = { 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f };
@@ -312,8 +312,8 @@ namespace SPL::Tests {
       HashSet<const float> set({ 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f });
       // Check state.
       Assert::IsFalse(set.isEmpty());
-      Assert::AreEqual(7U, set.getSize());
-      Assert::AreEqual(16U, set.getCapacity());
+      Assert::AreEqual<Size>(7, set.getSize());
+      Assert::AreEqual<Size>(16, set.getCapacity());
       Assert::AreEqual(0.4375f, set.getLoadFactor());
       // Check shrinkage.
       set.remove(2.5f);
@@ -321,8 +321,8 @@ namespace SPL::Tests {
       set.remove(6.5f);
       // Check new state.
       Assert::IsFalse(set.isEmpty());
-      Assert::AreEqual(4U, set.getSize());
-      Assert::AreEqual(8U, set.getCapacity());
+      Assert::AreEqual<Size>(4, set.getSize());
+      Assert::AreEqual<Size>(8, set.getCapacity());
       Assert::AreEqual(0.5f, set.getLoadFactor());
       // Check values.
       const float result[] = { 1.5f, 3.5f, 5.5f, 7.5f };
@@ -338,8 +338,8 @@ namespace SPL::Tests {
       HashSet<const float> set(values);
       // Check state.
       Assert::IsFalse(set.isEmpty());
-      Assert::AreEqual(3U, set.getSize());
-      Assert::AreEqual(4U, set.getCapacity());
+      Assert::AreEqual<Size>(3, set.getSize());
+      Assert::AreEqual<Size>(4, set.getCapacity());
       Assert::AreEqual(0.75f, set.getLoadFactor());
       // Check values.
       for (const float value : values) {
@@ -355,13 +355,28 @@ namespace SPL::Tests {
       set.add(39.5f);
       // Check state.
       Assert::IsFalse(set.isEmpty());
-      Assert::AreEqual(3U, set.getSize());
-      Assert::AreEqual(4U, set.getCapacity());
+      Assert::AreEqual<Size>(3, set.getSize());
+      Assert::AreEqual<Size>(4, set.getCapacity());
       Assert::AreEqual(0.75f, set.getLoadFactor());
       // Check values.
       Assert::IsTrue(set.has(15.5f));
       Assert::IsTrue(set.has(31.5f));
       Assert::IsTrue(set.has(39.5f));
     }
+    /// <summary>
+    /// Test the range-based loop.
+    /// </summary>
+    TEST_METHOD(FeatureRangeFor) {
+      const float values[] = { 1.5f, 2.5f, 3.5f };
+      HashSet<const float> set(values);
+      set.remove(2.5f);
+      // Check values in the hash order.
+      const float result[] = { 1.5f, 3.5f };
+      Index index = 0;
+      for (const auto& entry : set) {
+        Assert::AreEqual(result[index++], entry.getKey());
+      }
+      Assert::AreEqual<Size>(2, index);
+    }
   };
 }
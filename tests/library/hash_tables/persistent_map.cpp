@@ -0,0 +1,290 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#include <algorithm>
+#include <iterator>
+
+#include "../mock.hpp"
+#include "CppUnitTest.h"
+#include "interfaces.hpp"
+#include "hash_tables.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace SPL::Tests;
+
+namespace SPL::Tests {
+  /// <summary>
+  /// Test class.
+  /// </summary>
+  TEST_CLASS(PersistentMapTests)
+  {
+  private:
+    /// <summary>
+    /// Hash function that maps every key to the same hash.
+    /// </summary>
+    /// <param name="key">Input key.</param>
+    /// <returns>Returns the same hash for all the keys.</returns>
+    static Id Collide(const int& key) {
+      return 7;
+    }
+  public:
+    /// <summary>
+    /// Test the empty constructor.
+    /// </summary>
+    TEST_METHOD(ConstructEmpty) {
+      PersistentMap<const char*, float> map;
+      // Check state.
+      Assert::IsTrue(map.isEmpty());
+      Assert::AreEqual<Size>(0, map.getSize());
+      Assert::IsFalse(map.has("abc"));
+    }
+    /// <summary>
+    /// Test the initialized constructor.
+    /// </summary>
+    TEST_METHOD(ConstructPairs) {
+      PersistentMap<const char*, float> map({ { "abc", 1.5f }, { "def", 2.5f }, { "ghi", 3.5f } });
+      // Check state.
+      Assert::IsFalse(map.isEmpty());
+      Assert::AreEqual<Size>(3, map.getSize());
+      Assert::AreEqual(2.5f, map.get("def"));
+    }
+    /// <summary>
+    /// Test the copy constructor.
+    /// </summary>
+    TEST_METHOD(ConstructCopy) {
+      const Pair<const char*, float> pairs[] = { { "abc", 1.5f }, { "def", 2.5f }, { "ghi", 3.5f } };
+      PersistentMap<const char*, float> map(pairs), other(map);
+      // Check copy values.
+      Assert::AreEqual(map.getSize(), other.getSize());
+      for (const Pair<const char*, float>& pair : pairs) {
+        Assert::AreEqual(map.get(pair.key), other.get(pair.key));
+      }
+      // Change values.
+      map.set("abc", 10.5f);
+      map.remove("ghi");
+      // Check other values.
+      Assert::AreEqual(1.5f, other.get("abc"));
+      Assert::AreEqual(3.5f, other.get("ghi"));
+      Assert::AreEqual<Size>(3, other.getSize());
+      Assert::AreEqual<Size>(2, map.getSize());
+    }
+    /// <summary>
+    /// Test the move constructor.
+    /// </summary>
+    TEST_METHOD(ConstructMove) {
+      PersistentMap<const char*, float> map({ { "abc", 1.5f }, { "def", 2.5f } }), other(Move(map));
+      // Check map state.
+      Assert::IsTrue(map.isEmpty());
+      Assert::IsFalse(map.has("abc"));
+      // Check other state.
+      Assert::AreEqual<Size>(2, other.getSize());
+      Assert::AreEqual(1.5f, other.get("abc"));
+    }
+    /// <summary>
+    /// Test the destructor.
+    /// </summary>
+    TEST_METHOD(Destruct) {
+      Size instances = 0;
+      // Create new instances.
+      auto* map = new PersistentMap<int, Mock>();
+      for (int key = 0; key < 100; ++key) {
+        map->set(key, Mock(instances));
+      }
+      Assert::AreEqual<Size>(100, instances);
+      // Change a copy.
+      auto* other = new PersistentMap<int, Mock>(*map);
+      map->remove(10);
+      // Delete the instances.
+      delete other;
+      Assert::AreEqual<Size>(99, instances);
+      delete map;
+      Assert::AreEqual<Size>(0, instances);
+    }
+    /// <summary>
+    /// Test the set method.
+    /// </summary>
+    TEST_METHOD(MethodSet) {
+      const Pair<const char*, float> pairs[] = { { "abc", 1.5f }, { "def", 2.5f }, { "ghi", 3.5f } };
+      PersistentMap<const char*, float> map(pairs);
+      // Map new values.
+      for (const Pair<const char*, float>& pair : pairs) {
+        Assert::AreEqual(pair.value, map.set(pair.key, pair.value + 0.5f));
+      }
+      Assert::AreEqual(0.0f, map.set("jkl", 5.0f));
+      // Check new state.
+      Assert::AreEqual<Size>(4, map.getSize());
+      const Pair<const char*, float> result[] = { { "abc", 2.0f }, { "def", 3.0f }, { "ghi", 4.0f}, { "jkl", 5.0f} };
+      for (const Pair<const char*, float>& pair : result) {
+        Assert::AreEqual(pair.value, map.get(pair.key));
+      }
+    }
+    /// <summary>
+    /// Test the get method.
+    /// </summary>
+    TEST_METHOD(MethodGet) {
+      PersistentMap<const char*, float> map({ { "abc", 1.5f }, { "def", 2.5f } });
+      float value;
+      // Check undefined value.
+      Assert::ExpectException<SPL::Exceptions::KeyNotFound<const char*>>([&map] {
+        map.get("cba");
+      });
+      Assert::IsFalse(map.get("cba", value));
+      // Check values.
+      Assert::AreEqual(1.5f, map.get("abc"));
+      Assert::IsTrue(map.get("def", value));
+      Assert::AreEqual(2.5f, value);
+      Assert::AreEqual(2.5f, map["def"]);
+    }
+    /// <summary>
+    /// Test the get method (by iterator).
+    /// </summary>
+    TEST_METHOD(MethodGetByIterator) {
+      PersistentMap<int, int> map;
+      for (int key = 0; key < 1000; ++key) {
+        map.set(key, key * 2);
+      }
+      auto iterator = map.getIterator();
+      // Change the map during the iteration.
+      map.clear();
+      // Check all values of the iterated version.
+      Size count = 0;
+      while (iterator->hasNext()) {
+        const auto& current = iterator->next();
+        Assert::AreEqual(current.key * 2, current.value);
+        count++;
+      }
+      Assert::AreEqual<Size>(1000, count);
+      Assert::ExpectException<SPL::Exceptions::InvalidOperation>([&iterator] {
+        iterator->next();
+      });
+    }
+    /// <summary>
+    /// Test the range-based loop.
+    /// </summary>
+    TEST_METHOD(FeatureRangeFor) {
+      PersistentMap<int, int> map;
+      for (int key = 0; key < 1000; ++key) {
+        map.set(key, key * 2);
+      }
+      map.remove(10);
+      // Check all values.
+      Size count = 0;
+      for (const auto& entry : map) {
+        Assert::AreEqual(entry.key * 2, entry.value);
+        Assert::AreNotEqual(10, entry.key);
+        count++;
+      }
+      Assert::AreEqual<Size>(999, count);
+      // Check the standard algorithms.
+      Assert::AreEqual<Size>(999, static_cast<Size>(std::distance(map.begin(), map.end())));
+      const auto found = std::find_if(map.begin(), map.end(), [](const auto& entry) { return entry.key == 20; });
+      Assert::AreEqual(40, found->value);
+      for (const auto& entry : PersistentMap<int, int>()) {
+        Assert::Fail();
+      }
+    }
+    /// <summary>
+    /// Test the remove method.
+    /// </summary>
+    TEST_METHOD(MethodRemove) {
+      PersistentMap<const char*, float> map({ { "abc", 1.5f }, { "def", 2.5f }, { "ghi", 3.5f } });
+      float value;
+      // Check undefined value.
+      Assert::ExpectException<SPL::Exceptions::KeyNotFound<const char*>>([&map] {
+        map.remove("cba");
+      });
+      Assert::IsFalse(map.remove("cba", value));
+      // Remove the values.
+      Assert::AreEqual(2.5f, map.remove("def"));
+      Assert::AreEqual<Size>(2, map.getSize());
+      Assert::IsFalse(map.has("def"));
+      Assert::IsTrue(map.remove("abc", value));
+      Assert::AreEqual(1.5f, value);
+      Assert::AreEqual(3.5f, map.remove("ghi"));
+      Assert::IsTrue(map.isEmpty());
+    }
+    /// <summary>
+    /// Test the clear method.
+    /// </summary>
+    TEST_METHOD(MethodClear) {
+      PersistentMap<const char*, float> map({ { "abc", 1.5f }, { "def", 2.5f } }), other(map);
+      // Clear data.
+      map.clear();
+      // Check new state.
+      Assert::IsTrue(map.isEmpty());
+      Assert::IsFalse(map.has("abc"));
+      Assert::AreEqual<Size>(2, other.getSize());
+      Assert::IsTrue(other.has("abc"));
+    }
+    /// <summary>
+    /// Test the copy assignment operator.
+    /// </summary>
+    TEST_METHOD(OperatorCopy) {
+      PersistentMap<const char*, float> map({ { "abc", 1.5f }, { "def", 2.5f } }), other;
+      // Copy map to other.
+      other = map;
+      map.set("abc", 10.5f);
+      // Check values.
+      Assert::AreEqual(10.5f, map["abc"]);
+      Assert::AreEqual(1.5f, other["abc"]);
+      Assert::AreEqual(2.5f, other["def"]);
+    }
+    /// <summary>
+    /// Test the snapshot feature.
+    /// </summary>
+    TEST_METHOD(FeatureSnapshot) {
+      PersistentMap<int, int> map;
+      PersistentMap<int, int> snapshots[10];
+      // Take a snapshot after each batch of changes.
+      for (int batch = 0; batch < 10; ++batch) {
+        for (int key = 0; key < 1000; ++key) {
+          map.set(key, batch);
+        }
+        for (int key = 0; key < batch * 100; ++key) {
+          map.remove(key);
+        }
+        snapshots[batch] = map;
+      }
+      // Check all snapshots.
+      for (int batch = 0; batch < 10; ++batch) {
+        const auto& snapshot = snapshots[batch];
+        Assert::AreEqual(static_cast<Size>(1000 - batch * 100), snapshot.getSize());
+        for (int key = 0; key < 1000; ++key) {
+          if (key < batch * 100) {
+            Assert::IsFalse(snapshot.has(key));
+          }
+          else {
+            Assert::AreEqual(batch, snapshot.get(key));
+          }
+        }
+      }
+    }
+    /// <summary>
+    /// Test the hash collision feature.
+    /// </summary>
+    TEST_METHOD(FeatureCollision) {
+      PersistentMap<int, int, &Collide> map;
+      // Set colliding keys.
+      for (int key = 0; key < 10; ++key) {
+        Assert::AreEqual(0, map.set(key, key + 1));
+      }
+      auto other(map);
+      // Check values.
+      Assert::AreEqual<Size>(10, map.getSize());
+      for (int key = 0; key < 10; ++key) {
+        Assert::AreEqual(key + 1, map.get(key));
+      }
+      // Remove all keys.
+      for (int key = 0; key < 10; ++key) {
+        Assert::AreEqual(key + 1, map.remove(key));
+        Assert::IsFalse(map.has(key));
+      }
+      Assert::IsTrue(map.isEmpty());
+      // Check the previous version.
+      Assert::AreEqual<Size>(10, other.getSize());
+      for (int key = 0; key < 10; ++key) {
+        Assert::AreEqual(key + 1, other.get(key));
+      }
+    }
+  };
+}
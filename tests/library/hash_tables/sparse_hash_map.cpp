@@ -0,0 +1,400 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#include <algorithm>
+#include <iterator>
+
+#include "../mock.hpp"
+#include "CppUnitTest.h"
+#include "interfaces.hpp"
+#include "hash_tables.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace SPL::Tests;
+
+namespace SPL::Tests {
+  /// <summary>
+  /// Test class.
+  /// </summary>
+  TEST_CLASS(SparseHashMapTests)
+  {
+  public:
+    /// <summary>
+    /// Test the empty constructor.
+    /// </summary>
+    TEST_METHOD(ConstructEmpty) {
+      SparseHashMap<const char*, float> map;
+      // Check state.
+      Assert::IsTrue(map.isEmpty());
+      Assert::AreEqual<Size>(0, map.getSize());
+      Assert::AreEqual<Size>(0, map.getCapacity());
+      Assert::AreEqual(1.0f, map.getLoadFactor());
+    }
+    /// <summary>
+    /// Test the capacity constructor.
+    /// </summary>
+    TEST_METHOD(ConstructCapacity) {
+      SparseHashMap<const char*, float> map(100);
+      // Check state.
+      Assert::IsTrue(map.isEmpty());
+      Assert::AreEqual<Size>(0, map.getSize());
+      Assert::AreEqual<Size>(128, map.getCapacity());
+      Assert::AreEqual(0.0f, map.getLoadFactor());
+    }
+    /// <summary>
+    /// Test the initialized constructor.
+    /// </summary>
+    TEST_METHOD(ConstructPairs) {
+      SparseHashMap<const char*, float> map({ { "abc", 1.5f }, { "def", 2.5f }, { "ghi", 3.5f } });
+      // Check state.
+      Assert::IsFalse(map.isEmpty());
+      Assert::AreEqual<Size>(3, map.getSize());
+      Assert::AreEqual<Size>(64, map.getCapacity());
+    }
+    /// <summary>
+    /// Test the copy constructor.
+    /// </summary>
+    TEST_METHOD(ConstructCopy) {
+      const Pair<const char*, float> pairs[] = { { "abc", 1.5f }, { "def", 2.5f }, { "ghi", 3.5f } };
+      SparseHashMap<const char*, float> map(pairs), other(map);
+      // Check copy state.
+      Assert::AreEqual(map.isEmpty(), other.isEmpty());
+      Assert::AreEqual(map.getSize(), other.getSize());
+      Assert::AreEqual(map.getCapacity(), other.getCapacity());
+      // Check copy values.
+      for (const Pair<const char*, float>& pair : pairs) {
+        Assert::AreEqual(map.get(pair.key), other.get(pair.key));
+      }
+      // Change values.
+      map.set("abc", 10.5f);
+      map.set("ghi", 30.5f);
+      // Check other values.
+      Assert::AreNotEqual(map.get("abc"), other.get("abc"));
+      Assert::AreEqual(map.get("def"), other.get("def"));
+      Assert::AreNotEqual(map.get("ghi"), other.get("ghi"));
+    }
+    /// <summary>
+    /// Test the move constructor.
+    /// </summary>
+    TEST_METHOD(ConstructMove) {
+      const Pair<const char*, float> pairs[] = { { "abc", 1.5f }, { "def", 2.5f }, { "ghi", 3.5f } };
+      SparseHashMap<const char*, float> map(pairs), other(Move(map));
+      // Check map state.
+      Assert::IsTrue(map.isEmpty());
+      Assert::AreEqual<Size>(0, map.getSize());
+      Assert::AreEqual<Size>(0, map.getCapacity());
+      // Check map values.
+      for (const Pair<const char*, float>& pair : pairs) {
+        Assert::IsFalse(map.has(pair.key));
+      }
+      // Check other state.
+      Assert::IsFalse(other.isEmpty());
+      Assert::AreEqual<Size>(3, other.getSize());
+      Assert::AreEqual<Size>(64, other.getCapacity());
+      // Check other values.
+      for (const Pair<const char*, float>& pair : pairs) {
+        Assert::AreEqual(pair.value, other.get(pair.key));
+      }
+    }
+    /// <summary>
+    /// Test the destructor.
+    /// </summary>
+    TEST_METHOD(Destruct) {
+      Size instances = 0;
+      // Create a new instance.
+      SPL::Map<const char*, Mock>* map = new SparseHashMap<const char*, Mock>({
+          { "abc", Mock(instances) },
+          { "def", Mock(instances) },
+          { "ghi", Mock(instances) }
+        });
+      Assert::AreEqual<Size>(3, instances);
+      // Delete the instance.
+      delete map;
+      // Check state.
+      Assert::AreEqual<Size>(0, instances);
+    }
+    /// <summary>
+    /// Test the set method.
+    /// </summary>
+    TEST_METHOD(MethodSet) {
+      const Pair<const char*, float> pairs[] = { { "abc", 1.5f }, { "def", 2.5f }, { "ghi", 3.5f } };
+      SparseHashMap<const char*, float> map(pairs);
+      // Map new values.
+      for (const Pair<const char*, float>& pair : pairs) {
+        Assert::AreEqual(pair.value, map.set(pair.key, pair.value + 0.5f));
+      }
+      Assert::AreEqual(0.0f, map.set("jkl", 5.0f));
+      // Check new state.
+      Assert::IsFalse(map.isEmpty());
+      Assert::AreEqual<Size>(4, map.getSize());
+      Assert::AreEqual<Size>(64, map.getCapacity());
+      // Check new values.
+      const Pair<const char*, float> result[] = { { "abc", 2.0f }, { "def", 3.0f }, { "ghi", 4.0f}, { "jkl", 5.0f} };
+      for (const Pair<const char*, float>& pair : result) {
+        Assert::AreEqual(pair.value, map.get(pair.key));
+      }
+    }
+    /// <summary>
+    /// Test the get method (by return).
+    /// </summary>
+    TEST_METHOD(MethodGetByReturn) {
+      const Pair<const char*, float> pairs[] = { { "abc", 1.5f }, { "def", 2.5f }, { "ghi", 3.5f } };
+      SparseHashMap<const char*, float> map(pairs);
+      // Check undefined value.
+      Assert::ExpectException<SPL::Exceptions::KeyNotFound<const char*>>([&map] {
+        Assert::AreEqual(0.0f, map.get(nullptr));
+      });
+      Assert::ExpectException<SPL::Exceptions::KeyNotFound<const char*>>([&map] {
+        Assert::AreEqual(0.0f, map.get("cba"));
+      });
+      // Check values.
+      for (const Pair<const char*, float>& pair : pairs) {
+        Assert::AreEqual(pair.value, map.get(pair.key));
+      }
+    }
+    /// <summary>
+    /// Test the get method (by reference).
+    /// </summary>
+    TEST_METHOD(MethodGetByReference) {
+      const Pair<const char*, float> pairs[] = { { "abc", 1.5f }, { "def", 2.5f }, { "ghi", 3.5f } };
+      SparseHashMap<const char*, float> map(pairs);
+      float value;
+      // Check undefined value.
+      Assert::IsFalse(map.get(nullptr, value));
+      Assert::IsFalse(map.get("cba", value));
+      // Check values.
+      for (const Pair<const char*, float>& pair : pairs) {
+        Assert::IsTrue(map.get(pair.key, value));
+        Assert::AreEqual(pair.value, value);
+      }
+    }
+    /// <summary>
+    /// Test the get method (by iterator).
+    /// </summary>
+    TEST_METHOD(MethodGetByIterator) {
+      SparseHashMap<int, int> map;
+      for (int key = 0; key < 500; ++key) {
+        map.set(key, key * 2);
+      }
+      // Check all values in the slot order.
+      auto iterator = map.getIterator();
+      Size count = 0;
+      while (iterator->hasNext()) {
+        const auto& current = iterator->next();
+        Assert::AreEqual(current.key * 2, current.value);
+        count++;
+      }
+      Assert::AreEqual<Size>(500, count);
+      Assert::ExpectException<SPL::Exceptions::InvalidOperation>([&iterator] {
+        iterator->next();
+      });
+    }
+    /// <summary>
+    /// Test the has method.
+    /// </summary>
+    TEST_METHOD(MethodHas) {
+      const Pair<const char*, float> pairs[] = { { "abc", 1.5f }, { "def", 2.5f }, { "ghi", 3.5f } };
+      SparseHashMap<const char*, float> map(pairs);
+      // Check undefined value.
+      Assert::IsFalse(map.has(nullptr));
+      Assert::IsFalse(map.has("cba"));
+      // Check values.
+      for (const Pair<const char*, float>& pair : pairs) {
+        Assert::IsTrue(map.has(pair.key));
+      }
+    }
+    /// <summary>
+    /// Test the remove method (with return).
+    /// </summary>
+    TEST_METHOD(MethodRemoveWithReturn) {
+      SparseHashMap<const char*, float> map({ { "abc", 1.5f }, { "def", 2.5f }, { "ghi", 3.5f } });
+      // Check undefined value.
+      Assert::ExpectException<SPL::Exceptions::KeyNotFound<const char*>>([&map] {
+        Assert::AreEqual(0.0f, map.remove(nullptr));
+      });
+      Assert::ExpectException<SPL::Exceptions::KeyNotFound<const char*>>([&map] {
+        Assert::AreEqual(0.0f, map.remove("cba"));
+      });
+      // Remove the second value.
+      Assert::AreEqual(2.5f, map.remove("def"));
+      Assert::AreEqual<Size>(2, map.getSize());
+      Assert::IsFalse(map.has("def"));
+      Assert::IsTrue(map.has("abc"));
+      Assert::IsTrue(map.has("ghi"));
+      // Remove the other values.
+      Assert::AreEqual(3.5f, map.remove("ghi"));
+      Assert::AreEqual(1.5f, map.remove("abc"));
+      Assert::AreEqual<Size>(0, map.getSize());
+      Assert::AreEqual<Size>(64, map.getCapacity());
+      Assert::IsTrue(map.isEmpty());
+    }
+    /// <summary>
+    /// Test the remove method (with reference).
+    /// </summary>
+    TEST_METHOD(MethodRemoveWithReference) {
+      SparseHashMap<const char*, float> map({ { "abc", 1.5f }, { "def", 2.5f }, { "ghi", 3.5f } });
+      float value;
+      // Check undefined value.
+      Assert::IsFalse(map.remove(nullptr, value));
+      Assert::IsFalse(map.remove("cba", value));
+      // Remove the second value.
+      Assert::IsTrue(map.remove("def", value));
+      Assert::AreEqual(2.5f, value);
+      Assert::AreEqual<Size>(2, map.getSize());
+      Assert::IsFalse(map.has("def"));
+      // Remove the other values.
+      Assert::IsTrue(map.remove("ghi", value));
+      Assert::AreEqual(3.5f, value);
+      Assert::IsTrue(map.remove("abc", value));
+      Assert::AreEqual(1.5f, value);
+      Assert::IsTrue(map.isEmpty());
+    }
+    /// <summary>
+    /// Test the clear method.
+    /// </summary>
+    TEST_METHOD(MethodClear) {
+      const Pair<const char*, float> pairs[] = { { "abc", 1.5f }, { "def", 2.5f }, { "ghi", 3.5f } };
+      SparseHashMap<const char*, float> map(pairs);
+      // Clear data.
+      map.clear();
+      // Check new state.
+      Assert::IsTrue(map.isEmpty());
+      Assert::AreEqual<Size>(0, map.getSize());
+      Assert::AreEqual<Size>(64, map.getCapacity());
+      // Check values.
+      for (const Pair<const char*, float>& pair : pairs) {
+        Assert::IsFalse(map.has(pair.key));
+      }
+    }
+    /// <summary>
+    /// Test the copy assignment operator.
+    /// </summary>
+    TEST_METHOD(OperatorCopy) {
+      const Pair<const char*, float> pairs[] = { { "abc", 1.5f }, { "def", 2.5f }, { "ghi", 3.5f } };
+      SparseHashMap<const char*, float> map(pairs), other;
+      // Copy map to other.
+      other = map;
+      // Check copy values.
+      Assert::AreEqual(map.getSize(), other.getSize());
+      for (const Pair<const char*, float>& pair : pairs) {
+        Assert::AreEqual(map[pair.key], other[pair.key]);
+      }
+      // Change values.
+      map.set("abc", 10.5f);
+      // Check other values.
+      Assert::AreNotEqual(map.get("abc"), other.get("abc"));
+      Assert::AreEqual(map.get("def"), other.get("def"));
+    }
+    /// <summary>
+    /// Test the move assignment operator.
+    /// </summary>
+    TEST_METHOD(OperatorMove) {
+      const Pair<const char*, float> pairs[] = { { "abc", 1.5f }, { "def", 2.5f }, { "ghi", 3.5f } };
+      SparseHashMap<const char*, float> map(pairs), other;
+      // Move map to other.
+      other = Move(map);
+      // Check map state.
+      Assert::IsTrue(map.isEmpty());
+      Assert::AreEqual<Size>(0, map.getCapacity());
+      // Check other values.
+      Assert::AreEqual<Size>(3, other.getSize());
+      for (const Pair<const char*, float>& pair : pairs) {
+        Assert::AreEqual(pair.value, other[pair.key]);
+      }
+    }
+    /// <summary>
+    /// Test the access operator.
+    /// </summary>
+    TEST_METHOD(OperatorAccess) {
+      SparseHashMap<const char*, float> map;
+      // Create new values.
+      map["abc"] = 1.5f;
+      map["def"] = 2.5f;
+      // Check values.
+      Assert::AreEqual<Size>(2, map.getSize());
+      Assert::AreEqual(1.5f, map["abc"]);
+      Assert::AreEqual(2.5f, map["def"]);
+    }
+    /// <summary>
+    /// Test the enlarge capacity feature.
+    /// </summary>
+    TEST_METHOD(FeatureEnlarge) {
+      SparseHashMap<int, int> map;
+      // Map a lot of values.
+      for (int key = 0; key < 10000; ++key) {
+        map.set(key, -key);
+      }
+      // Check new state.
+      Assert::AreEqual<Size>(10000, map.getSize());
+      Assert::AreEqual<Size>(16384, map.getCapacity());
+      // Check values.
+      for (int key = 0; key < 10000; ++key) {
+        Assert::AreEqual(-key, map.get(key));
+      }
+    }
+    /// <summary>
+    /// Test the shrink capacity feature.
+    /// </summary>
+    TEST_METHOD(FeatureShrink) {
+      SparseHashMap<int, int> map;
+      for (int key = 0; key < 1000; ++key) {
+        map.set(key, key);
+      }
+      Assert::AreEqual<Size>(2048, map.getCapacity());
+      // Remove almost all values.
+      for (int key = 10; key < 1000; ++key) {
+        Assert::AreEqual(key, map.remove(key));
+      }
+      // Check new state.
+      Assert::AreEqual<Size>(10, map.getSize());
+      Assert::AreEqual<Size>(64, map.getCapacity());
+      for (int key = 0; key < 10; ++key) {
+        Assert::AreEqual(key, map.get(key));
+      }
+    }
+    /// <summary>
+    /// Test the deleted slots feature.
+    /// </summary>
+    TEST_METHOD(FeatureDeleted) {
+      SparseHashMap<int, int> map;
+      // Set and remove many different keys keeping the same size.
+      for (int key = 0; key < 5000; ++key) {
+        map.set(key, key);
+        if (key >= 20) {
+          Assert::AreEqual(key - 20, map.remove(key - 20));
+        }
+      }
+      // Check new state.
+      Assert::AreEqual<Size>(20, map.getSize());
+      Assert::AreEqual<Size>(64, map.getCapacity());
+      for (int key = 4980; key < 5000; ++key) {
+        Assert::AreEqual(key, map.get(key));
+      }
+    }
+    /// <summary>
+    /// Test the range-based loop.
+    /// </summary>
+    TEST_METHOD(FeatureRangeFor) {
+      SparseHashMap<int, int> map;
+      for (int key = 0; key < 500; ++key) {
+        map.set(key, key * 2);
+      }
+      map.remove(10);
+      // Check all values in the slot order.
+      Size count = 0;
+      for (const auto& entry : map) {
+        Assert::AreEqual(entry.key * 2, entry.value);
+        Assert::AreNotEqual(10, entry.key);
+        count++;
+      }
+      Assert::AreEqual<Size>(499, count);
+      // Check the standard algorithms.
+      Assert::AreEqual<Size>(499, static_cast<Size>(std::distance(map.begin(), map.end())));
+      const auto found = std::find_if(map.begin(), map.end(), [](const auto& entry) { return entry.key == 20; });
+      Assert::AreEqual(40, found->value);
+      for (const auto& entry : SparseHashMap<int, int>()) {
+        Assert::Fail();
+      }
+    }
+  };
+}
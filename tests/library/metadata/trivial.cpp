@@ -0,0 +1,52 @@
+/// Copyright (c) 2020 Silas B. Domingos
+/// This source code is licensed under the MIT License as described in the file LICENSE.
+///
+#include "CppUnitTest.h"
+#include "metadata.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace SPL::Metadata::Tests {
+  /// <summary>
+  /// Test class.
+  /// </summary>
+  TEST_CLASS(TrivialTests)
+  {
+  private:
+    /// <summary>
+    /// Trivial test class.
+    /// </summary>
+    class TrivialClass {
+      int value;
+    };
+    /// <summary>
+    /// Non-trivial test class.
+    /// </summary>
+    class ComplexClass {
+    public:
+      ComplexClass(const ComplexClass&) {}
+    };
+  public:
+    /// <summary>
+    /// Test the 'Copyable' property.
+    /// </summary>
+    TEST_METHOD(PropertyCopyable) {
+      // Trivially copyable type.
+      Assert::IsTrue(IsTriviallyCopyable<int>);
+      Assert::IsTrue(IsTriviallyCopyable<float*>);
+      Assert::IsTrue(IsTriviallyCopyable<TrivialClass>);
+      // Not a trivially copyable type.
+      Assert::IsFalse(IsTriviallyCopyable<ComplexClass>);
+    }
+    /// <summary>
+    /// Test the 'Relocatable' property.
+    /// </summary>
+    TEST_METHOD(PropertyRelocatable) {
+      // Trivially relocatable type.
+      Assert::IsTrue(IsTriviallyRelocatable<int>);
+      Assert::IsTrue(IsTriviallyRelocatable<TrivialClass>);
+      // Not a trivially relocatable type.
+      Assert::IsFalse(IsTriviallyRelocatable<ComplexClass>);
+    }
+  };
+}
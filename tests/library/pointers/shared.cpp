@@ -22,7 +22,7 @@ namespace SPL::Pointers::Tests {
       Shared<int> pointer;
       // Check state.
       Assert::IsFalse(pointer);
-      Assert::AreEqual(0U, pointer.getReferences());
+      Assert::AreEqual<Size>(0, pointer.getReferences());
     }
     /// <summary>
     /// Test the initialized constructor.
@@ -31,7 +31,7 @@ namespace SPL::Pointers::Tests {
       Shared<int> pointer(new int);
       // Check state.
       Assert::IsTrue(pointer);
-      Assert::AreEqual(1U, pointer.getReferences());
+      Assert::AreEqual<Size>(1, pointer.getReferences());
     }
     /// <summary>
     /// Test the copy constructor.
@@ -40,15 +40,15 @@ namespace SPL::Pointers::Tests {
       Shared<int> pointer(new int);
       // Check pointer state.
       Assert::IsTrue(pointer);
-      Assert::AreEqual(1U, pointer.getReferences());
+      Assert::AreEqual<Size>(1, pointer.getReferences());
       // Copy pointer to other.
       Shared<int> other(pointer);
       // Check other state.
       Assert::IsTrue(other);
-      Assert::AreEqual(2U, other.getReferences());
+      Assert::AreEqual<Size>(2, other.getReferences());
       // Check pointer state.
       Assert::IsTrue(pointer);
-      Assert::AreEqual(2U, pointer.getReferences());
+      Assert::AreEqual<Size>(2, pointer.getReferences());
     }
     /// <summary>
     /// Test the destructor.
@@ -58,10 +58,10 @@ namespace SPL::Pointers::Tests {
       Size instances = 0;
       // Create a new instance.
       Shared<Mock>* pointer = new Shared<Mock>(new Mock(instances));
-      Assert::AreEqual(1U, instances);
+      Assert::AreEqual<Size>(1, instances);
       // Delete the instance.
       delete pointer;
-      Assert::AreEqual(0U, instances);
+      Assert::AreEqual<Size>(0, instances);
     }
     /// <summary>
     /// Test the release method.
@@ -70,12 +70,12 @@ namespace SPL::Pointers::Tests {
       Shared<int> pointer(new int);
       // Check state.
       Assert::IsTrue(pointer);
-      Assert::AreEqual(1U, pointer.getReferences());
+      Assert::AreEqual<Size>(1, pointer.getReferences());
       // Release memory.
       pointer.release();
       // Check state.
       Assert::IsFalse(pointer);
-      Assert::AreEqual(0U, pointer.getReferences());
+      Assert::AreEqual<Size>(0, pointer.getReferences());
     }
     /// <summary>
     /// Test the copy assignment operator.
@@ -84,16 +84,16 @@ namespace SPL::Pointers::Tests {
       Shared<int> pointer(new int);
       // Check pointer state.
       Assert::IsTrue(pointer);
-      Assert::AreEqual(1U, pointer.getReferences());
+      Assert::AreEqual<Size>(1, pointer.getReferences());
       Shared<int> other;
       // Copy pointer to other.
       other = pointer;
       /// Check other state.
       Assert::IsTrue(other);
-      Assert::AreEqual(2U, other.getReferences());
+      Assert::AreEqual<Size>(2, other.getReferences());
       // Check pointer state.
       Assert::IsTrue(pointer);
-      Assert::AreEqual(2U, pointer.getReferences());
+      Assert::AreEqual<Size>(2, pointer.getReferences());
     }
     /// <summary>
     /// Test the dereference operator.
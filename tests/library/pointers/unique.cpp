@@ -53,10 +53,10 @@ namespace SPL::Pointers::Tests {
       Size instances = 0;
       // Create a new instance.
       Unique<Mock>* pointer = new Unique<Mock>(new Mock(instances));
-      Assert::AreEqual(1U, instances);
+      Assert::AreEqual<Size>(1, instances);
       // Delete the instance.
       delete pointer;
-      Assert::AreEqual(0U, instances);
+      Assert::AreEqual<Size>(0, instances);
     }
     /// <summary>
     /// Test the release method.
@@ -21,7 +21,7 @@ namespace SPL::Pointers::Tests {
       Weak<int> pointer;
       // Check state.
       Assert::IsFalse(pointer);
-      Assert::AreEqual(0U, pointer.getReferences());
+      Assert::AreEqual<Size>(0, pointer.getReferences());
     }
     /// <summary>
     /// Test the initialized constructor.
@@ -31,7 +31,7 @@ namespace SPL::Pointers::Tests {
       Weak<int> pointer(source);
       // Check state.
       Assert::IsTrue(pointer);
-      Assert::AreEqual(1U, pointer.getReferences());
+      Assert::AreEqual<Size>(1, pointer.getReferences());
     }
     /// <summary>
     /// Test the copy constructor.
@@ -41,15 +41,15 @@ namespace SPL::Pointers::Tests {
       Weak<int> pointer(source);
       // Check pointer state.
       Assert::IsTrue(pointer);
-      Assert::AreEqual(1U, pointer.getReferences());
+      Assert::AreEqual<Size>(1, pointer.getReferences());
       // Copy pointer to other.
       Weak<int> other(pointer);
       // Check other state.
       Assert::IsTrue(other);
-      Assert::AreEqual(1U, other.getReferences());
+      Assert::AreEqual<Size>(1, other.getReferences());
       // Check pointer state.
       Assert::IsTrue(pointer);
-      Assert::AreEqual(1U, pointer.getReferences());
+      Assert::AreEqual<Size>(1, pointer.getReferences());
     }
     /// <summary>
     /// Test the get method.
@@ -59,16 +59,16 @@ namespace SPL::Pointers::Tests {
       Weak<int> pointer(source);
       // Check state.
       Assert::IsTrue(pointer);
-      Assert::AreEqual(1U, pointer.getReferences());
+      Assert::AreEqual<Size>(1, pointer.getReferences());
       // Get a weak pointer copy.
       if (Shared<int> copy = pointer.get()) {
         // Check new state.
         Assert::IsTrue(pointer);
-        Assert::AreEqual(2U, pointer.getReferences());
+        Assert::AreEqual<Size>(2, pointer.getReferences());
       }
       // Check new state.
       Assert::IsTrue(pointer);
-      Assert::AreEqual(1U, pointer.getReferences());
+      Assert::AreEqual<Size>(1, pointer.getReferences());
     }
     /// <summary>
     /// Test the release method.
@@ -78,12 +78,12 @@ namespace SPL::Pointers::Tests {
       Weak<int> pointer(source);
       // Check state.
       Assert::IsTrue(pointer);
-      Assert::AreEqual(1U, pointer.getReferences());
+      Assert::AreEqual<Size>(1, pointer.getReferences());
       // Release memory.
       pointer.release();
       // Check state.
       Assert::IsFalse(pointer);
-      Assert::AreEqual(0U, pointer.getReferences());
+      Assert::AreEqual<Size>(0, pointer.getReferences());
     }
     /// <summary>
     /// Test the copy assignment operator.
@@ -93,16 +93,16 @@ namespace SPL::Pointers::Tests {
       Weak<int> pointer(source);
       // Check pointer state.
       Assert::IsTrue(pointer);
-      Assert::AreEqual(1U, pointer.getReferences());
+      Assert::AreEqual<Size>(1, pointer.getReferences());
       Weak<int> other;
       // Copy pointer to other.
       other = pointer;
       /// Check other state.
       Assert::IsTrue(other);
-      Assert::AreEqual(1U, other.getReferences());
+      Assert::AreEqual<Size>(1, other.getReferences());
       // Check pointer state.
       Assert::IsTrue(pointer);
-      Assert::AreEqual(1U, pointer.getReferences());
+      Assert::AreEqual<Size>(1, pointer.getReferences());
     }
     /// <summary>
     /// Test the release feature.
@@ -112,16 +112,16 @@ namespace SPL::Pointers::Tests {
       Weak<int> pointer1(source), pointer2(source);
       // Check states.
       Assert::IsTrue(pointer1);
-      Assert::AreEqual(1U, pointer1.getReferences());
+      Assert::AreEqual<Size>(1, pointer1.getReferences());
       Assert::IsTrue(pointer2);
-      Assert::AreEqual(1U, pointer2.getReferences());
+      Assert::AreEqual<Size>(1, pointer2.getReferences());
       // Release memory.
       source.release();
       // Check states.
       Assert::IsFalse(pointer1);
-      Assert::AreEqual(0U, pointer1.getReferences());
+      Assert::AreEqual<Size>(0, pointer1.getReferences());
       Assert::IsFalse(pointer2);
-      Assert::AreEqual(0U, pointer2.getReferences());
+      Assert::AreEqual<Size>(0, pointer2.getReferences());
     }
   };
 }
@@ -23,7 +23,7 @@ namespace SPL::PrefixTrees::Tests {
       PrefixMap<const char*, int> map;
       // Check state.
       Assert::IsTrue(map.isEmpty());
-      Assert::AreEqual(0U, map.getSize());
+      Assert::AreEqual<Size>(0, map.getSize());
     }
     /// <summary>
     /// Test the initialized constructor.
@@ -32,7 +32,7 @@ namespace SPL::PrefixTrees::Tests {
       PrefixMap<const char*, int> map({ { "abc", 10 }, { "aab", 20 }, { "acd", 30 }, { "aa", 40 } });
       // Check state.
       Assert::IsFalse(map.isEmpty());
-      Assert::AreEqual(4U, map.getSize());
+      Assert::AreEqual<Size>(4, map.getSize());
     }
     /// <summary>
     /// Test the copy constructor.
@@ -64,14 +64,14 @@ namespace SPL::PrefixTrees::Tests {
       PrefixMap<const char*, int> map(pairs), other(Move(map));
       // Check map state.
       Assert::IsTrue(map.isEmpty());
-      Assert::AreEqual(0U, map.getSize());
+      Assert::AreEqual<Size>(0, map.getSize());
       // Check map values.
       for (const Pair<const char*, int>& pair : pairs) {
         Assert::IsFalse(map.has(pair.key));
       }
       // Check other state.
       Assert::IsFalse(other.isEmpty());
-      Assert::AreEqual(4U, other.getSize());
+      Assert::AreEqual<Size>(4, other.getSize());
       // Check other values.
       for (const Pair<const char*, int>& pair : pairs) {
         Assert::AreEqual(pair.value, other.get(pair.key));
@@ -89,10 +89,10 @@ namespace SPL::PrefixTrees::Tests {
           { "acd", Mock(instances) },
           { "aa",  Mock(instances) }
         });
-      Assert::AreEqual(4U, instances);
+      Assert::AreEqual<Size>(4, instances);
       // Delete the instance.
       delete map;
-      Assert::AreEqual(0U, instances);
+      Assert::AreEqual<Size>(0, instances);
     }
     /// <summary>
     /// Test the set method.
@@ -102,7 +102,7 @@ namespace SPL::PrefixTrees::Tests {
       PrefixMap<const char*, int> map(pairs);
       // Check state.
       Assert::IsFalse(map.isEmpty());
-      Assert::AreEqual(4U, map.getSize());
+      Assert::AreEqual<Size>(4, map.getSize());
       // Map invalid key.
       Assert::ExpectException<SPL::Exceptions::InvalidArgument>([&map] {
         Assert::AreEqual(0, map.set(nullptr, 1000));
@@ -114,7 +114,7 @@ namespace SPL::PrefixTrees::Tests {
       Assert::AreEqual(0, map.set("abcd", 45));
       // Check new state.
       Assert::IsFalse(map.isEmpty());
-      Assert::AreEqual(5U, map.getSize());
+      Assert::AreEqual<Size>(5, map.getSize());
       // Check new values.
       const Pair<const char*, int> result[] = { { "abc", 15 }, { "aab", 25 }, { "acd", 35 }, { "aa", 45 }, {"abcd", 45} };
       for (const Pair<const char*, int>& pair : result) {
@@ -129,7 +129,7 @@ namespace SPL::PrefixTrees::Tests {
       PrefixMap<const char*, int> map(pairs);
       // Check state.
       Assert::IsFalse(map.isEmpty());
-      Assert::AreEqual(4U, map.getSize());
+      Assert::AreEqual<Size>(4, map.getSize());
       // Check undefined value.
       Assert::ExpectException<SPL::Exceptions::KeyNotFound<const char*>>([&map] {
         Assert::AreEqual(0, map.get(nullptr));
@@ -151,7 +151,7 @@ namespace SPL::PrefixTrees::Tests {
       int value;
       // Check state.
       Assert::IsFalse(map.isEmpty());
-      Assert::AreEqual(4U, map.getSize());
+      Assert::AreEqual<Size>(4, map.getSize());
       // Check undefined value.
       Assert::IsFalse(map.get(nullptr, value));
       Assert::IsFalse(map.get("cba", value));
@@ -169,7 +169,7 @@ namespace SPL::PrefixTrees::Tests {
       PrefixMap<const char*, int> map(pairs);
       // Check state.
       Assert::IsFalse(map.isEmpty());
-      Assert::AreEqual(4U, map.getSize());
+      Assert::AreEqual<Size>(4, map.getSize());
       // Check undefined value.
       Assert::IsFalse(map.has(nullptr));
       Assert::IsFalse(map.has("cba"));
@@ -185,7 +185,7 @@ namespace SPL::PrefixTrees::Tests {
       PrefixMap<const char*, int> map({ { "abc", 10 }, { "aab", 20 }, { "acd", 30 }, { "aa", 40 } });
       // Check state.
       Assert::IsFalse(map.isEmpty());
-      Assert::AreEqual(4U, map.getSize());
+      Assert::AreEqual<Size>(4, map.getSize());
       // Check undefined value.
       Assert::ExpectException<SPL::Exceptions::KeyNotFound<const char*>>([&map] {
         Assert::AreEqual(0, map.remove(nullptr));
@@ -195,22 +195,22 @@ namespace SPL::PrefixTrees::Tests {
       });
       // Remove the second value.
       Assert::AreEqual(20, map.remove("aab"));
-      Assert::AreEqual(3U, map.getSize());
+      Assert::AreEqual<Size>(3, map.getSize());
       Assert::IsFalse(map.isEmpty());
       Assert::IsFalse(map.has("aab"));
       // Remove the third value.
       Assert::AreEqual(30, map.remove("acd"));
-      Assert::AreEqual(2U, map.getSize());
+      Assert::AreEqual<Size>(2, map.getSize());
       Assert::IsFalse(map.isEmpty());
       Assert::IsFalse(map.has("acd"));
       // Remove first value.
       Assert::AreEqual(10, map.remove("abc"));
-      Assert::AreEqual(1U, map.getSize());
+      Assert::AreEqual<Size>(1, map.getSize());
       Assert::IsFalse(map.isEmpty());
       Assert::IsFalse(map.has("abc"));
       // Remove fourth value.
       Assert::AreEqual(40, map.remove("aa"));
-      Assert::AreEqual(0U, map.getSize());
+      Assert::AreEqual<Size>(0, map.getSize());
       Assert::IsTrue(map.isEmpty());
       Assert::IsFalse(map.has("aa"));
     }
@@ -222,31 +222,31 @@ namespace SPL::PrefixTrees::Tests {
       int value;
       // Check state.
       Assert::IsFalse(map.isEmpty());
-      Assert::AreEqual(4U, map.getSize());
+      Assert::AreEqual<Size>(4, map.getSize());
       // Check undefined value.
       Assert::IsFalse(map.remove(nullptr, value));
       Assert::IsFalse(map.remove("cba", value));
       // Remove the second value.
       Assert::IsTrue(map.remove("aab", value));
-      Assert::AreEqual(3U, map.getSize());
+      Assert::AreEqual<Size>(3, map.getSize());
       Assert::AreEqual(20, value);
       Assert::IsFalse(map.isEmpty());
       Assert::IsFalse(map.has("aab"));
       // Remove the third value.
       Assert::IsTrue(map.remove("acd", value));
-      Assert::AreEqual(2U, map.getSize());
+      Assert::AreEqual<Size>(2, map.getSize());
       Assert::AreEqual(30, value);
       Assert::IsFalse(map.isEmpty());
       Assert::IsFalse(map.has("acd"));
       // Remove the first value.
       Assert::IsTrue(map.remove("abc", value));
-      Assert::AreEqual(1U, map.getSize());
+      Assert::AreEqual<Size>(1, map.getSize());
       Assert::AreEqual(10, value);
       Assert::IsFalse(map.isEmpty());
       Assert::IsFalse(map.has("abc"));
       // Remove the fourth value.
       Assert::IsTrue(map.remove("aa", value));
-      Assert::AreEqual(0U, map.getSize());
+      Assert::AreEqual<Size>(0, map.getSize());
       Assert::AreEqual(40, value);
       Assert::IsTrue(map.isEmpty());
       Assert::IsFalse(map.has("aa"));
@@ -259,12 +259,12 @@ namespace SPL::PrefixTrees::Tests {
       PrefixMap<const char*, int> map(pairs);
       // Check state.
       Assert::IsFalse(map.isEmpty());
-      Assert::AreEqual(4U, map.getSize());
+      Assert::AreEqual<Size>(4, map.getSize());
       // Clear data.
       map.clear();
       // Check new state.
       Assert::IsTrue(map.isEmpty());
-      Assert::AreEqual(0U, map.getSize());
+      Assert::AreEqual<Size>(0, map.getSize());
       // Check values.
       for (const Pair<const char*, int>& pair : pairs) {
         Assert::IsFalse(map.has(pair.key));
@@ -304,14 +304,14 @@ namespace SPL::PrefixTrees::Tests {
       other = Move(map);
       // Check map state.
       Assert::IsTrue(map.isEmpty());
-      Assert::AreEqual(0U, map.getSize());
+      Assert::AreEqual<Size>(0, map.getSize());
       // Check map values.
       for (const Pair<const char*, int>& pair : pairs) {
         Assert::IsFalse(map.has(pair.key));
       }
       // Check other state.
       Assert::IsFalse(other.isEmpty());
-      Assert::AreEqual(4U, other.getSize());
+      Assert::AreEqual<Size>(4, other.getSize());
       // Check other values.
       for (const Pair<const char*, int>& pair : pairs) {
         Assert::AreEqual(pair.value, other[pair.key]);
@@ -347,5 +347,20 @@ namespace SPL::PrefixTrees::Tests {
       Assert::AreEqual('b', root->getDownNode()->getKey());
       Assert::AreEqual('c', root->getDownNode()->getDownNode()->getKey());
     }
+    /// <summary>
+    /// Test the range-based loop.
+    /// </summary>
+    TEST_METHOD(FeatureRangeFor) {
+      PrefixMap<const char*, int> map({ { "abc", 10 }, { "aab", 20 }, { "acd", 30 }, { "aa", 40 } });
+      // Check values in the ascending order.
+      const Pair<const char*, int> result[] = { { "aa", 40 }, { "aab", 20 }, { "abc", 10 }, { "acd", 30 } };
+      Index index = 0;
+      for (const auto& pair : map) {
+        Assert::AreEqual(result[index].key, pair.key);
+        Assert::AreEqual(result[index].value, pair.value);
+        index++;
+      }
+      Assert::AreEqual<Size>(4, index);
+    }
   };
 }
@@ -1,6 +1,9 @@
 /// Copyright (c) 2020 Silas B. Domingos
 /// This source code is licensed under the MIT License as described in the file LICENSE.
 ///
+#include <algorithm>
+#include <iterator>
+
 #include "../mock.hpp"
 #include "CppUnitTest.h"
 #include "interfaces.hpp"
@@ -23,7 +26,7 @@ namespace SPL::PrefixTrees::Tests {
       PrefixSet<const char*> set;
       // Check state.
       Assert::IsTrue(set.isEmpty());
-      Assert::AreEqual(0U, set.getSize());
+      Assert::AreEqual<Size>(0, set.getSize());
     }
     /// <summary>
     /// Test the initialized constructor.
@@ -32,7 +35,7 @@ namespace SPL::PrefixTrees::Tests {
       PrefixSet<const char*> set({ "abc", "aab", "acd", "aa" });
       // Check state.
       Assert::IsFalse(set.isEmpty());
-      Assert::AreEqual(4U, set.getSize());
+      Assert::AreEqual<Size>(4, set.getSize());
     }
     /// <summary>
     /// Test the copy constructor.
@@ -64,14 +67,14 @@ namespace SPL::PrefixTrees::Tests {
       PrefixSet<const char*> set(values), other(Move(set));
       // Check set state.
       Assert::IsTrue(set.isEmpty());
-      Assert::AreEqual(0U, set.getSize());
+      Assert::AreEqual<Size>(0, set.getSize());
       // Check set values.
       for (const char* value : values) {
         Assert::IsFalse(set.has(value));
       }
       // Check other state.
       Assert::IsFalse(other.isEmpty());
-      Assert::AreEqual(4U, other.getSize());
+      Assert::AreEqual<Size>(4, other.getSize());
       // Check other values.
       for (const char* value : values) {
         Assert::IsTrue(other.has(value));
@@ -88,10 +91,10 @@ namespace SPL::PrefixTrees::Tests {
           Mock(instances),
           Mock(instances)
         });
-      Assert::AreEqual(3U, instances);
+      Assert::AreEqual<Size>(3, instances);
       // Delete the instance.
       delete set;
-      Assert::AreEqual(0U, instances);
+      Assert::AreEqual<Size>(0, instances);
       */
     }
     /// <summary>
@@ -102,7 +105,7 @@ namespace SPL::PrefixTrees::Tests {
       PrefixSet<const char*> set(values);
       // Check state.
       Assert::IsFalse(set.isEmpty());
-      Assert::AreEqual(4U, set.getSize());
+      Assert::AreEqual<Size>(4, set.getSize());
       // Add invalid value.
       Assert::ExpectException<SPL::Exceptions::InvalidArgument>([&set] {
         set.add(nullptr);
@@ -114,7 +117,7 @@ namespace SPL::PrefixTrees::Tests {
       set.add("abcd");
       // Check new state.
       Assert::IsFalse(set.isEmpty());
-      Assert::AreEqual(5U, set.getSize());
+      Assert::AreEqual<Size>(5, set.getSize());
       // Check new values.
       const char* result[] = { "abc", "aab", "acd", "aa", "abcd" };
       for (const char* value : result) {
@@ -129,7 +132,7 @@ namespace SPL::PrefixTrees::Tests {
       PrefixSet<const char*> set(values);
       // Check state.
       Assert::IsFalse(set.isEmpty());
-      Assert::AreEqual(4U, set.getSize());
+      Assert::AreEqual<Size>(4, set.getSize());
       // Check undefined value.
       Assert::IsFalse(set.has(nullptr));
       Assert::IsFalse(set.has("cba"));
@@ -145,28 +148,28 @@ namespace SPL::PrefixTrees::Tests {
       PrefixSet<const char*> set({ "abc", "aab", "acd", "aa" });
       // Check state.
       Assert::IsFalse(set.isEmpty());
-      Assert::AreEqual(4U, set.getSize());
+      Assert::AreEqual<Size>(4, set.getSize());
       // Check undefined values.
       Assert::IsFalse(set.remove(nullptr));
       Assert::IsFalse(set.remove("cba"));
       // Remove the second value.
       Assert::IsTrue(set.remove("aab"));
-      Assert::AreEqual(3U, set.getSize());
+      Assert::AreEqual<Size>(3, set.getSize());
       Assert::IsFalse(set.isEmpty());
       Assert::IsFalse(set.has("aab"));
       // Remove the third value.
       Assert::IsTrue(set.remove("acd"));
-      Assert::AreEqual(2U, set.getSize());
+      Assert::AreEqual<Size>(2, set.getSize());
       Assert::IsFalse(set.isEmpty());
       Assert::IsFalse(set.has("acd"));
       // Remove the first value.
       Assert::IsTrue(set.remove("abc"));
-      Assert::AreEqual(1U, set.getSize());
+      Assert::AreEqual<Size>(1, set.getSize());
       Assert::IsFalse(set.isEmpty());
       Assert::IsFalse(set.has("abc"));
       // Remove the fourth value.
       Assert::IsTrue(set.remove("aa"));
-      Assert::AreEqual(0U, set.getSize());
+      Assert::AreEqual<Size>(0, set.getSize());
       Assert::IsTrue(set.isEmpty());
       Assert::IsFalse(set.has("aa"));
     }
@@ -178,12 +181,12 @@ namespace SPL::PrefixTrees::Tests {
       PrefixSet<const char*> set(values);
       // Check state.
       Assert::IsFalse(set.isEmpty());
-      Assert::AreEqual(4U, set.getSize());
+      Assert::AreEqual<Size>(4, set.getSize());
       // Clear data.
       set.clear();
       // Check new state.
       Assert::IsTrue(set.isEmpty());
-      Assert::AreEqual(0U, set.getSize());
+      Assert::AreEqual<Size>(0, set.getSize());
       // Check values.
       for (const char* value : values) {
         Assert::IsFalse(set.has(value));
@@ -223,14 +226,14 @@ namespace SPL::PrefixTrees::Tests {
       other = Move(set);
       // Check set state.
       Assert::IsTrue(set.isEmpty());
-      Assert::AreEqual(0U, set.getSize());
+      Assert::AreEqual<Size>(0, set.getSize());
       // Check values.
       for (const char* value : values) {
         Assert::IsFalse(set.has(value));
       }
       // Check other state.
       Assert::IsFalse(other.isEmpty());
-      Assert::AreEqual(4U, other.getSize());
+      Assert::AreEqual<Size>(4, other.getSize());
       // Check other values.
       for (const char* value : values) {
         Assert::IsTrue(other.has(value));
@@ -247,5 +250,26 @@ namespace SPL::PrefixTrees::Tests {
       Assert::AreEqual('b', root->getDownNode()->getKey());
       Assert::AreEqual('c', root->getDownNode()->getDownNode()->getKey());
     }
+    /// <summary>
+    /// Test the range-based loop.
+    /// </summary>
+    TEST_METHOD(FeatureRangeFor) {
+      PrefixSet<const char*> set({ "abc", "aab", "acd", "aa", "b" });
+      set.remove("acd");
+      // Check values in the ascending order.
+      const char* result[] = { "aa", "aab", "abc", "b" };
+      Index index = 0;
+      for (const char* key : set) {
+        Assert::AreEqual(result[index++], key);
+      }
+      Assert::AreEqual<Size>(4, index);
+      // Check the standard algorithms.
+      Assert::AreEqual<Size>(4, static_cast<Size>(std::distance(set.begin(), set.end())));
+      const auto found = std::find_if(set.begin(), set.end(), [](const char* key) { return key[0] == 'b'; });
+      Assert::AreEqual("b", *found);
+      for (const char* key : PrefixSet<const char*>()) {
+        Assert::Fail();
+      }
+    }
   };
 }
@@ -23,7 +23,7 @@ namespace SPL::Tests {
       WideString string;
       // Check state.
       Assert::IsTrue(string.isEmpty());
-      Assert::AreEqual(0U, string.getLength());
+      Assert::AreEqual<Size>(0, string.getLength());
     }
     /// <summary>
     /// Test the initialized constructor (with length).
@@ -32,7 +32,7 @@ namespace SPL::Tests {
       WideString string(3U);
       // Check state.
       Assert::IsFalse(string.isEmpty());
-      Assert::AreEqual(3U, string.getLength());
+      Assert::AreEqual<Size>(3, string.getLength());
     }
     /// <summary>
     /// Test the initialized constructor (with string).
@@ -41,7 +41,7 @@ namespace SPL::Tests {
       WideString string(L"abc");
       // Check state.
       Assert::IsFalse(string.isEmpty());
-      Assert::AreEqual(3U, string.getLength());
+      Assert::AreEqual<Size>(3, string.getLength());
     }
     /// <summary>
     /// Test the initialized constructor (with pointer and length).
@@ -51,7 +51,7 @@ namespace SPL::Tests {
       WideString string(input, (sizeof(input) / sizeof(wchar_t)) - 1);
       // Check state.
       Assert::IsFalse(string.isEmpty());
-      Assert::AreEqual(3U, string.getLength());
+      Assert::AreEqual<Size>(3, string.getLength());
     }
     /// <summary>
     /// Test the copy constructor.
@@ -74,7 +74,7 @@ namespace SPL::Tests {
       WideString string(text), other(Move(string));
       // Check string state.
       Assert::IsTrue(string.isEmpty());
-      Assert::AreEqual(0U, string.getLength());
+      Assert::AreEqual<Size>(0, string.getLength());
       // Check other state.
       Assert::AreEqual(0, other.compare(WideString(text)));
     }
@@ -111,10 +111,10 @@ namespace SPL::Tests {
       Assert::AreEqual<Size>(-1, string.indexOf(WideString(L"zzz")));
       Assert::AreEqual<Size>(-1, string.indexOf(WideString()));
       // Check defined.
-      Assert::AreEqual(0U, string.indexOf(WideString(L"abc")));
-      Assert::AreEqual(3U, string.indexOf(WideString(L"def")));
-      Assert::AreEqual(6U, string.indexOf(WideString(L"abc"), 3));
-      Assert::AreEqual(9U, string.indexOf(WideString(L"def"), 4));
+      Assert::AreEqual<Size>(0, string.indexOf(WideString(L"abc")));
+      Assert::AreEqual<Size>(3, string.indexOf(WideString(L"def")));
+      Assert::AreEqual<Size>(6, string.indexOf(WideString(L"abc"), 3));
+      Assert::AreEqual<Size>(9, string.indexOf(WideString(L"def"), 4));
     }
     /// <summary>
     /// Test the lastIndexOf method.
@@ -126,10 +126,10 @@ namespace SPL::Tests {
       Assert::AreEqual<Size>(-1, string.lastIndexOf(WideString(L"zzz")));
       Assert::AreEqual<Size>(-1, string.lastIndexOf(WideString()));
       // Check defined.
-      Assert::AreEqual(6U, string.lastIndexOf(WideString(L"abc")));
-      Assert::AreEqual(9U, string.lastIndexOf(WideString(L"def")));
-      Assert::AreEqual(0U, string.lastIndexOf(WideString(L"abc"), string.getLength() - 7));
-      Assert::AreEqual(3U, string.lastIndexOf(WideString(L"def"), string.getLength() - 4));
+      Assert::AreEqual<Size>(6, string.lastIndexOf(WideString(L"abc")));
+      Assert::AreEqual<Size>(9, string.lastIndexOf(WideString(L"def")));
+      Assert::AreEqual<Size>(0, string.lastIndexOf(WideString(L"abc"), string.getLength() - 7));
+      Assert::AreEqual<Size>(3, string.lastIndexOf(WideString(L"def"), string.getLength() - 4));
     }
     /// <summary>
     /// Test the contains method.
@@ -208,6 +208,40 @@ namespace SPL::Tests {
       Assert::AreEqual(0, string.compare(WideString(L"cba")));
     }
     /// <summary>
+    /// Test the copy-on-write feature.
+    /// </summary>
+    TEST_METHOD(FeatureCopyOnWrite) {
+      WideString string(L"abc"), other(string);
+      const auto& constant = string;
+      const auto& shared = other;
+      // Check state.
+      Assert::IsTrue(&constant[0] == &shared[0]);
+      // Change values.
+      other[0] = L'e';
+      string.reverse();
+      // Check values.
+      Assert::IsFalse(&constant[0] == &shared[0]);
+      Assert::AreEqual(0, string.compare(WideString(L"cba")));
+      Assert::AreEqual(0, other.compare(WideString(L"ebc")));
+    }
+    /// <summary>
+    /// Test the character references handed out before copying the string.
+    /// </summary>
+    TEST_METHOD(FeatureUnshareable) {
+      WideString string(L"abc");
+      auto& character = string[0];
+      auto* pointer = string.begin();
+      // Copy the string and change values by the previous references.
+      const WideString copy(string), other = string;
+      character = L'x';
+      pointer[1] = L'y';
+      // Check values.
+      Assert::AreEqual(0, string.compare(WideString(L"xyc")));
+      Assert::AreEqual(0, copy.compare(WideString(L"abc")));
+      Assert::AreEqual(0, other.compare(WideString(L"abc")));
+      Assert::IsFalse(&copy[0] == &other[0]);
+    }
+    /// <summary>
     /// Test the copy assignment operator.
     /// </summary>
     TEST_METHOD(OperatorCopy) {
@@ -232,7 +266,7 @@ namespace SPL::Tests {
       other = Move(string);
       // Check string state.
       Assert::IsTrue(string.isEmpty());
-      Assert::AreEqual(0U, string.getLength());
+      Assert::AreEqual<Size>(0, string.getLength());
       // Check other state.
       Assert::AreEqual(0, other.compare(WideString(values)));
     }
@@ -252,5 +286,23 @@ namespace SPL::Tests {
         Assert::AreEqual(values[index], other[index]);
       }
     }
+    /// <summary>
+    /// Test the range-based loop.
+    /// </summary>
+    TEST_METHOD(FeatureRangeFor) {
+      WideString string(L"abc"), other(string);
+      // Change values.
+      for (auto& character : string) {
+        character -= L'a' - L'A';
+      }
+      // Check values.
+      Assert::AreEqual(0, string.compare(WideString(L"ABC")));
+      Assert::AreEqual(0, other.compare(WideString(L"abc")));
+      Index index = 0;
+      for (const auto& character : static_cast<const WideString&>(other)) {
+        Assert::AreEqual(L"abc"[index++], character);
+      }
+      Assert::AreEqual<Size>(3, index);
+    }
   };
 }